@@ -10,25 +10,68 @@
 
 #include <stdint.h>
 
+// length of the quick fade used when a voice is stolen (seconds)
+#define ADSR_FADE_TIME 0.005f
+
+// envelope segments
+#define ADSR_IDLE    0
+#define ADSR_ATTACK  1
+#define ADSR_DECAY   2
+#define ADSR_SUSTAIN 3
+#define ADSR_RELEASE 4
+
+// envelope curves
+#define ADSR_CURVE_LINEAR 0
+#define ADSR_CURVE_EXP    1
+
+// exponential curves aim past their target by this fraction of the
+// segment so they reach it in finite time.  smaller is more curved.
+#define ADSR_EXP_ATTACK_RATIO 0.3f
+#define ADSR_EXP_DECAY_RATIO  0.001f
+
 typedef struct {
   float attack;
   float decay;
   float sustain;
   float release;
   float scale;
+  uint8_t curve;         // ADSR_CURVE_LINEAR or ADSR_CURVE_EXP
   float max_amplitude;
-  float start_time;
-  float release_time;
-  float cur_amplitude;
-  float release_amplitude;
+  int64_t start_frame;   // synth frame of note on, -1 = reset
+  int64_t release_frame; // synth frame of note off, -1 = not released
+  float cur_amplitude;   // current output gain, includes max_amplitude
+  uint8_t fading;        // 1 = releasing over ADSR_FADE_TIME instead of release
+  // current segment, advanced incrementally by adsr_get_samples
+  uint8_t segment;       // ADSR_IDLE, ADSR_ATTACK, ...
+  uint8_t seg_curve;     // curve the segment's steps were computed for
+  int32_t remaining;     // frames left in the segment
+  float target;          // cur_amplitude at the end of the segment
+  float inc;             // linear: per-frame increment
+  float coef, base;      // exponential: per-frame cur_amplitude*coef + base
 } adsr_state_t;
 
+// the envelope over a run of frames, for code that applies the envelope
+// itself.  level is the gain of the first frame, each following frame is
+// level + inc (ADSR_CURVE_LINEAR) or level*coef + base (ADSR_CURVE_EXP).
+typedef struct {
+  uint8_t curve;
+  float level;
+  float inc;
+  float coef, base;
+} adsr_ramp_t;
+
 void adsr_init(adsr_state_t *self, float attack, float decay, float sustain, float release, float scale);
 void adsr_reset(adsr_state_t *self);
-void adsr_note_on(adsr_state_t *self, int8_t velocity, float time);
-void adsr_note_off(adsr_state_t *self, float time);
-void adsr_get_samples(adsr_state_t *self, float *inout_samples, int frame_count, float time);
-int8_t adsr_active(adsr_state_t *self, float time);
-int8_t adsr_releasing(adsr_state_t *self, float time);
+void adsr_note_on(adsr_state_t *self, int8_t velocity, int64_t frame);
+void adsr_note_off(adsr_state_t *self, int64_t frame);
+void adsr_fade(adsr_state_t *self, int64_t frame);
+void adsr_get_samples(adsr_state_t *self, float *inout_samples, int frame_count);
+void adsr_mix_samples(adsr_state_t *self, float *in_samples, float *inout_samples, int frame_count);
+float adsr_advance(adsr_state_t *self, int frame_count);
+int adsr_get_ramp(adsr_state_t *self, int frame_count, adsr_ramp_t *ramp);
+void adsr_end_ramp(adsr_state_t *self, int frame_count, float level);
+int8_t adsr_active(adsr_state_t *self);
+int8_t adsr_releasing(adsr_state_t *self);
+int8_t adsr_fading(adsr_state_t *self);
 
 #endif /* INC_ADSR_H_ */
@@ -9,6 +9,7 @@
 #define SNDFILTER_BIQUAD__H
 
 #include "snd.h"
+#include <stdint.h>
 
 // biquad filtering is a technique used to perform a variety of sound filters
 //
@@ -39,6 +40,13 @@ typedef struct {
 	sf_sample_st xn2;
 	sf_sample_st yn1;
 	sf_sample_st yn2;
+	// coefficients to ramp to during the next sf_biquad_process, see sf_biquad_retune
+	bool ramp;
+	float tb0;
+	float tb1;
+	float tb2;
+	float ta1;
+	float ta2;
 } sf_biquad_state_st;
 
 // these functions will initialize an sf_biquad_state_st structure based on the desired filter
@@ -51,9 +59,131 @@ void sf_allpass  (sf_biquad_state_st *state, int rate, float freq, float Q);
 void sf_lowshelf (sf_biquad_state_st *state, int rate, float freq, float Q, float gain);
 void sf_highshelf(sf_biquad_state_st *state, int rate, float freq, float Q, float gain);
 
+// the functions above clear the filter's history, which clicks if the filter is running
+//
+// to change a running filter, initialize a second state with the new design and pass it to
+// sf_biquad_retune.  this keeps the history and sets the new coefficients as a target, which the
+// next sf_biquad_process ramps to across its chunk.  for example, to sweep the cutoff:
+//
+//   for each 128 length sample:
+//     sf_biquad_state_st design;
+//     sf_lowpass(&design, 44100, cutoff, 1);
+//     sf_biquad_retune(&lowpass, &design);
+//     sf_biquad_process(&lowpass, 128, input, output);
+void sf_biquad_retune(sf_biquad_state_st *state, const sf_biquad_state_st *design);
+
+// sf_lowpass_fast is the same design as sf_lowpass, but looks up the trig and dB conversion in
+// small interpolated tables instead of calling powf, sinf and cosf.  it is cheap enough to call
+// for every voice on every chunk.  below a quarter of the rate the coefficients stay within
+// 2.5e-5 of sf_lowpass (relative to the largest coefficient).
+//
+// the tables are const, so they stay in flash.  they are generated into biquad_tables.c by
+// biquad_gen.py, rerun it after changing FAST_SIN_BITS or FAST_EXP2_BITS
+void sf_lowpass_fast(sf_biquad_state_st *state, int rate, float cutoff, float resonance);
+
+#define FAST_SIN_BITS  10
+#define FAST_SIN_SIZE  (1 << FAST_SIN_BITS)
+#define FAST_EXP2_BITS 6
+#define FAST_EXP2_SIZE (1 << FAST_EXP2_BITS)
+
+extern const float sf_fast_sin[FAST_SIN_SIZE + FAST_SIN_SIZE / 4 + 1]; // one cycle plus room for cos
+extern const float sf_fast_exp2[FAST_EXP2_SIZE + 1];                   // 2^(k/FAST_EXP2_SIZE)
+
 // this function will process the input sound based on the state passed
 // the input and output buffers should be the same size
 void sf_biquad_process(sf_biquad_state_st *state, int size, sf_sample_st *input,
 	sf_sample_st *output);
 
+// a cascade runs several biquad stages over a chunk in one pass, for steeper filters or EQs
+//
+// each stage is in transposed direct form II, which only needs two state values per channel
+// instead of four, and the stages are unrolled so their state stays in registers for the whole
+// chunk.  the coefficients come from any of the designs above, for example a 24dB/oct lowpass:
+//
+//   sf_biquad_cascade_st lp24;
+//   sf_biquad_state_st design;
+//   sf_biquad_cascade_init(&lp24, 2);
+//   sf_lowpass(&design, 44100, 440, 0);
+//   sf_biquad_cascade_set(&lp24, 0, &design);
+//   sf_biquad_cascade_set(&lp24, 1, &design);
+//
+//   for each 128 length sample:
+//     sf_biquad_cascade_process(&lp24, 128, input, output);
+//
+// sf_biquad_cascade_set keeps the stage's history, but the new coefficients take effect at once
+#define SF_BIQUAD_CASCADE_MAX 4
+
+typedef struct {
+	float b0;
+	float b1;
+	float b2;
+	float a1;
+	float a2;
+	sf_sample_st s1;
+	sf_sample_st s2;
+} sf_biquad_stage_st;
+
+typedef struct {
+	int stages; // 1 to SF_BIQUAD_CASCADE_MAX
+	sf_biquad_stage_st stage[SF_BIQUAD_CASCADE_MAX];
+} sf_biquad_cascade_st;
+
+// initialize the cascade with every stage passing its input through, and no history
+void sf_biquad_cascade_init(sf_biquad_cascade_st *state, int stages);
+
+// copy the coefficients of design into one stage of the cascade
+void sf_biquad_cascade_set(sf_biquad_cascade_st *state, int stage,
+	const sf_biquad_state_st *design);
+
+// run the cascade, input and output can be the same buffer
+void sf_biquad_cascade_process(sf_biquad_cascade_st *state, int size, sf_sample_st *input,
+	sf_sample_st *output);
+
+// fixed point version of sf_biquad_process, for cores where integer multiply-accumulate is cheaper
+// than floating point
+//
+// the coefficients are Q2.30 and the samples are converted to Q5.27 (4 bits of headroom above
+// +-1.0) on the way in and back to float on the way out.  a design with a coefficient of 2 or
+// more (shelves & peaking with gain, often) gets fewer fraction bits, as many as its largest
+// coefficient leaves, & the sum is shifted back by that much.  each output is a 64-bit sum of products,
+// which gcc compiles to SMLAL on the Cortex-M4 -- the same C is the portable fallback elsewhere.
+// a1 and a2 are kept negated so every term is an accumulate.
+//
+// initialize from any of the float designs above:
+//
+//   sf_biquad_state_st design;
+//   sf_biquad_fixed_st lowpass;
+//   sf_lowpass(&design, 44100, 440, 1);
+//   sf_biquad_fixed_init(&lowpass, &design);
+//
+//   for each 128 length sample:
+//     sf_biquad_fixed_process(&lowpass, 128, input, output);
+//
+// sf_biquad_fixed_retune keeps the history and ramps to the new design over the next chunk, like
+// sf_biquad_retune
+typedef struct {
+	int32_t b0;
+	int32_t b1;
+	int32_t b2;
+	int32_t na1; // -a1
+	int32_t na2; // -a2
+	int32_t xn1[2];
+	int32_t xn2[2];
+	int32_t yn1[2];
+	int32_t yn2[2];
+	// coefficients to land on at the end of the next sf_biquad_fixed_process
+	int32_t tb0;
+	int32_t tb1;
+	int32_t tb2;
+	int32_t tna1;
+	int32_t tna2;
+	bool ramp;
+	int8_t bits; // fraction bits of the coefficients
+} sf_biquad_fixed_st;
+
+void sf_biquad_fixed_init(sf_biquad_fixed_st *state, const sf_biquad_state_st *design);
+void sf_biquad_fixed_retune(sf_biquad_fixed_st *state, const sf_biquad_state_st *design);
+void sf_biquad_fixed_process(sf_biquad_fixed_st *state, int size, sf_sample_st *input,
+	sf_sample_st *output);
+
 #endif // SNDFILTER_BIQUAD__H
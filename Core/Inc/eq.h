@@ -0,0 +1,43 @@
+/*
+ * eq.h
+ *
+ *  Created on: Oct 17, 2026
+ *      Author: agent
+ *
+ * master EQ: low shelf, two peaking bands & high shelf.  the bands that
+ * are not flat run as one sf_biquad_cascade_st, so the whole EQ is a
+ * single pass over the buffer & a flat EQ is skipped entirely.
+ */
+
+#ifndef INC_EQ_H_
+#define INC_EQ_H_
+
+#include "biquad.h"
+#include <stdint.h>
+
+#define EQ_BANDS 4 // must be <= SF_BIQUAD_CASCADE_MAX
+
+// band types, in band order
+#define EQ_LOWSHELF  0
+#define EQ_PEAK1     1
+#define EQ_PEAK2     2
+#define EQ_HIGHSHELF 3
+
+// bands within this many dB of 0 are treated as flat
+#define EQ_FLAT_DB 0.05f
+
+typedef struct {
+  float freq[EQ_BANDS];                // Hz
+  float gain[EQ_BANDS];                // dB
+  sf_biquad_state_st design[EQ_BANDS]; // coefficients for each band
+  int8_t stage[EQ_BANDS];              // cascade stage of each band, -1 = flat
+  int stages;                          // number of bands that are not flat
+  sf_biquad_cascade_st cascade;
+} eq_state_t;
+
+void eq_init(eq_state_t *self);
+void eq_set_band(eq_state_t *self, uint8_t band, float freq, float gain);
+void eq_update(eq_state_t *self);
+void eq_process(eq_state_t *self, float *inout_samples, int frame_count);
+
+#endif /* INC_EQ_H_ */
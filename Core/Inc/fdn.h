@@ -0,0 +1,75 @@
+/*
+ * fdn.h
+ *
+ *  Created on: Oct 17, 2026
+ *      Author: agent
+ *
+ * 8 line feedback delay network reverb.  every frame each line's output
+ * is damped by its own one-pole lowpass, scaled for the decay time &
+ * mixed back into all 8 lines through an 8x8 Hadamard matrix.  the
+ * matrix is a fast Walsh-Hadamard transform, 24 adds & subtracts, with
+ * its 1/sqrt(8) folded into the line gains.  each line's length wobbles
+ * slowly by up to FDN_MOD_DEPTH frames so the tail doesn't ring.
+ *
+ * the lines are longer than a block, so a whole block is read from all
+ * 8 lines before any of it is written.  the rest (damp, matrix & write)
+ * runs a frame at a time on all 8 lines at once, a vector of 8 floats.
+ *
+ * it uses the same reverb_ring_t as reverb.c, so only one of them can
+ * run at a time.  reverb_init clears the ring, fdn_init doesn't.
+ *
+ * FRAME_RATE = 48000
+ * lines: 1031, 1327, 1523, 1783, 1999, 2237, 2477, 2693 frames (all prime)
+ * even lines go to the left output, odd lines to the right.
+ */
+
+#ifndef INC_FDN_H_
+#define INC_FDN_H_
+
+#include "reverb.h"
+#include <stdint.h>
+
+// verb number for the fdn, after reverb.h's algorithms
+#define REVERB_FDN 2
+
+#define FDN_LINES 8
+#define FDN_FRAMES (1031 + 1327 + 1523 + 1783 + 1999 + 2237 + 2477 + 2693)
+// peak to peak wobble of the line lengths in frames
+#define FDN_MOD_DEPTH 16
+#if (FDN_FRAMES + FDN_LINES*(FDN_MOD_DEPTH + REVERB_LINE_PAD)) > REVERB_BUF_LEN
+#error fdn lines do not fit in REVERB_BUF_LEN
+#endif
+
+// decay time in seconds for room 0.0 & 1.0
+#define FDN_T60_MIN 0.2f
+#define FDN_T60_MAX 4.0f
+#define FDN_DAMP_SCALE 0.4f
+// brings the fdn's output to about the schroeder's level
+#define FDN_GAIN 0.2f
+
+typedef struct {
+  reverb_wet_t wet;
+  float room;                  // 0..1 sets the decay time
+  float damp;                  // 0..1 how much faster the highs decay
+  float gain[FDN_LINES];       // per pass, includes the matrix's 1/sqrt(8)
+  float damp1[FDN_LINES];      // per line lowpass coefficient
+  float store[FDN_LINES];      // per line lowpass state
+  int offset[FDN_LINES];       // where each line's slice of the ring starts
+  float delay[FDN_LINES];      // current length in frames
+  float lfo_phase[FDN_LINES];  // radians
+  uint32_t pos;                // write position, before the offsets & mask
+  int quiet_frames;            // frames the input & output have been silent
+  reverb_ring_t *ring;
+  // per block scratch
+  float in[REVERB_BLOCK_FRAMES];
+  float x[FDN_LINES][REVERB_BLOCK_FRAMES];
+} fdn_state_t;
+
+void fdn_init(fdn_state_t *self, reverb_ring_t *ring, float wet);
+void fdn_clear(fdn_state_t *self);
+void fdn_set_wet(fdn_state_t *self, float wet);
+void fdn_set_room(fdn_state_t *self, float room);
+void fdn_set_damp(fdn_state_t *self, float damp);
+void fdn_get_samples(fdn_state_t *self, float *in_samples, float *out_samples, int frame_count);
+
+#endif /* INC_FDN_H_ */
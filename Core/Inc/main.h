@@ -47,6 +47,10 @@ extern "C" {
 
 /* Exported macro ------------------------------------------------------------*/
 /* USER CODE BEGIN EM */
+// put a variable in the 64K CCMRAM (the .ccmram section in the linker
+// scripts).  the CPU reaches it with no bus contention, but DMA can't
+// reach it at all & the startup code does not zero it.
+#define CCMRAM __attribute__((section(".ccmram")))
 
 /* USER CODE END EM */
 
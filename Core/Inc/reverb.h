@@ -29,13 +29,55 @@
  * allp1:  1.680ms -> 81 frames
  * allp2:  0.480ms -> 23 frames
  * total frame count = 7665 or 30660 bytes
+ *
+ * REVERB_FREEVERB is a second algorithm in the same memory, after
+ * Jezar's freeverb (https://github.com/sinshu/freeverb):
+ * input = FREEVERB_GAIN * (left + right) / 2
+ * 4 parallel Comb Filters, each with a one-pole lowpass in its
+ *   feedback (damp) & feedback gain 0.7 + 0.28*room
+ * Sum & Mul by 0.25
+ * 3 freeverb AllPasses for each side, Gain: 0.5
+ * unlike freeverb's, the combs are shared by both sides, which saves 4
+ * of its 14 lines.  the right side's allpasses are all FREEVERB_SPREAD frames
+ * longer, so the two sides are still decorrelated.
+ * cost: 10 lines against the schroeder's 7, so in the float build it is
+ * 1.4-1.9x the (mono) schroeder, over its budget.  that's accepted as
+ * the price of a stereo tail: with fewer lines it is still over (2
+ * allpasses a side: ~1.35x) & the sides come together (L/R correlation
+ * 0.07 -> 0.19, sharing allpasses 0.43).  in the REVERB_Q15 build it is
+ * cheaper than the schroeder's two tanks.  see test/bench_reverb.c.
+ * FRAME_RATE = 48000 (freeverb's 44.1k tunings scaled)
+ * combs: 1215, 1390, 1548, 1695 frames
+ * allps:  605,  371,  245 frames
  */
 
 #ifndef INC_REVERB_H_
 #define INC_REVERB_H_
 
+#include <stdint.h>
+#include <math.h>
+
+// build option: define REVERB_Q15 to 1 (e.g. in the compiler's
+// preprocessor symbols) to store the delay lines as 16-bit fixed point.
+// that halves their memory, which pays for a second tank with slightly
+// shorter delays for the right channel, so the reverb is true stereo.
+// the float build only has room for one tank, fed from the left input.
+#ifndef REVERB_Q15
+#define REVERB_Q15 0
+#endif
+
+#if REVERB_Q15
+#define REVERB_TANKS 2
+typedef int16_t reverb_sample_t;
+// a comb's feedback can build up to ~6x its input, so store +/-8.0
+// full scale (Q3.12) & saturate anything louder
+#define REVERB_Q15_SCALE 4096.0f
+#else
+#define REVERB_TANKS 1
+typedef float reverb_sample_t;
+#endif
+
 // Allow for delay scale < 2
-// Note: Can't do stereo.  Hits memory limits.
 #define MAX_DELAY 2
 #define COMB0_LEN 1730*MAX_DELAY
 #define COMB1_LEN 1494*MAX_DELAY
@@ -45,20 +87,184 @@
 #define ALLP1_LEN 81*MAX_DELAY
 #define ALLP2_LEN 23*MAX_DELAY
 
+#define NUM_COMBS 4
+#define NUM_ALLPS 3
+#define NUM_LINES (NUM_COMBS + NUM_ALLPS)
+
+// algorithms
+#define REVERB_SCHROEDER 0
+#define REVERB_FREEVERB  1
+
+// freeverb is always stereo.  its lines are not scaled by delay (which
+// can only shorten them) so both sides fit the float build's one tank.
+#define REVERB_CHANNELS 2
+#define FREEVERB_SPREAD 25
+#define FREEVERB_COMB_FRAMES (1215 + 1390 + 1548 + 1695)
+#define FREEVERB_ALLP_FRAMES (605 + 371 + 245)
+// brings freeverb's output down to about the schroeder's level
+#define FREEVERB_GAIN 0.2f
+#define FREEVERB_ROOM_SCALE 0.28f
+#define FREEVERB_ROOM_OFFSET 0.7f
+#define FREEVERB_DAMP_SCALE 0.4f
+#define FREEVERB_ALLP_GAIN 0.5f
+
+// the reverb runs each line over up to this many frames at a time
+#define REVERB_BLOCK_FRAMES 128
+
+// all the lines of a tank share one power-of-two ring buffer with one write
+// position, so indexing is just a mask.  each line owns a slice of the
+// ring just behind its own offset: its longest delay, plus a block
+// (the line before it writes a whole block ahead) plus one frame for
+// interpolation & one so the oldest frame is never overwritten early.
+#define REVERB_LINE_PAD (REVERB_BLOCK_FRAMES + 2)
+#define REVERB_BUF_BITS 14
+#define REVERB_BUF_LEN  (1 << REVERB_BUF_BITS)
+#define REVERB_BUF_MASK (REVERB_BUF_LEN - 1)
+#if (COMB0_LEN + COMB1_LEN + COMB2_LEN + COMB3_LEN + ALLP0_LEN + ALLP1_LEN + ALLP2_LEN + NUM_LINES*REVERB_LINE_PAD) > REVERB_BUF_LEN
+#error reverb lines do not fit in REVERB_BUF_LEN
+#endif
+#if REVERB_BUF_LEN < (FREEVERB_COMB_FRAMES + 2*FREEVERB_ALLP_FRAMES + NUM_ALLPS*FREEVERB_SPREAD + (NUM_COMBS + 2*NUM_ALLPS)*REVERB_LINE_PAD)
+#error freeverb lines do not fit in REVERB_BUF_LEN
+#endif
+
+// wet changes ramp over this many frames
+#define REVERB_WET_RAMP_FRAMES 1024
+// delay changes move each read position by at most this many frames
+// per frame (a slight pitch bend while the delay changes)
+#define REVERB_DELAY_SLEW (1.0f/32)
+// once the input & the wet output have both been below REVERB_SILENCE
+// (an LSB of the 16-bit DAC) for REVERB_IDLE_FRAMES, longer than any
+// line, the lines hold nothing audible.  they are then skipped until
+// the input comes back.
+#define REVERB_SILENCE (1.0f/32768)
+#define REVERB_IDLE_FRAMES REVERB_BUF_LEN
+
+// the wet level, which moves in a straight line to its target over
+// REVERB_WET_RAMP_FRAMES, so it changes without a click.  see
+// reverb_wet_block.
 typedef struct {
   float wet;
+  float target;
+  float step;   // change per frame, set by reverb_wet_set
+} reverb_wet_t;
+
+// one delay line.  the read position trails the shared write position
+// by delay frames, so the delay can change without clearing the buffer.
+typedef struct {
+  reverb_sample_t *buf; // the ring the line is in
+  int offset;     // where the line's slice of the ring starts
+  int max_delay;  // longest delay in frames
+  float gain;
+  float store;    // freeverb's damping lowpass
+  float delay;    // current delay in frames, moves toward target
+  float target;   // delay in frames set by reverb_set_delay
+  float delay_inc;// change in delay per frame for the current block
+} reverb_line_t;
+
+// the delay lines' memory, kept apart from the rest of the state so it
+// can be placed on its own.  it is exactly 64K, the size of the CCMRAM.
+typedef struct {
+  reverb_sample_t buf[REVERB_TANKS][REVERB_BUF_LEN];
+} reverb_ring_t;
+
+typedef struct {
+  reverb_wet_t wet;
   float delay; // delay scale factor
-  int comb0_lim, comb1_lim, comb2_lim, comb3_lim;
-  int allp0_lim, allp1_lim, allp2_lim;
-  float comb0[COMB0_LEN], comb1[COMB1_LEN], comb2[COMB2_LEN], comb3[COMB3_LEN];
-  float allp0[ALLP0_LEN], allp1[ALLP1_LEN], allp2[ALLP2_LEN];
-  float comb0_gain, comb1_gain, comb2_gain, comb3_gain;
-  float allp0_gain, allp1_gain, allp2_gain;
-  int comb0_idx, comb1_idx, comb2_idx, comb3_idx;
-  int allp0_idx, allp1_idx, allp2_idx;
+  int algorithm;
+  int channels; // sets of allpasses (& outputs) in use
+  int banks;    // sets of combs in use, freeverb's sides share one
+  float room;   // freeverb room size 0..1
+  float damp;   // freeverb damping 0..1
+  reverb_line_t comb[REVERB_CHANNELS][NUM_COMBS];
+  reverb_line_t allp[REVERB_CHANNELS][NUM_ALLPS];
+  uint32_t pos; // write position, before the offsets & mask
+  int quiet_frames; // frames the input & output have been silent
+  reverb_ring_t *ring;
+  // per block scratch
+  float in[REVERB_CHANNELS][REVERB_BLOCK_FRAMES];
+  float out[REVERB_CHANNELS][REVERB_BLOCK_FRAMES];
 } reverb_state_t;
 
-void reverb_init(reverb_state_t *self, float wet, float delay);
+// convert to & from what the ring stores
+#if REVERB_Q15
+static inline reverb_sample_t reverb_store(float v)
+{
+  float q = v * REVERB_Q15_SCALE;
+  q = (q > 32767.0f) ? 32767.0f : (q < -32768.0f) ? -32768.0f : q;
+  return (reverb_sample_t)q;
+}
+static inline float reverb_load(reverb_sample_t v)
+{
+  return v * (1.0f / REVERB_Q15_SCALE);
+}
+#else
+#define reverb_store(v) (v)
+#define reverb_load(v) (v)
+#endif
+
+static inline void reverb_wet_init(reverb_wet_t *self, float wet)
+{
+  self->wet = wet;
+  self->target = wet;
+  self->step = 0.0f;
+}
+
+// change wet without a click.  it ramps over REVERB_WET_RAMP_FRAMES from
+// wherever it is now.  wet & step are shared with the audio interrupt,
+// so call it with the interrupt off.
+static inline void reverb_wet_set(reverb_wet_t *self, float wet)
+{
+  self->target = wet;
+  self->step = (wet - self->wet) * (1.0f / REVERB_WET_RAMP_FRAMES);
+}
+
+// the wet level at the start of a block & its change per frame across
+// the block, moving toward the target.  it is left at the block's end.
+static inline float reverb_wet_block(reverb_wet_t *self, int frame_count, float *wet_inc)
+{
+  float wet_step = self->step * frame_count;
+  float wet_end = self->wet + wet_step;
+  if((wet_step > 0) ? (wet_end > self->target) : (wet_end < self->target)) {
+    wet_end = self->target;
+  }
+  *wet_inc = (wet_end - self->wet) / frame_count;
+  float wet = self->wet;
+  self->wet = wet_end;
+  return wet;
+}
+
+// the lines hold nothing audible once they & their input have been
+// silent for REVERB_IDLE_FRAMES.  they can be skipped (& left where they
+// are) for as long as the input stays silent.
+static inline int reverb_idle(int quiet_frames, float in_peak)
+{
+  return (quiet_frames >= REVERB_IDLE_FRAMES) && (in_peak < REVERB_SILENCE);
+}
+
+// quiet_frames after a block the lines ran for
+static inline int reverb_quiet_frames(int quiet_frames, float in_peak, float out_peak, int frame_count)
+{
+  return ((in_peak < REVERB_SILENCE) && (out_peak < REVERB_SILENCE)) ? quiet_frames + frame_count : 0;
+}
+
+// largest magnitude in samples[].  fabsf is a single instruction, where
+// testing the sign is a branch that noise mispredicts half the time.
+static inline float reverb_peak(const float *samples, int count)
+{
+  float peak = 0.0f;
+  for(int i = 0; i < count; i++) {
+    float v = fabsf(samples[i]);
+    peak = (v > peak) ? v : peak;
+  }
+  return peak;
+}
+
+void reverb_init(reverb_state_t *self, reverb_ring_t *ring, int algorithm, float wet, float delay);
+void reverb_set_wet(reverb_state_t *self, float wet);
+void reverb_set_delay(reverb_state_t *self, float delay);
+void reverb_set_algorithm(reverb_state_t *self, int algorithm);
+void reverb_set_room(reverb_state_t *self, float room);
+void reverb_set_damp(reverb_state_t *self, float damp);
 void reverb_get_samples(reverb_state_t *self, float *in_samples, float *out_samples, int frame_count);
 
 #endif /* INC_REVERB_H_ */
@@ -0,0 +1,44 @@
+/*
+ * svf.h
+ *
+ *  Created on: Oct 17, 2026
+ *      Author: agent
+ *
+ * zero-delay-feedback (topology preserving) state variable filter, after
+ * Andrew Simper's "Linear Trapezoidal Integrated SVF"
+ * https://cytomic.com/files/dsp/SvfLinearTrapOptimised2.pdf
+ *
+ * the state is the two integrators, so changing the cutoff or resonance
+ * between blocks does not upset it the way it does a biquad's history,
+ * & it is stable at any resonance.  lowpass, bandpass & highpass all come
+ * out of the same step.
+ */
+
+#ifndef INC_SVF_H_
+#define INC_SVF_H_
+
+#include "snd.h"
+#include <stdint.h>
+
+// outputs for svf_process
+#define SVF_LOWPASS  0
+#define SVF_BANDPASS 1
+#define SVF_HIGHPASS 2
+
+typedef struct {
+  uint8_t mode;        // SVF_LOWPASS, SVF_BANDPASS or SVF_HIGHPASS
+  float g;             // tan(pi * cutoff / FRAME_RATE)
+  float k;             // 1/Q, damping
+  float a1, a2, a3;    // per-sample coefficients from g & k
+  sf_sample_st ic1eq;  // integrator states
+  sf_sample_st ic2eq;
+} svf_state_t;
+
+void svf_init(svf_state_t *self, uint8_t mode, float cutoff, float resonance);
+void svf_set_cutoff(svf_state_t *self, float cutoff);
+void svf_set_resonance(svf_state_t *self, float resonance);
+void svf_process(svf_state_t *self, int frame_count, sf_sample_st *input, sf_sample_st *output);
+void svf_process_split(svf_state_t *self, int frame_count, sf_sample_st *input,
+    sf_sample_st *lowpass, sf_sample_st *bandpass, sf_sample_st *highpass);
+
+#endif /* INC_SVF_H_ */
@@ -11,68 +11,183 @@
 #include "wavetable.h"
 #include "adsr.h"
 #include "biquad.h"
+#include "vcf.h"
+#include "svf.h"
+#include "eq.h"
 #include "reverb.h"
+#include "fdn.h"
 #include <stdint.h>
 
 // polyphony
-// *WARNING* use 2 voices max for Debug builds (3 is right on the hairy edge)
+// *WARNING* set voices to 2 max for Debug builds (3 is right on the hairy edge)
 // release build can easily do 10
 #define MAX_POLYPHONY 10
 
+// build option: define SYNTH_RLPF_FIXED to 1 (e.g. in the compiler's
+// preprocessor symbols) to run the rlpf in fixed point with
+// sf_biquad_fixed_process instead of the float sf_biquad_process.  every
+// type works, the shelves' & peaking's large coefficients get fewer
+// fraction bits (see biquad.h).
+#ifndef SYNTH_RLPF_FIXED
+#define SYNTH_RLPF_FIXED 0
+#endif
+
+// rlpf filter types, one for each design in biquad.h
+#define FILTER_LOWPASS   0
+#define FILTER_HIGHPASS  1
+#define FILTER_BANDPASS  2
+#define FILTER_NOTCH     3
+#define FILTER_PEAKING   4
+#define FILTER_ALLPASS   5
+#define FILTER_LOWSHELF  6
+#define FILTER_HIGHSHELF 7
+
+// voice stealing policies
+#define STEAL_OLDEST    0
+#define STEAL_QUIETEST  1
+#define STEAL_RELEASING 2
+
+// per-block statistics from update_audio_buffer
+typedef struct {
+  uint32_t blocks;              // number of blocks rendered
+  uint8_t  voices_rendered;     // voices rendered in the last block
+  uint8_t  max_voices_rendered; // most voices rendered in any block
+  uint32_t cycles;              // cpu cycles used by the last block
+  uint32_t max_cycles;          // most cpu cycles used by any block
+  uint64_t voice_cycles;        // cpu cycles used rendering voices, all blocks
+  uint32_t voice_blocks;        // voices rendered, summed over all blocks
+} synth_stats_t;
+
 typedef struct {
   //                     voices
   uint8_t wave;          // 0: sine, 1: saw, [TBD: 2: square, 3: tri, 4: noise]
-  uint8_t voices;        // max number of simultaneous voices FIXME use this
+  uint8_t voices;        // max number of simultaneous voices (1-MAX_POLYPHONY)
+  uint8_t steal;         // voice stealing 0: oldest, 1: quietest, 2: releasing first
   //                     envelope
   float attack;          // attack in seconds (0 -> scale)
   float decay;           // decay in seconds  (scale -> scale*sustain)
   float sustain;         // sustain level (0.0-1.0)
   float release;         // release in seconds (scale*sustain -> 0.0)
   float scale;           // max of any one voice (0.0-1.0)
-  //                     rlpf - resonant lowpass filter
-  uint8_t enable_rlpf;   // 0=disable FIXME use this
-  float cutoff;          // cutoff frequency
-  float resonance;       // size of peak at cutoff
+  uint8_t curve;         // envelope curve 0: linear, 1: exponential
+  //                     vcf - per voice resonant lowpass filter
+  uint8_t filter;        // 0=off, 1=filter each voice before its envelope
+  float fcutoff;         // cutoff frequency with the filter envelope at 0
+  float fresonance;      // size of peak at cutoff
+  float fenv;            // octaves the filter envelope raises the cutoff
+  float fvelocity;       // octaves added to the cutoff at full velocity
+  float fattack;         // filter envelope attack in seconds (0 -> 1)
+  float fdecay;          // filter envelope decay in seconds  (1 -> fsustain)
+  float fsustain;        // filter envelope sustain level (0.0-1.0)
+  float frelease;        // filter envelope release in seconds (fsustain -> 0.0)
+  //                     rlpf - resonant lowpass (or other type) filter
+  uint8_t enable_rlpf;   // 0=disable, the stage is skipped
+  uint8_t type;          // FILTER_LOWPASS, FILTER_HIGHPASS, ...
+  float cutoff;          // cutoff (or center) frequency
+  float resonance;       // in dB for every type (0 dB is a Q of 1)
+  float gain;            // dB of boost or cut for peaking & shelf types
+  uint8_t svf;           // 0: biquad, 1: state variable filter (lowpass, highpass & bandpass)
+  //                     eq - master eq, see eq.h for the bands
+  float eq_freq[EQ_BANDS]; // Hz
+  float eq_gain[EQ_BANDS]; // dB, 0 = flat & skipped
   //                     reverb
   uint8_t enable_reverb; // 0=disable FIXME use this
   float wet;             // all dry(original) signal=0.0, all wet(reverb)=1.0
   float delay;           // scale reverb delay 1.0=Schroder defaults  (max = 2.0!)
+  uint8_t verb;          // REVERB_SCHROEDER, REVERB_FREEVERB or REVERB_FDN
+  float room;            // freeverb & fdn room size 0.0-1.0
+  float damp;            // freeverb & fdn damping 0.0-1.0
   // synthesis blocks
   wavetable_state_t  wavetables[MAX_POLYPHONY];
   adsr_state_t       envelopes[MAX_POLYPHONY];
+  adsr_state_t       filter_envelopes[MAX_POLYPHONY];
+  vcf_bank_t         vcf;
+  float              velocity[MAX_POLYPHONY]; // of each voice's note (0.0-1.0)
   sf_biquad_state_st rlpf;
-  reverb_state_t     *reverb; // state too large to put on the stack
-  // time
-  float synth_time;
+  sf_biquad_fixed_st rlpf_fixed; // used instead of rlpf if SYNTH_RLPF_FIXED
+  svf_state_t        rsvf;
+  eq_state_t         eq;
+  reverb_state_t     *reverb; // static, its delay lines are in CCMRAM
+  fdn_state_t        fdn;     // used instead of reverb for REVERB_FDN, shares its lines
+  // list of voice indices that are sounding & need to be rendered
+  uint8_t active_voices[MAX_POLYPHONY];
+  uint8_t num_active_voices;
+  // note to start on a stolen voice once its fade is done. -1 = none
+  int8_t pending_pitch[MAX_POLYPHONY];
+  int8_t pending_velocity[MAX_POLYPHONY];
+  synth_stats_t stats;
+  // time, counted in frames since synth_init.  64 bits so it never
+  // wraps & envelopes stay sample-exact no matter how long we run.
+  int64_t synth_frame;
 } synth_state_t;
 
-#define DEFAULT_VOICES    MAX_POLYPHONY
-#define DEFAULT_WAVE      1
-#define DEFAULT_ATTACK    0.1
-#define DEFAULT_DECAY     0.1
-#define DEFAULT_SUSTAIN   0.8
-#define DEFAULT_RELEASE   0.1
-#define DEFAULT_SCALE     0.3
-#define DEFAULT_CUTOFF    900.0
-#define DEFAULT_RESONANCE 3.0
-#define DEFAULT_WET       0.75
-#define DEFAULT_DELAY     1.80
+#define DEFAULT_VOICES     MAX_POLYPHONY
+#define DEFAULT_WAVE       WAVE_SAW
+#define DEFAULT_STEAL      STEAL_RELEASING
+#define DEFAULT_ATTACK     0.1
+#define DEFAULT_DECAY      0.1
+#define DEFAULT_SUSTAIN    0.8
+#define DEFAULT_RELEASE    0.1
+#define DEFAULT_SCALE      0.3
+#define DEFAULT_CURVE      ADSR_CURVE_LINEAR
+#define DEFAULT_FILTER     0
+#define DEFAULT_FCUTOFF    300.0
+#define DEFAULT_FRESONANCE 6.0
+#define DEFAULT_FENV       4.0
+#define DEFAULT_FVELOCITY  1.0
+#define DEFAULT_FATTACK    0.01
+#define DEFAULT_FDECAY     0.3
+#define DEFAULT_FSUSTAIN   0.3
+#define DEFAULT_FRELEASE   0.3
+#define DEFAULT_RLPF       1
+#define DEFAULT_TYPE       FILTER_LOWPASS
+#define DEFAULT_GAIN       0.0
+#define DEFAULT_CUTOFF     900.0
+#define DEFAULT_RESONANCE  3.0
+#define DEFAULT_SVF        0
+#define DEFAULT_WET        0.75
+#define DEFAULT_DELAY      1.80
+#define DEFAULT_VERB       REVERB_SCHROEDER
+#define DEFAULT_ROOM       0.5
+#define DEFAULT_DAMP       0.5
 
 void synth_init(void);
 void synth_all_notes_off(void);
+void synth_print_stats(void);
+void synth_reset_stats(void);
 void note_off(uint8_t midi_cmd, uint8_t midi_param0, uint8_t midi_param1);
 void note_on(uint8_t midi_cmd, uint8_t midi_param0, uint8_t midi_param1);
 
 void set_wave(uint8_t v);
 void set_voices(uint8_t v);
+void set_steal(uint8_t v);
 void set_attack(float v);
 void set_decay(float v);
 void set_sustain(float v);
 void set_release(float v);
 void set_scale(float v);
+void set_curve(uint8_t v);
+void set_filter(uint8_t v);
+void set_fcutoff(float v);
+void set_fresonance(float v);
+void set_fenv(float v);
+void set_fvelocity(float v);
+void set_fattack(float v);
+void set_fdecay(float v);
+void set_fsustain(float v);
+void set_frelease(float v);
+void set_rlpf(uint8_t v);
+void set_type(uint8_t v);
 void set_cutoff(float v);
 void set_resonance(float v);
+void set_gain(float v);
+void set_svf(uint8_t v);
+void set_eq_freq(uint8_t band, float v);
+void set_eq_gain(uint8_t band, float v);
 void set_wet(float v);
 void set_delay(float v);
+void set_verb(uint8_t v);
+void set_room(float v);
+void set_damp(float v);
 
 #endif /* INC_SYNTH_H_ */
@@ -0,0 +1,45 @@
+/*
+ * vcf.h
+ *
+ *  Created on: Oct 17, 2026
+ *      Author: agent
+ */
+
+#ifndef INC_VCF_H_
+#define INC_VCF_H_
+
+#include <stdint.h>
+
+// number of voices in a bank.  must be at least MAX_POLYPHONY.
+#define VCF_MAX_VOICES 10
+
+// a resonant lowpass filter for each voice.  the lowpass design has
+// b1 = 2*b0 & b2 = b0, so only b0, a1 & a2 are kept.  the state is a
+// struct of arrays indexed by voice, so the per-block update of all the
+// voices walks each array in order.
+//
+// vcf_set is meant to be called every block.  the coefficients then ramp
+// from where they are to the new design over the next vcf_process, so
+// sweeping the cutoff does not zipper.
+typedef struct {
+  // coefficients
+  float b0[VCF_MAX_VOICES];
+  float a1[VCF_MAX_VOICES];
+  float a2[VCF_MAX_VOICES];
+  // coefficients to ramp to during the next vcf_process
+  float tb0[VCF_MAX_VOICES];
+  float ta1[VCF_MAX_VOICES];
+  float ta2[VCF_MAX_VOICES];
+  // mono history
+  float x1[VCF_MAX_VOICES];
+  float x2[VCF_MAX_VOICES];
+  float y1[VCF_MAX_VOICES];
+  float y2[VCF_MAX_VOICES];
+} vcf_bank_t;
+
+void vcf_init(vcf_bank_t *self);
+void vcf_note_on(vcf_bank_t *self, uint8_t voice, float cutoff, float resonance);
+void vcf_set(vcf_bank_t *self, uint8_t voice, float cutoff, float resonance);
+void vcf_process(vcf_bank_t *self, uint8_t voice, float *inout_samples, int frame_count);
+
+#endif /* INC_VCF_H_ */
@@ -8,19 +8,40 @@
 #ifndef INC_WAVETABLE_H_
 #define INC_WAVETABLE_H_
 
+#include "adsr.h"
 #include <stdint.h>
 
-// defines for wave table
-#define WAVE_TABLE_LENGTH 256
+// defines for wave table.  the tables are generated by wavetable_gen.py,
+// rerun it after changing WAVE_TABLE_BITS.
+#define WAVE_TABLE_BITS   10
+#define WAVE_TABLE_LENGTH (1 << WAVE_TABLE_BITS)
 
-// wave table that is used to update the audio_buffer
-float sine_wave_table[WAVE_TABLE_LENGTH];
-float saw_wave_table[WAVE_TABLE_LENGTH];
+// phase is a 32-bit fixed-point fraction of a cycle.  the top
+// WAVE_TABLE_BITS index the table & the rest interpolate between entries.
+#define WAVE_PHASE_FRAC_BITS (32 - WAVE_TABLE_BITS)
+#define WAVE_PHASE_FRAC_MASK ((1UL << WAVE_PHASE_FRAC_BITS) - 1)
+
+// waveforms
+#define WAVE_SINE 0
+#define WAVE_SAW  1
+#define NUM_WAVES 2
+
+// band-limited mipmaps.  level 0 has the most harmonics the table can
+// hold & each level after it has half as many, for notes an octave higher.
+// the last level is a pure sine.
+#define WAVE_MIP_LEVELS (WAVE_TABLE_BITS - 1)
+
+// wave tables that are used to update the audio_buffer.  the extra entry
+// repeats the first so interpolation never has to wrap.  these are const
+// so they stay in flash, see wavetable_data.c
+extern const float sine_wave_table[WAVE_TABLE_LENGTH + 1];
+extern const float saw_wave_table[WAVE_MIP_LEVELS][WAVE_TABLE_LENGTH + 1];
 
 typedef struct {
-  uint8_t wave;
-  float   phase;
-  float   phase_inc;
+  uint8_t  wave;
+  uint32_t phase;
+  uint32_t phase_inc;
+  uint8_t  mip_level; // which band-limited table to use for this pitch
   int8_t  pitch;
   float   pitch_hz;
 } wavetable_state_t;
@@ -29,5 +50,6 @@ void wavetable_init(wavetable_state_t *self, uint8_t wave);
 void wavetable_note_on(wavetable_state_t *self, int8_t pitch, int8_t velocity);
 void wavetable_note_off(wavetable_state_t *self);
 void wavetable_get_samples(wavetable_state_t *self, float *out_samples, int frame_count);
+void wavetable_mix_samples(wavetable_state_t *self, float *inout_samples, int frame_count, adsr_ramp_t *ramp);
 
 #endif /* INC_WAVETABLE_H_ */
@@ -4,12 +4,25 @@
  *  Created on: Jun 25, 2021
  *      Author: rallen
  */
+//
+// The envelope is a series of segments.  Each timed segment (attack,
+// decay, release) moves cur_amplitude from where it is to a target over
+// a whole number of frames.  The per-frame step is computed once when the
+// segment starts, so rendering a block is just an add (linear) or a
+// multiply-add (exponential) per frame.  Segments can end anywhere inside
+// a block.
+//
+//   note on -> [Attack] -> [Decay] -> [Sustain]
+//   note off / fade ----------------> [Release] -> [Idle]
+//
 
 #include "adsr.h"
 #include "synthutil.h"
+#include <inttypes.h>
+#include <math.h>
 #include <stdio.h>
 
-float get_sample(adsr_state_t *self, float time);
+void segment_start(adsr_state_t *self, uint8_t segment);
 
 // ======================================================================
 void adsr_init(adsr_state_t *self, float attack, float decay, float sustain, float release, float scale)
@@ -19,140 +32,259 @@ void adsr_init(adsr_state_t *self, float attack, float decay, float sustain, flo
   self->sustain = sustain;
   self->release = release;
   self->scale   = scale;
+  self->curve   = ADSR_CURVE_LINEAR;
   adsr_reset(self);
 }
 
 // ======================================================================
 void adsr_reset(adsr_state_t *self)
 {
-  self->max_amplitude = -1;
-  self->cur_amplitude = -1;
-  self->start_time = -1;
-  self->release_time = -1;
-  self->release_amplitude = -1;
+  self->max_amplitude = 0;
+  self->cur_amplitude = 0;
+  self->start_frame = -1;
+  self->release_frame = -1;
+  self->fading = 0;
+  segment_start(self, ADSR_IDLE);
 }
 
 // ======================================================================
-void adsr_note_on(adsr_state_t *self, int8_t velocity, float time)
+void adsr_note_on(adsr_state_t *self, int8_t velocity, int64_t frame)
 {
-  //printf("adsr note on %f\r\n",time);
   self->max_amplitude = self->scale * (float)velocity/127.0;
-  self->start_time = time;
-  self->release_time = -1;
+  self->start_frame = frame;
+  self->release_frame = -1;
   self->cur_amplitude = 0;
-  self->release_amplitude = 0;
+  self->fading = 0;
+  segment_start(self, ADSR_ATTACK);
 }
 
 // ======================================================================
-void adsr_note_off(adsr_state_t *self, float time)
+void adsr_note_off(adsr_state_t *self, int64_t frame)
 {
-  if(self->release_time > 0) {
+  if(self->release_frame >= 0) {
     // we are already releasing (should not get here)
-    printf("adsr note off [NOPE, ERROR] %f\r\n", time);
+    printf("adsr note off [NOPE, ERROR] %" PRIu32 "\r\n", (uint32_t)frame);
+    return;
+  }
+  if(self->segment == ADSR_IDLE) {
     return;
   }
-  //printf("adsr note off %f\r\n", time);
-  self->release_time = time;
-  self->release_amplitude = self->cur_amplitude;
+  self->release_frame = frame;
+  segment_start(self, ADSR_RELEASE);
 }
 
 // ======================================================================
-void adsr_get_samples(adsr_state_t *self, float *inout_samples,int frame_count, float time)
+// quickly fade out from the current amplitude, even if already releasing.
+// used when the voice is stolen for a new note.
+void adsr_fade(adsr_state_t *self, int64_t frame)
 {
-  float cur_time = time;
-  for(int frame = 0; frame < frame_count; frame++) {
-    float sample_f = get_sample(self, cur_time);
-    if(frame == 0) {
-      //printf("envelope %f %f\r\n",time,sample_f);
-    }
-    inout_samples[2*frame]   *= sample_f;
-    inout_samples[2*frame+1] *= sample_f;
-    cur_time = time + (float)frame/FRAME_RATE;
+  if(0 == adsr_active(self)) {
+    return;
   }
+  self->release_frame = frame;
+  self->fading = 1;
+  segment_start(self, ADSR_RELEASE);
 }
 
-// TEST_MODE sets amplitude = 1.0 when active.
-#define TEST_MODE 0
-
 // ======================================================================
-inline float get_sample(adsr_state_t *self, float time)
+// multiply the mono inout_samples by the envelope & advance it
+// frame_count frames
+void adsr_get_samples(adsr_state_t *self, float *inout_samples, int frame_count)
 {
-  if( self->start_time < 0) {
-    // reset state
-    return 0;
+  int i = 0;
+  while(i < frame_count) {
+    adsr_ramp_t ramp;
+    int n = adsr_get_ramp(self, frame_count - i, &ramp);
+    if(n == 0) {
+      for(; i < frame_count; i++) {
+        inout_samples[i] = 0.0f;
+      }
+      break;
+    }
+    int end = i + n;
+    float level = ramp.level;
+    if(ramp.curve == ADSR_CURVE_EXP) {
+      for(; i < end; i++) {
+        inout_samples[i] *= level;
+        level = level * ramp.coef + ramp.base;
+      }
+    } else {
+      for(; i < end; i++) {
+        inout_samples[i] *= level;
+        level += ramp.inc;
+      }
+    }
+    adsr_end_ramp(self, n, level);
   }
-  if (self->release_time < self->start_time) {
-    // Attack, Decay, Sustain
-    float cur_time = time - self->start_time;
-    if (cur_time <= self->attack) {
-      // Attack
-      self->cur_amplitude = cur_time / self->attack;
-#if TEST_MODE == 1
-      return 1.0;
-#else
-      return self->cur_amplitude * self->max_amplitude;
-#endif
+}
+
+// ======================================================================
+// multiply the mono in_samples by the envelope, add them into the mono
+// inout_samples & advance it frame_count frames
+void adsr_mix_samples(adsr_state_t *self, float *in_samples, float *inout_samples, int frame_count)
+{
+  int i = 0;
+  while(i < frame_count) {
+    adsr_ramp_t ramp;
+    int n = adsr_get_ramp(self, frame_count - i, &ramp);
+    if(n == 0) {
+      // idle, nothing more to add
+      break;
     }
-    cur_time -= self->attack;
-    if (cur_time <= self->decay) {
-      // Decay
-      self->cur_amplitude =
-          self->sustain + (1.0f - self->sustain) * (1.0f - cur_time / self->decay);
-#if TEST_MODE == 1
-      return 1.0;
-#else
-      return self->cur_amplitude * self->max_amplitude;
-#endif
+    int end = i + n;
+    float level = ramp.level;
+    if(ramp.curve == ADSR_CURVE_EXP) {
+      for(; i < end; i++) {
+        inout_samples[i] += in_samples[i] * level;
+        level = level * ramp.coef + ramp.base;
+      }
+    } else {
+      for(; i < end; i++) {
+        inout_samples[i] += in_samples[i] * level;
+        level += ramp.inc;
+      }
     }
-    // Sustain
-    self->cur_amplitude = self->sustain;
-#if TEST_MODE == 1
-    return 1.0;
-#else
-    return self->cur_amplitude * self->max_amplitude;
-#endif
+    adsr_end_ramp(self, n, level);
   }
-  else {
-    float cur_time = time - self->release_time;
-    if (cur_time <= self->release) {
-      // Release
-#if TEST_MODE == 1
-      return 1.0;
-#else
-      return self->release_amplitude * (1.0f - cur_time / self->release) * self->max_amplitude;
-#endif
+}
+
+// ======================================================================
+// advance the envelope frame_count frames without applying it & return
+// the level it ends on.  for envelopes that modulate once per block.
+float adsr_advance(adsr_state_t *self, int frame_count)
+{
+  int i = 0;
+  while(i < frame_count) {
+    adsr_ramp_t ramp;
+    int n = adsr_get_ramp(self, frame_count - i, &ramp);
+    if(n == 0) {
+      break;
     }
-    // done
-    self->cur_amplitude = 0.0f;
-    return self->cur_amplitude;
+    float level = ramp.level;
+    if(ramp.curve == ADSR_CURVE_EXP) {
+      for(int j = 0; j < n; j++) {
+        level = level * ramp.coef + ramp.base;
+      }
+    } else {
+      level += ramp.inc * n;
+    }
+    adsr_end_ramp(self, n, level);
+    i += n;
   }
+  return self->cur_amplitude;
 }
 
 // ======================================================================
-int8_t adsr_active(adsr_state_t *self, float time)
+// describe the envelope for up to frame_count frames as a ramp.  returns
+// the number of frames the ramp covers, which stops at the end of the
+// current segment.  0 means the envelope is idle (silent).
+int adsr_get_ramp(adsr_state_t *self, int frame_count, adsr_ramp_t *ramp)
 {
-  if (self->start_time < 0.0) {
+  switch(self->segment) {
+  case ADSR_IDLE:
     return 0;
+  case ADSR_SUSTAIN:
+    // read sustain every block so changes to it are heard right away
+    self->cur_amplitude = self->sustain * self->max_amplitude;
+    ramp->curve = ADSR_CURVE_LINEAR;
+    ramp->level = self->cur_amplitude;
+    ramp->inc   = 0.0f;
+    return frame_count;
+  default:
+    // the steps are for the curve the segment started with, curve may
+    // have been changed since
+    ramp->curve = self->seg_curve;
+    ramp->level = self->cur_amplitude;
+    ramp->inc   = self->inc;
+    ramp->coef  = self->coef;
+    ramp->base  = self->base;
+    return (frame_count < self->remaining) ? frame_count : self->remaining;
   }
-  else if (time >= self->start_time) {
-    if (self->release_time < 0.0) {
-      return 1; // prior to noteOff
-    }
-    else if (time - self->release_time <= self->release) {
-      return 1; // during release
-    }
-    else {
-      return 0; // after release
-    }
+}
+
+// ======================================================================
+// advance the envelope past the frame_count frames of the last ramp.
+// level is the ramp's level after its last frame.
+void adsr_end_ramp(adsr_state_t *self, int frame_count, float level)
+{
+  if(self->segment == ADSR_SUSTAIN || self->segment == ADSR_IDLE) {
+    return;
+  }
+  self->cur_amplitude = level;
+  self->remaining -= frame_count;
+  if(self->remaining == 0) {
+    // land exactly on the target & move on
+    self->cur_amplitude = self->target;
+    segment_start(self, (self->segment == ADSR_RELEASE) ? ADSR_IDLE : self->segment + 1);
+  }
+}
+
+// ======================================================================
+// set up the per-frame step to go from cur_amplitude to the target of
+// this segment.  zero-length segments are skipped immediately.
+void segment_start(adsr_state_t *self, uint8_t segment)
+{
+  float length;
+  float ratio;
+  self->segment = segment;
+  switch(segment) {
+  case ADSR_ATTACK:
+    self->target = self->max_amplitude;
+    length = self->attack;
+    ratio = ADSR_EXP_ATTACK_RATIO;
+    break;
+  case ADSR_DECAY:
+    self->target = self->sustain * self->max_amplitude;
+    length = self->decay;
+    ratio = ADSR_EXP_DECAY_RATIO;
+    break;
+  case ADSR_RELEASE:
+    self->target = 0.0f;
+    length = self->fading ? ADSR_FADE_TIME : self->release;
+    ratio = ADSR_EXP_DECAY_RATIO;
+    break;
+  case ADSR_IDLE:
+    self->cur_amplitude = 0.0f;
+    // fall through
+  case ADSR_SUSTAIN:
+  default:
+    self->remaining = 0;
+    return;
+  }
+
+  self->remaining = (int32_t)(length * FRAME_RATE + 0.5f);
+  if(self->remaining <= 0) {
+    self->cur_amplitude = self->target;
+    segment_start(self, (segment == ADSR_RELEASE) ? ADSR_IDLE : segment + 1);
+    return;
+  }
+  float span = self->target - self->cur_amplitude;
+  self->seg_curve = self->curve;
+  if(self->seg_curve == ADSR_CURVE_EXP) {
+    // head for a point past the target so that after remaining frames of
+    // cur_amplitude = cur_amplitude*coef + base we are at the target.
+    float overshoot = self->target + ratio * span;
+    self->coef = expf(-logf((1.0f + ratio) / ratio) / self->remaining);
+    self->base = overshoot * (1.0f - self->coef);
+  } else {
+    self->inc = span / self->remaining;
   }
-  // time prior to startTime?
-  return 0;
 }
 
 // ======================================================================
-int8_t adsr_releasing(adsr_state_t *self, float time)
+int8_t adsr_active(adsr_state_t *self)
 {
-  return self->release_time > 0;
+  return self->segment != ADSR_IDLE;
 }
 
+// ======================================================================
+int8_t adsr_releasing(adsr_state_t *self)
+{
+  return self->release_frame >= 0;
+}
 
+// ======================================================================
+int8_t adsr_fading(adsr_state_t *self)
+{
+  return self->fading;
+}
@@ -5,6 +5,10 @@
 #include "biquad.h"
 #define _USE_MATH_DEFINES
 #include <math.h>
+#include <stdint.h>
+
+static void biquad_process_ramp(sf_biquad_state_st *state, int size, sf_sample_st *input,
+	sf_sample_st *output);
 
 // biquad filtering is based on a small sliding window, where the different filters are a result of
 // simply changing the coefficients used while processing the samples
@@ -16,6 +20,11 @@
 void sf_biquad_process(sf_biquad_state_st *state, int size, sf_sample_st *input,
 	sf_sample_st *output){
 
+	if (state->ramp){
+		biquad_process_ramp(state, size, input, output);
+		return;
+	}
+
 	// pull out the state into local variables
 	float b0 = state->b0;
 	float b1 = state->b1;
@@ -63,6 +72,174 @@ void sf_biquad_process(sf_biquad_state_st *state, int size, sf_sample_st *input,
 	state->yn2 = yn2;
 }
 
+// same as sf_biquad_process, but each coefficient moves a step towards its target every sample,
+// landing on the target at the end of the chunk
+static void biquad_process_ramp(sf_biquad_state_st *state, int size, sf_sample_st *input,
+	sf_sample_st *output){
+
+	if (size <= 0)
+		return;
+
+	// pull out the state into local variables
+	float b0 = state->b0;
+	float b1 = state->b1;
+	float b2 = state->b2;
+	float a1 = state->a1;
+	float a2 = state->a2;
+	float inv = 1.0f / size;
+	float db0 = (state->tb0 - b0) * inv;
+	float db1 = (state->tb1 - b1) * inv;
+	float db2 = (state->tb2 - b2) * inv;
+	float da1 = (state->ta1 - a1) * inv;
+	float da2 = (state->ta2 - a2) * inv;
+	sf_sample_st xn1 = state->xn1;
+	sf_sample_st xn2 = state->xn2;
+	sf_sample_st yn1 = state->yn1;
+	sf_sample_st yn2 = state->yn2;
+
+	// loop for each sample
+	for (int n = 0; n < size; n++){
+		// step the coefficients
+		b0 += db0;
+		b1 += db1;
+		b2 += db2;
+		a1 += da1;
+		a2 += da2;
+
+		// get the current sample
+		sf_sample_st xn0 = input[n];
+
+		// the formula is the same for each channel
+		float L =
+			b0 * xn0.L +
+			b1 * xn1.L +
+			b2 * xn2.L -
+			a1 * yn1.L -
+			a2 * yn2.L;
+		float R =
+			b0 * xn0.R +
+			b1 * xn1.R +
+			b2 * xn2.R -
+			a1 * yn1.R -
+			a2 * yn2.R;
+
+		// save the result
+		output[n] = (sf_sample_st){ L, R };
+
+		// slide everything down one sample
+		xn2 = xn1;
+		xn1 = xn0;
+		yn2 = yn1;
+		yn1 = output[n];
+	}
+
+	// save the state for future processing, the ramp is done
+	state->b0 = state->tb0;
+	state->b1 = state->tb1;
+	state->b2 = state->tb2;
+	state->a1 = state->ta1;
+	state->a2 = state->ta2;
+	state->ramp = false;
+	state->xn1 = xn1;
+	state->xn2 = xn2;
+	state->yn1 = yn1;
+	state->yn2 = yn2;
+}
+
+// set the coefficients of design as the target for state, keeping the history of state
+void sf_biquad_retune(sf_biquad_state_st *state, const sf_biquad_state_st *design){
+	state->tb0 = design->b0;
+	state->tb1 = design->b1;
+	state->tb2 = design->b2;
+	state->ta1 = design->a1;
+	state->ta2 = design->a2;
+	state->ramp = true;
+}
+
+void sf_biquad_cascade_init(sf_biquad_cascade_st *state, int stages){
+	if (stages < 1)
+		stages = 1;
+	else if (stages > SF_BIQUAD_CASCADE_MAX)
+		stages = SF_BIQUAD_CASCADE_MAX;
+	state->stages = stages;
+	for (int i = 0; i < SF_BIQUAD_CASCADE_MAX; i++){
+		state->stage[i] = (sf_biquad_stage_st){
+			1.0f, 0.0f, 0.0f, 0.0f, 0.0f, { 0, 0 }, { 0, 0 }
+		};
+	}
+}
+
+void sf_biquad_cascade_set(sf_biquad_cascade_st *state, int stage,
+	const sf_biquad_state_st *design){
+	if (stage < 0 || stage >= SF_BIQUAD_CASCADE_MAX)
+		return;
+	sf_biquad_stage_st *st = &state->stage[stage];
+	st->b0 = design->b0;
+	st->b1 = design->b1;
+	st->b2 = design->b2;
+	st->a1 = design->a1;
+	st->a2 = design->a2;
+}
+
+// transposed direct form II, for each stage and channel:
+//   y  = b0 * x + s1
+//   s1 = b1 * x - a1 * y + s2
+//   s2 = b2 * x - a2 * y
+// the output of each stage is the input of the next
+//
+// `stages` is a constant at each call below, so the compiler unrolls the stage loops and keeps the
+// coefficients and state in local variables
+static inline void cascade_run(sf_biquad_cascade_st *state, int size, sf_sample_st *input,
+	sf_sample_st *output, const int stages){
+
+	// pull out the state into local variables
+	float b0[SF_BIQUAD_CASCADE_MAX], b1[SF_BIQUAD_CASCADE_MAX], b2[SF_BIQUAD_CASCADE_MAX];
+	float a1[SF_BIQUAD_CASCADE_MAX], a2[SF_BIQUAD_CASCADE_MAX];
+	sf_sample_st s1[SF_BIQUAD_CASCADE_MAX], s2[SF_BIQUAD_CASCADE_MAX];
+	for (int k = 0; k < stages; k++){
+		b0[k] = state->stage[k].b0;
+		b1[k] = state->stage[k].b1;
+		b2[k] = state->stage[k].b2;
+		a1[k] = state->stage[k].a1;
+		a2[k] = state->stage[k].a2;
+		s1[k] = state->stage[k].s1;
+		s2[k] = state->stage[k].s2;
+	}
+
+	// loop for each sample
+	for (int n = 0; n < size; n++){
+		float L = input[n].L;
+		float R = input[n].R;
+		for (int k = 0; k < stages; k++){
+			float yL = b0[k] * L + s1[k].L;
+			float yR = b0[k] * R + s1[k].R;
+			s1[k].L = b1[k] * L - a1[k] * yL + s2[k].L;
+			s1[k].R = b1[k] * R - a1[k] * yR + s2[k].R;
+			s2[k].L = b2[k] * L - a2[k] * yL;
+			s2[k].R = b2[k] * R - a2[k] * yR;
+			L = yL;
+			R = yR;
+		}
+		output[n] = (sf_sample_st){ L, R };
+	}
+
+	// save the state for future processing
+	for (int k = 0; k < stages; k++){
+		state->stage[k].s1 = s1[k];
+		state->stage[k].s2 = s2[k];
+	}
+}
+
+void sf_biquad_cascade_process(sf_biquad_cascade_st *state, int size, sf_sample_st *input,
+	sf_sample_st *output){
+	switch (state->stages){
+		case 1: cascade_run(state, size, input, output, 1); break;
+		case 2: cascade_run(state, size, input, output, 2); break;
+		case 3: cascade_run(state, size, input, output, 3); break;
+		default: cascade_run(state, size, input, output, 4); break;
+	}
+}
+
 // each type of filter just has some magic math to setup the coefficients
 //
 // the math is quite complicated to understand, but the *implementation* is quite simple
@@ -80,6 +257,7 @@ static inline void state_reset(sf_biquad_state_st *state){
 	state->xn2 = (sf_sample_st){ 0, 0 };
 	state->yn1 = (sf_sample_st){ 0, 0 };
 	state->yn2 = (sf_sample_st){ 0, 0 };
+	state->ramp = false;
 }
 
 // set the coefficients so that the output is the input scaled by `amt`
@@ -313,3 +491,255 @@ void sf_highshelf(sf_biquad_state_st *state, int rate, float freq, float Q, floa
 	state->a1 = a0inv * 2.0f * (Am1 - Ap1 * k);
 	state->a2 = a0inv * (Ap1 - Am1 * k - k2);
 }
+
+// tables for sf_lowpass_fast
+//
+// the lowpass design only needs sin and cos of w0 / 2 (using the half angle forms below), and the
+// dB to linear conversion of the resonance.  both are smooth enough that linear interpolation in
+// a small table is accurate:
+//   sin/cos  the interpolation error of sin is proportional to sin itself, so low cutoffs are as
+//            accurate as high ones.  (1 - cos w0) is computed as 2 sin^2(w0 / 2) to avoid the
+//            cancellation near 0.
+//   dB       10^(-dB/20) is split into a power of two, built directly in the float's exponent, and
+//            a fraction looked up in a table of 2^(k/N)
+// the tables are sf_fast_sin and sf_fast_exp2 in biquad_tables.c
+
+// 2^x, for x well inside the range of a float
+static inline float fast_pow2(float x){
+	float fl = floorf(x);
+	float f = (x - fl) * FAST_EXP2_SIZE;
+	int i = (int)f;
+	f -= i;
+	float m = sf_fast_exp2[i] + f * (sf_fast_exp2[i + 1] - sf_fast_exp2[i]);
+	union { float f; uint32_t u; } e;
+	e.u = (uint32_t)((int)fl + 127) << 23;
+	return m * e.f;
+}
+
+void sf_lowpass_fast(sf_biquad_state_st *state, int rate, float cutoff, float resonance){
+	state_reset(state);
+	float nyquist = rate * 0.5f;
+	cutoff /= nyquist;
+
+	if (cutoff >= 1.0f)
+		state_passthrough(state);
+	else if (cutoff <= 0.0f)
+		state_zero(state);
+	else{
+		// w0 = 2 pi cutoff, so w0 / 2 = pi cutoff is cutoff / 2 of a table cycle
+		float f = cutoff * (FAST_SIN_SIZE / 2);
+		int i = (int)f;
+		f -= i;
+		int j = i + FAST_SIN_SIZE / 4;
+		float s = sf_fast_sin[i] + f * (sf_fast_sin[i + 1] - sf_fast_sin[i]); // sin(w0 / 2)
+		float c = sf_fast_sin[j] + f * (sf_fast_sin[j + 1] - sf_fast_sin[j]); // cos(w0 / 2)
+
+		if (resonance < -600.0f) // keep the power of two in range
+			resonance = -600.0f;
+		else if (resonance > 600.0f)
+			resonance = 600.0f;
+		// 1 / resonance converted from dB to linear, log2(10) / 20 = 0.1660964
+		float rinv = fast_pow2(resonance * -0.1660964f);
+
+		float alpha = s * c * rinv;       // sin(w0) / (2 resonance)
+		float beta  = s * s;              // (1 - cos(w0)) / 2
+		float cosw  = 1.0f - 2.0f * beta; // cos(w0)
+		float a0inv = 1.0f / (1.0f + alpha);
+		state->b0 = a0inv * beta;
+		state->b1 = a0inv * 2.0f * beta;
+		state->b2 = a0inv * beta;
+		state->a1 = a0inv * -2.0f * cosw;
+		state->a2 = a0inv * (1.0f - alpha);
+	}
+}
+
+// fixed point biquad
+#define FIXED_COEF_BITS   30 // Q2.30, or fewer fraction bits when a coefficient doesn't fit
+#define FIXED_SAMPLE_BITS 27 // Q5.27
+#define FIXED_SAMPLE_MAX  15.999f
+
+// the most fraction bits (up to FIXED_COEF_BITS) an int32 can hold c with
+static inline int coef_bits(float c){
+	float m = fabsf(c);
+	int bits = FIXED_COEF_BITS;
+	while (bits > 0 && m >= (float)(1u << (31 - bits)))
+		bits--;
+	return bits;
+}
+
+// the most fraction bits (up to FIXED_COEF_BITS) x, which has bits now, can be moved to
+static inline int fixed_bits(int32_t x, int bits){
+	uint32_t m = (x < 0) ? (uint32_t)(-(int64_t)x) : (uint32_t)x;
+	while (bits < FIXED_COEF_BITS && m < 0x40000000u){
+		m <<= 1;
+		bits++;
+	}
+	return bits;
+}
+
+static inline int32_t coef_to_fixed(float c, int bits){
+	float v = ldexpf(c, bits);
+	if (v >= 2147483647.0f)
+		return INT32_MAX;
+	if (v <= -2147483648.0f)
+		return INT32_MIN;
+	return (int32_t)lrintf(v);
+}
+
+// x with from fraction bits, rounded to to fraction bits
+static inline int32_t coef_rescale(int32_t x, int from, int to){
+	if (to >= from)
+		return x * (1 << (to - from));
+	int d = from - to;
+	return (int32_t)(((int64_t)x + (1 << (d - 1))) >> d);
+}
+
+static inline int32_t sample_to_fixed(float x){
+	x = (x > FIXED_SAMPLE_MAX) ? FIXED_SAMPLE_MAX : (x < -FIXED_SAMPLE_MAX) ? -FIXED_SAMPLE_MAX : x;
+	return (int32_t)(x * (float)(1 << FIXED_SAMPLE_BITS));
+}
+
+static inline float fixed_to_sample(int32_t x){
+	return (float)x * (1.0f / (float)(1 << FIXED_SAMPLE_BITS));
+}
+
+// round the sum (27 + bits fraction bits) back to a saturated Q5.27 sample
+static inline int32_t acc_to_fixed(int64_t acc, int bits){
+	acc = (acc + (((int64_t)1 << bits) >> 1)) >> bits;
+	if (acc > INT32_MAX)
+		return INT32_MAX;
+	if (acc < INT32_MIN)
+		return INT32_MIN;
+	return (int32_t)acc;
+}
+
+void sf_biquad_fixed_init(sf_biquad_fixed_st *state, const sf_biquad_state_st *design){
+	for (int c = 0; c < 2; c++){
+		state->xn1[c] = 0;
+		state->xn2[c] = 0;
+		state->yn1[c] = 0;
+		state->yn2[c] = 0;
+	}
+	state->b0 = state->b1 = state->b2 = state->na1 = state->na2 = 0;
+	state->bits = FIXED_COEF_BITS;
+	sf_biquad_fixed_retune(state, design);
+	state->b0 = state->tb0;
+	state->b1 = state->tb1;
+	state->b2 = state->tb2;
+	state->na1 = state->tna1;
+	state->na2 = state->tna2;
+	state->ramp = false;
+}
+
+void sf_biquad_fixed_retune(sf_biquad_fixed_st *state, const sf_biquad_state_st *design){
+	// the fewest fraction bits either the design or the current coefficients need, so the
+	// ramp between them runs in one format
+	int bits = state->bits;
+	int32_t *cur[5] = { &state->b0, &state->b1, &state->b2, &state->na1, &state->na2 };
+	int cur_bits = FIXED_COEF_BITS;
+	for (int i = 0; i < 5; i++){
+		int b = fixed_bits(*cur[i], bits);
+		cur_bits = (b < cur_bits) ? b : cur_bits;
+	}
+	float c[5] = { design->b0, design->b1, design->b2, -design->a1, -design->a2 };
+	int new_bits = cur_bits;
+	for (int i = 0; i < 5; i++){
+		int b = coef_bits(c[i]);
+		new_bits = (b < new_bits) ? b : new_bits;
+	}
+	for (int i = 0; i < 5; i++)
+		*cur[i] = coef_rescale(*cur[i], bits, new_bits);
+	state->bits = new_bits;
+	state->tb0 = coef_to_fixed(c[0], new_bits);
+	state->tb1 = coef_to_fixed(c[1], new_bits);
+	state->tb2 = coef_to_fixed(c[2], new_bits);
+	state->tna1 = coef_to_fixed(c[3], new_bits);
+	state->tna2 = coef_to_fixed(c[4], new_bits);
+	state->ramp = true;
+}
+
+void sf_biquad_fixed_process(sf_biquad_fixed_st *state, int size, sf_sample_st *input,
+	sf_sample_st *output){
+
+	if (size <= 0)
+		return;
+
+	// a retune is spread evenly over this chunk.  the last step is adjusted below so the
+	// coefficients land exactly on the target
+	int32_t db0 = 0, db1 = 0, db2 = 0, dna1 = 0, dna2 = 0;
+	if (state->ramp){
+		db0 = (int32_t)(((int64_t)state->tb0 - state->b0) / size);
+		db1 = (int32_t)(((int64_t)state->tb1 - state->b1) / size);
+		db2 = (int32_t)(((int64_t)state->tb2 - state->b2) / size);
+		dna1 = (int32_t)(((int64_t)state->tna1 - state->na1) / size);
+		dna2 = (int32_t)(((int64_t)state->tna2 - state->na2) / size);
+	}
+
+	// pull out the state into local variables
+	int32_t b0 = state->b0;
+	int32_t b1 = state->b1;
+	int32_t b2 = state->b2;
+	int32_t na1 = state->na1;
+	int32_t na2 = state->na2;
+	int bits = state->bits;
+	int32_t xn1L = state->xn1[0], xn1R = state->xn1[1];
+	int32_t xn2L = state->xn2[0], xn2R = state->xn2[1];
+	int32_t yn1L = state->yn1[0], yn1R = state->yn1[1];
+	int32_t yn2L = state->yn2[0], yn2R = state->yn2[1];
+
+	// loop for each sample
+	for (int n = 0; n < size; n++){
+		b0 += db0;
+		b1 += db1;
+		b2 += db2;
+		na1 += dna1;
+		na2 += dna2;
+
+		int32_t xn0L = sample_to_fixed(input[n].L);
+		int32_t xn0R = sample_to_fixed(input[n].R);
+
+		int64_t accL = (int64_t)b0 * xn0L;
+		accL += (int64_t)b1 * xn1L;
+		accL += (int64_t)b2 * xn2L;
+		accL += (int64_t)na1 * yn1L;
+		accL += (int64_t)na2 * yn2L;
+		int64_t accR = (int64_t)b0 * xn0R;
+		accR += (int64_t)b1 * xn1R;
+		accR += (int64_t)b2 * xn2R;
+		accR += (int64_t)na1 * yn1R;
+		accR += (int64_t)na2 * yn2R;
+		int32_t L = acc_to_fixed(accL, bits);
+		int32_t R = acc_to_fixed(accR, bits);
+
+		output[n] = (sf_sample_st){ fixed_to_sample(L), fixed_to_sample(R) };
+
+		// slide everything down one sample
+		xn2L = xn1L;
+		xn2R = xn1R;
+		xn1L = xn0L;
+		xn1R = xn0R;
+		yn2L = yn1L;
+		yn2R = yn1R;
+		yn1L = L;
+		yn1R = R;
+	}
+
+	// save the state for future processing
+	if (state->ramp){
+		b0 = state->tb0;
+		b1 = state->tb1;
+		b2 = state->tb2;
+		na1 = state->tna1;
+		na2 = state->tna2;
+		state->ramp = false;
+	}
+	state->b0 = b0;
+	state->b1 = b1;
+	state->b2 = b2;
+	state->na1 = na1;
+	state->na2 = na2;
+	state->xn1[0] = xn1L; state->xn1[1] = xn1R;
+	state->xn2[0] = xn2L; state->xn2[1] = xn2R;
+	state->yn1[0] = yn1L; state->yn1[1] = yn1R;
+	state->yn2[0] = yn2L; state->yn2[1] = yn2R;
+}
@@ -0,0 +1,90 @@
+/*
+ * eq.c
+ *
+ *  Created on: Oct 17, 2026
+ *      Author: agent
+ */
+
+#include "eq.h"
+#include "synthutil.h"
+#include <math.h>
+
+// Q of the peaking bands & the shelves
+#define EQ_PEAK_Q  1.0f
+#define EQ_SHELF_Q 0.7071f
+
+// the sndfilter designs use w0 = 2*pi*freq/nyquist, which puts every
+// band an octave high.  designing at twice the rate puts them where
+// they are set.
+#define EQ_DESIGN_RATE (2 * FRAME_RATE)
+
+// ======================================================================
+void eq_init(eq_state_t *self)
+{
+  static const float default_freq[EQ_BANDS] = { 100.0f, 500.0f, 2000.0f, 8000.0f };
+  for(int b = 0; b < EQ_BANDS; b++) {
+    eq_set_band(self, b, default_freq[b], 0.0f);
+    self->stage[b] = -1;
+  }
+  sf_biquad_cascade_init(&(self->cascade), 1);
+  self->stages = 0;
+}
+
+// ======================================================================
+// compute the coefficients for one band.  this is the slow part, call
+// eq_update afterwards to put the change into the cascade.
+void eq_set_band(eq_state_t *self, uint8_t band, float freq, float gain)
+{
+  if(band >= EQ_BANDS) {
+    return;
+  }
+  self->freq[band] = freq;
+  self->gain[band] = gain;
+  switch(band) {
+  case EQ_LOWSHELF:
+    sf_lowshelf(&(self->design[band]), EQ_DESIGN_RATE, freq, EQ_SHELF_Q, gain);
+    break;
+  case EQ_HIGHSHELF:
+    sf_highshelf(&(self->design[band]), EQ_DESIGN_RATE, freq, EQ_SHELF_Q, gain);
+    break;
+  default:
+    sf_peaking(&(self->design[band]), EQ_DESIGN_RATE, freq, EQ_PEAK_Q, gain);
+    break;
+  }
+}
+
+// ======================================================================
+// rebuild the cascade from the bands that are not flat.  bands that
+// were already running keep their history.
+void eq_update(eq_state_t *self)
+{
+  sf_biquad_cascade_st old = self->cascade;
+  int stages = 0;
+  for(int b = 0; b < EQ_BANDS; b++) {
+    if(fabsf(self->gain[b]) < EQ_FLAT_DB) {
+      self->stage[b] = -1;
+      continue;
+    }
+    sf_biquad_stage_st *st = &(self->cascade.stage[stages]);
+    if(self->stage[b] >= 0) {
+      *st = old.stage[self->stage[b]];
+    } else {
+      st->s1 = (sf_sample_st){ 0, 0 };
+      st->s2 = (sf_sample_st){ 0, 0 };
+    }
+    sf_biquad_cascade_set(&(self->cascade), stages, &(self->design[b]));
+    self->stage[b] = stages++;
+  }
+  self->cascade.stages = (stages > 0) ? stages : 1;
+  self->stages = stages;
+}
+
+// ======================================================================
+// inout_samples are stereo.  does nothing when every band is flat.
+void eq_process(eq_state_t *self, float *inout_samples, int frame_count)
+{
+  if(self->stages == 0) {
+    return;
+  }
+  sf_biquad_cascade_process(&(self->cascade), frame_count, (sf_sample_st *)inout_samples, (sf_sample_st *)inout_samples);
+}
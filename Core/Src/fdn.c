@@ -0,0 +1,211 @@
+/*
+ * fdn.c
+ *
+ *  Created on: Oct 17, 2026
+ *      Author: agent
+ */
+
+#include "fdn.h"
+#include "synthutil.h"
+#include <math.h>
+#include <string.h>
+
+void fdn_reset(fdn_state_t *self);
+void fdn_block(fdn_state_t *self, float *in_samples, float *out_samples, int frame_count);
+
+#define FDN_TWO_PI (2.0f * (float)M_PI)
+
+static const int fdn_frames[FDN_LINES] = { 1031, 1327, 1523, 1783, 1999, 2237, 2477, 2693 };
+// length wobble rate of each line in Hz, none in step with another
+static const float fdn_lfo_hz[FDN_LINES] = { 0.31f, 0.43f, 0.53f, 0.61f, 0.71f, 0.79f, 0.89f, 0.97f };
+// input sign for each line, so the lines don't all start out the same
+static const float fdn_in_sign[FDN_LINES] = { 1, -1, 1, -1, -1, 1, -1, 1 };
+
+// ======================================================================
+// the ring is reverb.c's, which clears it in reverb_init.  this leaves
+// it alone, call fdn_clear before running on a ring reverb.c has used.
+void fdn_init(fdn_state_t *self, reverb_ring_t *ring, float wet)
+{
+  self->ring = ring;
+  reverb_wet_init(&(self->wet), wet);
+  self->room = 0.5f;
+  self->damp = 0.5f;
+  int offset = 0;
+  for(int i = 0; i < FDN_LINES; i++) {
+    offset += fdn_frames[i] + FDN_MOD_DEPTH + REVERB_LINE_PAD;
+    self->offset[i] = offset;
+  }
+  fdn_reset(self);
+  fdn_set_room(self, self->room);
+  fdn_set_damp(self, self->damp);
+}
+
+// ======================================================================
+// silence the lines, e.g. after reverb.c has been using the ring.  call
+// it with the audio interrupt off.
+void fdn_clear(fdn_state_t *self)
+{
+  memset(self->ring, 0, sizeof(reverb_ring_t));
+  fdn_reset(self);
+}
+
+// ======================================================================
+// start the lines over, at their own lengths & with nothing in them
+void fdn_reset(fdn_state_t *self)
+{
+  self->pos = 0;
+  // nothing in the lines yet
+  self->quiet_frames = REVERB_IDLE_FRAMES;
+  for(int i = 0; i < FDN_LINES; i++) {
+    self->store[i] = 0.0f;
+    self->delay[i] = fdn_frames[i];
+    self->lfo_phase[i] = 0.0f;
+  }
+}
+
+// ======================================================================
+// change wet without a click.  it ramps over REVERB_WET_RAMP_FRAMES.
+// call it with the audio interrupt off.
+void fdn_set_wet(fdn_state_t *self, float wet)
+{
+  reverb_wet_set(&(self->wet), wet);
+}
+
+// ======================================================================
+// room 0..1 sets the decay time.  each line loses 60 dB in the decay
+// time, whatever its length.
+void fdn_set_room(fdn_state_t *self, float room)
+{
+  self->room = room;
+  float t60 = FDN_T60_MIN + (FDN_T60_MAX - FDN_T60_MIN) * room;
+  for(int i = 0; i < FDN_LINES; i++) {
+    self->gain[i] = powf(10.0f, -3.0f * fdn_frames[i] / (t60 * FRAME_RATE)) * (1.0f / sqrtf(FDN_LINES));
+  }
+}
+
+// ======================================================================
+// damp 0..1.  a longer line's lowpass is stronger, so the highs decay
+// at about the same rate in every line.
+void fdn_set_damp(fdn_state_t *self, float damp)
+{
+  self->damp = damp;
+  for(int i = 0; i < FDN_LINES; i++) {
+    self->damp1[i] = FDN_DAMP_SCALE * damp * fdn_frames[i] / fdn_frames[FDN_LINES - 1];
+  }
+}
+
+// ======================================================================
+void fdn_get_samples(fdn_state_t *self, float *in_samples, float *out_samples, int frame_count)
+{
+  // the lines only have room for REVERB_BLOCK_FRAMES at a time
+  while(frame_count > 0) {
+    int n = (frame_count < REVERB_BLOCK_FRAMES) ? frame_count : REVERB_BLOCK_FRAMES;
+    fdn_block(self, in_samples, out_samples, n);
+    in_samples += 2*n;
+    out_samples += 2*n;
+    frame_count -= n;
+  }
+}
+
+// ======================================================================
+void fdn_block(fdn_state_t *self, float *in_samples, float *out_samples, int frame_count)
+{
+  float wet_inc;
+  float wet = reverb_wet_block(&(self->wet), frame_count, &wet_inc);
+
+  // skip the lines while they are silent & so is the input.  the output
+  // is the dry mix the lines would have given, so nothing jumps when they
+  // start up again (from where they stopped).
+  float in_peak = reverb_peak(in_samples, 2*frame_count);
+  if(reverb_idle(self->quiet_frames, in_peak)) {
+    for(int frame = 0; frame < frame_count; frame++) {
+      wet += wet_inc;
+      out_samples[2*frame] = (1.0f-wet)*in_samples[2*frame];
+      out_samples[2*frame+1] = (1.0f-wet)*in_samples[2*frame+1];
+    }
+    return;
+  }
+
+  float *in = &(self->in[0]);
+  for(int frame = 0; frame < frame_count; frame++) {
+    in[frame] = (0.5f*FDN_GAIN)*(in_samples[2*frame] + in_samples[2*frame+1]);
+  }
+
+  // read the block from each line, moving its length to where its lfo
+  // will be at the end of the block.
+  reverb_sample_t *buf = &(self->ring->buf[0][0]);
+  for(int i = 0; i < FDN_LINES; i++) {
+    float *x = &(self->x[i][0]);
+    self->lfo_phase[i] += FDN_TWO_PI * fdn_lfo_hz[i] * frame_count / FRAME_RATE;
+    if(self->lfo_phase[i] > FDN_TWO_PI) {
+      self->lfo_phase[i] -= FDN_TWO_PI;
+    }
+    float target = fdn_frames[i] + (0.5f*FDN_MOD_DEPTH) * (1.0f - cosf(self->lfo_phase[i]));
+    float delay = self->delay[i];
+    float delay_inc = (target - delay) / frame_count;
+    uint32_t w = self->pos + self->offset[i];
+    for(int frame = 0; frame < frame_count; frame++) {
+      int d = (int)delay;
+      float frac = delay - d;
+      float d0 = reverb_load(buf[(w - d) & REVERB_BUF_MASK]);
+      float d1 = reverb_load(buf[(w - d - 1) & REVERB_BUF_MASK]);
+      x[frame] = d0 + (d1 - d0) * frac;
+      w++;
+      delay += delay_inc;
+    }
+    self->delay[i] = target;
+  }
+
+  // then a frame at a time for all 8 lines together: damp, tap the
+  // output, mix through the matrix & write back.  the 8 lowpasses are
+  // independent so they don't wait on each other.
+  float store[FDN_LINES], damp1[FDN_LINES], damp2[FDN_LINES], gain[FDN_LINES];
+  uint32_t w[FDN_LINES];
+  float out_peak = 0.0f;
+  for(int i = 0; i < FDN_LINES; i++) {
+    store[i] = self->store[i];
+    damp1[i] = self->damp1[i];
+    damp2[i] = 1.0f - damp1[i];
+    gain[i] = self->gain[i];
+    w[i] = self->pos + self->offset[i];
+  }
+  for(int frame = 0; frame < frame_count; frame++) {
+    float v[FDN_LINES];
+    for(int i = 0; i < FDN_LINES; i++) {
+      store[i] = self->x[i][frame]*damp2[i] + store[i]*damp1[i];
+      v[i] = store[i]*gain[i];
+    }
+
+    // even lines -> left, odd -> right
+    wet += wet_inc;
+    float left = v[0] + v[2] + v[4] + v[6];
+    float right = v[1] + v[3] + v[5] + v[7];
+    float peak = (fabsf(right) > fabsf(left)) ? fabsf(right) : fabsf(left);
+    out_peak = (peak > out_peak) ? peak : out_peak;
+    out_samples[2*frame] = (1.0f-wet)*in_samples[2*frame] + wet*left;
+    out_samples[2*frame+1] = (1.0f-wet)*in_samples[2*frame+1] + wet*right;
+
+    // Hadamard matrix as 3 rounds of butterflies
+    for(int h = 1; h < FDN_LINES; h <<= 1) {
+      for(int i = 0; i < FDN_LINES; i += 2*h) {
+        for(int j = i; j < i + h; j++) {
+          float sum = v[j] + v[j + h];
+          float diff = v[j] - v[j + h];
+          v[j] = sum;
+          v[j + h] = diff;
+        }
+      }
+    }
+
+    // add the input & write back into each line
+    for(int i = 0; i < FDN_LINES; i++) {
+      buf[(w[i] + frame) & REVERB_BUF_MASK] = reverb_store(v[i] + fdn_in_sign[i]*in[frame]);
+    }
+  }
+  for(int i = 0; i < FDN_LINES; i++) {
+    self->store[i] = store[i];
+  }
+
+  self->pos += frame_count;
+  self->quiet_frames = reverb_quiet_frames(self->quiet_frames, in_peak, out_peak, frame_count);
+}
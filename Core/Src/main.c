@@ -500,19 +500,43 @@ void update_state(void)
     HAL_GPIO_WritePin(LED_Port, ORANGE_LED, GPIO_PIN_SET);
     synth_all_notes_off();
 
+    synth_print_stats();
+    synth_reset_stats();
     printf("begin edit mode\r\n");
     printf("{\r\n");
     printf("  wave      = %d\r\n", the_synth.wave);
     printf("  voices    = %d\r\n", the_synth.voices);
+    printf("  steal     = %d\r\n", the_synth.steal);
     printf("  attack    = %.0f\r\n", 1000*the_synth.attack);
     printf("  decay     = %.0f\r\n", 1000*the_synth.decay);
     printf("  sustain   = %.0f\r\n", 1000*the_synth.sustain);
     printf("  release   = %.0f\r\n", 1000*the_synth.release);
     printf("  scale     = %.0f\r\n", 1000*the_synth.scale);
+    printf("  curve     = %d\r\n", the_synth.curve);
+    printf("  filter    = %d\r\n", the_synth.filter);
+    printf("  fcutoff   = %.0f\r\n", the_synth.fcutoff);
+    printf("  fresonance = %.0f\r\n", the_synth.fresonance);
+    printf("  fenv      = %.0f\r\n", 1000*the_synth.fenv);
+    printf("  fvelocity = %.0f\r\n", 1000*the_synth.fvelocity);
+    printf("  fattack   = %.0f\r\n", 1000*the_synth.fattack);
+    printf("  fdecay    = %.0f\r\n", 1000*the_synth.fdecay);
+    printf("  fsustain  = %.0f\r\n", 1000*the_synth.fsustain);
+    printf("  frelease  = %.0f\r\n", 1000*the_synth.frelease);
+    printf("  rlpf      = %d\r\n", the_synth.enable_rlpf);
+    printf("  type      = %d\r\n", the_synth.type);
     printf("  cutoff    = %.0f\r\n", the_synth.cutoff);
     printf("  resonance = %.0f\r\n", the_synth.resonance);
+    printf("  gain      = %.0f\r\n", the_synth.gain);
+    printf("  svf       = %d\r\n", the_synth.svf);
+    for(int b = 0; b < EQ_BANDS; b++) {
+      printf("  eq%dfreq   = %.0f\r\n", b, the_synth.eq_freq[b]);
+      printf("  eq%dgain   = %.0f\r\n", b, 10*the_synth.eq_gain[b]);
+    }
     printf("  wet       = %.0f\r\n", 1000*the_synth.wet);
     printf("  delay     = %.0f\r\n", 1000*the_synth.delay);
+    printf("  verb      = %d\r\n", the_synth.verb);
+    printf("  room      = %.0f\r\n", 1000*the_synth.room);
+    printf("  damp      = %.0f\r\n", 1000*the_synth.damp);
     printf("}\r\n");
 
     printf("Enter 'variable value' (e.g. 'attack 500').\r\nEnd edit mode with '.' \r\n");
@@ -531,6 +555,8 @@ void update_state(void)
           set_wave(v);
         } else if (strncmp(&(cmd[0]), "voices", 4) == 0) {
           set_voices(v);
+        } else if (strncmp(&(cmd[0]), "steal", 4) == 0) {
+          set_steal(v);
         } else if (strncmp(&(cmd[0]), "attack", 4) == 0) {
           set_attack(v/1000.0);
         } else if (strncmp(&(cmd[0]), "decay", 4) == 0) {
@@ -541,14 +567,52 @@ void update_state(void)
           set_release(v/1000.0);
         } else if (strncmp(&(cmd[0]), "scale", 4) == 0) {
           set_scale(v/1000.0);
+        } else if (strncmp(&(cmd[0]), "curve", 4) == 0) {
+          set_curve(v);
+        } else if (strncmp(&(cmd[0]), "filter", 4) == 0) {
+          set_filter(v);
+        } else if (strncmp(&(cmd[0]), "fcutoff", 4) == 0) {
+          set_fcutoff(v);
+        } else if (strncmp(&(cmd[0]), "fresonance", 4) == 0) {
+          set_fresonance(v);
+        } else if (strncmp(&(cmd[0]), "fenv", 4) == 0) {
+          set_fenv(v/1000.0);
+        } else if (strncmp(&(cmd[0]), "fvelocity", 4) == 0) {
+          set_fvelocity(v/1000.0);
+        } else if (strncmp(&(cmd[0]), "fattack", 4) == 0) {
+          set_fattack(v/1000.0);
+        } else if (strncmp(&(cmd[0]), "fdecay", 4) == 0) {
+          set_fdecay(v/1000.0);
+        } else if (strncmp(&(cmd[0]), "fsustain", 4) == 0) {
+          set_fsustain(v/1000.0);
+        } else if (strncmp(&(cmd[0]), "frelease", 4) == 0) {
+          set_frelease(v/1000.0);
+        } else if (strncmp(&(cmd[0]), "rlpf", 4) == 0) {
+          set_rlpf(v);
+        } else if (strncmp(&(cmd[0]), "type", 4) == 0) {
+          set_type(v);
         } else if (strncmp(&(cmd[0]), "cutoff", 4) == 0) {
           set_cutoff(v);
         } else if (strncmp(&(cmd[0]), "resonance", 4) == 0) {
           set_resonance(v);
+        } else if (strncmp(&(cmd[0]), "gain", 4) == 0) {
+          set_gain(v);
+        } else if (strncmp(&(cmd[0]), "svf", 3) == 0) {
+          set_svf(v);
+        } else if ((strncmp(&(cmd[0]), "eq", 2) == 0) && (cmd[3] == 'f')) {
+          set_eq_freq(cmd[2] - '0', v);
+        } else if ((strncmp(&(cmd[0]), "eq", 2) == 0) && (cmd[3] == 'g')) {
+          set_eq_gain(cmd[2] - '0', v/10.0);
         } else if (strncmp(&(cmd[0]), "wet", 3) == 0) {
           set_wet(v/1000.0);
         } else if (strncmp(&(cmd[0]), "delay", 4) == 0) {
           set_delay(v/1000.0);
+        } else if (strncmp(&(cmd[0]), "verb", 4) == 0) {
+          set_verb(v);
+        } else if (strncmp(&(cmd[0]), "room", 4) == 0) {
+          set_room(v/1000.0);
+        } else if (strncmp(&(cmd[0]), "damp", 4) == 0) {
+          set_damp(v/1000.0);
         } else {
           printf("unknown cmd: %s %d\r\n", cmd, v);
         }
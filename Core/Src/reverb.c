@@ -11,83 +11,417 @@
 #include "reverb.h"
 #include "string.h"
 
-float comb_filter(float *buf, int *idx, float gain, int lim, float v);
-float allpass_filter(float *buf, int *idx, float gain, int lim, float v);
+void reverb_layout(reverb_state_t *self);
+void line_init(reverb_line_t *line, reverb_sample_t *buf, int offset, int max_delay, float gain);
+void line_set_target(reverb_line_t *line, int target);
+void line_begin_block(reverb_line_t *line, int frame_count);
+void comb_filter(reverb_state_t *self, reverb_line_t *line, float *in, float *inout, int frame_count);
+void allpass_filter(reverb_state_t *self, reverb_line_t *line, float *inout, int frame_count);
+void damped_comb_filter(reverb_state_t *self, reverb_line_t *line, float *in, float *inout, int frame_count);
+void damped_comb_bank(reverb_state_t *self, float *in, float *out, int frame_count);
+void freeverb_allpass_filter(reverb_state_t *self, reverb_line_t *line, float *inout, int frame_count);
+void reverb_block(reverb_state_t *self, float *in_samples, float *out_samples, int frame_count);
+void reverb_lines(reverb_state_t *self, float *in_samples, int frame_count);
+
+// base delays in frames for delay scale 1.0 for each algorithm & side.
+// the schroeder right side (only with REVERB_Q15) is a bit shorter &
+// doesn't line up with the left.  freeverb's sides share the left combs
+// & its right allpasses are FREEVERB_SPREAD longer.
+static const int comb_frames[2][REVERB_CHANNELS][NUM_COMBS] = {
+    { { 1730, 1494, 1941, 2156 }, { 1707, 1471, 1918, 2133 } },
+    { { 1215, 1390, 1548, 1695 }, { 0 } },
+};
+static const int allp_frames[2][REVERB_CHANNELS][NUM_ALLPS] = {
+    { { 240, 81, 23 }, { 227, 74, 19 } },
+    { { 605, 371, 245 }, { 630, 396, 270 } },
+};
+// longest delay scale for each algorithm
+static const int max_delay_scale[2] = { MAX_DELAY, 1 };
+static const float comb_gains[NUM_COMBS] = { 0.805, 0.827, 0.783, 0.764 };
+static const float allp_gains[NUM_ALLPS] = { 0.7, 0.7, 0.7 };
+
+// ======================================================================
+// the reverb owns the ring (fdn.c borrows it), so this clears it.  an
+// algorithm it doesn't run (REVERB_FDN) starts the schroeder.
+void reverb_init(reverb_state_t *self, reverb_ring_t *ring, int algorithm, float wet, float delay)
+{
+  self->ring = ring;
+  reverb_wet_init(&(self->wet), wet);
+  self->delay = delay;
+  self->algorithm = (algorithm == REVERB_FREEVERB) ? REVERB_FREEVERB : REVERB_SCHROEDER;
+  self->room = 0.5f;
+  self->damp = 0.5f;
+  reverb_layout(self);
+}
+
+// ======================================================================
+// switch (or restart) algorithm.  the lines move, so this clears the
+// ring & the tail is lost.  call it with the audio interrupt off.
+void reverb_set_algorithm(reverb_state_t *self, int algorithm)
+{
+  if((algorithm != REVERB_SCHROEDER) && (algorithm != REVERB_FREEVERB)) {
+    return;
+  }
+  self->algorithm = algorithm;
+  reverb_layout(self);
+}
+
+// ======================================================================
+// lay the slices out one after the other.  each side uses its own ring
+// if there are REVERB_TANKS for it, otherwise they follow each other.
+void reverb_layout(reverb_state_t *self)
+{
+  int alg = self->algorithm;
+  self->channels = (alg == REVERB_FREEVERB) ? REVERB_CHANNELS : REVERB_TANKS;
+  self->banks = (alg == REVERB_FREEVERB) ? 1 : self->channels;
+  self->pos = 0;
+  memset(self->ring, 0, sizeof(reverb_ring_t));
+  // nothing in the lines yet
+  self->quiet_frames = REVERB_IDLE_FRAMES;
+  int offset = 0;
+  for(int c = 0; c < self->channels; c++) {
+    int t = (c < REVERB_TANKS) ? c : REVERB_TANKS - 1;
+    if(t == c) {
+      offset = 0;
+    }
+    reverb_sample_t *buf = &(self->ring->buf[t][0]);
+    for(int i = 0; (c < self->banks) && (i < NUM_COMBS); i++) {
+      int max_delay = comb_frames[alg][c][i]*max_delay_scale[alg];
+      offset += max_delay + REVERB_LINE_PAD;
+      line_init(&(self->comb[c][i]), buf, offset, max_delay, comb_gains[i]);
+    }
+    for(int i = 0; i < NUM_ALLPS; i++) {
+      int max_delay = allp_frames[alg][c][i]*max_delay_scale[alg];
+      offset += max_delay + REVERB_LINE_PAD;
+      line_init(&(self->allp[c][i]), buf, offset, max_delay,
+                (alg == REVERB_FREEVERB) ? FREEVERB_ALLP_GAIN : allp_gains[i]);
+    }
+  }
+  reverb_set_room(self, self->room);
+  reverb_set_delay(self, self->delay);
+  // start at the delay instead of moving to it
+  for(int c = 0; c < self->channels; c++) {
+    for(int i = 0; (c < self->banks) && (i < NUM_COMBS); i++) {
+      self->comb[c][i].delay = self->comb[c][i].target;
+    }
+    for(int i = 0; i < NUM_ALLPS; i++) {
+      self->allp[c][i].delay = self->allp[c][i].target;
+    }
+  }
+}
+
+// ======================================================================
+// change wet without a click.  it ramps over REVERB_WET_RAMP_FRAMES.
+// call it with the audio interrupt off.
+void reverb_set_wet(reverb_state_t *self, float wet)
+{
+  reverb_wet_set(&(self->wet), wet);
+}
 
 // ======================================================================
-void reverb_init(reverb_state_t *self, float wet, float delay)
+// change the delay scale (up to MAX_DELAY) keeping the reverb tail.
+// each read position moves to its new delay at REVERB_DELAY_SLEW.
+void reverb_set_delay(reverb_state_t *self, float delay)
 {
-  self->wet = wet;
+  int alg = self->algorithm;
   self->delay = delay;
-  self->comb0_lim = delay/MAX_DELAY * COMB0_LEN;
-  self->comb1_lim = delay/MAX_DELAY * COMB1_LEN;
-  self->comb2_lim = delay/MAX_DELAY * COMB2_LEN;
-  self->comb3_lim = delay/MAX_DELAY * COMB3_LEN;
-  self->allp0_lim = delay/MAX_DELAY * ALLP0_LEN;
-  self->allp1_lim = delay/MAX_DELAY * ALLP1_LEN;
-  self->allp2_lim = delay/MAX_DELAY * ALLP2_LEN;
-  self->comb0_idx = 0;
-  self->comb1_idx = 0;
-  self->comb2_idx = 0;
-  self->comb3_idx = 0;
-  self->allp0_idx = 0;
-  self->allp1_idx = 0;
-  self->allp2_idx = 0;
-  memset(&(self->comb0[0]), 0, sizeof(float)*COMB0_LEN);
-  memset(&(self->comb1[0]), 0, sizeof(float)*COMB1_LEN);
-  memset(&(self->comb2[0]), 0, sizeof(float)*COMB2_LEN);
-  memset(&(self->comb3[0]), 0, sizeof(float)*COMB3_LEN);
-  memset(&(self->allp0[0]), 0, sizeof(float)*ALLP0_LEN);
-  memset(&(self->allp1[0]), 0, sizeof(float)*ALLP1_LEN);
-  memset(&(self->allp2[0]), 0, sizeof(float)*ALLP2_LEN);
-  self->comb0_gain = 0.805;
-  self->comb1_gain = 0.827;
-  self->comb2_gain = 0.783;
-  self->comb3_gain = 0.764;
-  self->allp0_gain = 0.7;
-  self->allp1_gain = 0.7;
-  self->allp2_gain = 0.7;
+  for(int c = 0; c < self->channels; c++) {
+    for(int i = 0; (c < self->banks) && (i < NUM_COMBS); i++) {
+      line_set_target(&(self->comb[c][i]), (int)(delay * comb_frames[alg][c][i]));
+    }
+    for(int i = 0; i < NUM_ALLPS; i++) {
+      line_set_target(&(self->allp[c][i]), (int)(delay * allp_frames[alg][c][i]));
+    }
+  }
+}
+
+// ======================================================================
+// freeverb room size 0..1 sets how long the tail is.  it sets the
+// freeverb combs' feedback gain.
+void reverb_set_room(reverb_state_t *self, float room)
+{
+  self->room = room;
+  if(self->algorithm == REVERB_FREEVERB) {
+    for(int i = 0; i < NUM_COMBS; i++) {
+      self->comb[0][i].gain = FREEVERB_ROOM_OFFSET + FREEVERB_ROOM_SCALE * room;
+    }
+  }
+}
+
+// ======================================================================
+// freeverb damping 0..1.  more damping makes the highs die away faster.
+void reverb_set_damp(reverb_state_t *self, float damp)
+{
+  self->damp = damp;
 }
 
 // ======================================================================
 void reverb_get_samples(reverb_state_t *self, float *in_samples, float *out_samples, int frame_count)
 {
-  for(int frame = 0; frame < frame_count; frame++) {
-    float sample = in_samples[2*frame]; // just left sample for reverb input
-    float newsample = comb_filter(&(self->comb0[0]), &(self->comb0_idx), self->comb0_gain, self->comb0_lim, sample);
-    newsample += comb_filter(&(self->comb1[0]), &(self->comb1_idx), self->comb1_gain, self->comb1_lim, sample);
-    newsample += comb_filter(&(self->comb2[0]), &(self->comb2_idx), self->comb2_gain, self->comb2_lim, sample);
-    newsample += comb_filter(&(self->comb3[0]), &(self->comb3_idx), self->comb3_gain, self->comb3_lim, sample);
-    newsample /= 4;
-    newsample = allpass_filter(&(self->allp0[0]), &(self->allp0_idx), self->allp0_gain, self->allp0_lim, newsample);
-    newsample = allpass_filter(&(self->allp1[0]), &(self->allp1_idx), self->allp1_gain, self->allp1_lim, newsample);
-    newsample = allpass_filter(&(self->allp2[0]), &(self->allp2_idx), self->allp2_gain, self->allp2_lim, newsample);
-    newsample = (1.0-self->wet)*sample + self->wet*newsample;
-    float newsample1 = (1.0-self->wet)*in_samples[2*frame+1] + self->wet*newsample;
-    out_samples[2*frame] = newsample;
-    out_samples[2*frame+1] = newsample1;
+  // the slices only have room for REVERB_BLOCK_FRAMES at a time
+  while(frame_count > 0) {
+    int n = (frame_count < REVERB_BLOCK_FRAMES) ? frame_count : REVERB_BLOCK_FRAMES;
+    reverb_block(self, in_samples, out_samples, n);
+    in_samples += 2*n;
+    out_samples += 2*n;
+    frame_count -= n;
+  }
+}
+
+// ======================================================================
+void reverb_block(reverb_state_t *self, float *in_samples, float *out_samples, int frame_count)
+{
+  // skip the lines while they are silent & so is the input.  the mix
+  // below still runs with no wet signal, so nothing jumps when the lines
+  // start up again (from where they stopped).
+  float in_peak = reverb_peak(in_samples, 2*frame_count);
+  if(reverb_idle(self->quiet_frames, in_peak)) {
+    for(int c = 0; c < self->channels; c++) {
+      memset(&(self->out[c][0]), 0, sizeof(float)*frame_count);
+    }
+  } else {
+    reverb_lines(self, in_samples, frame_count);
+    float out_peak = 0.0f;
+    for(int c = 0; c < self->channels; c++) {
+      float peak = reverb_peak(&(self->out[c][0]), frame_count);
+      out_peak = (peak > out_peak) ? peak : out_peak;
+    }
+    self->quiet_frames = reverb_quiet_frames(self->quiet_frames, in_peak, out_peak, frame_count);
+  }
+
+  float wet_inc;
+  float wet = reverb_wet_block(&(self->wet), frame_count, &wet_inc);
+  float *out0 = &(self->out[0][0]);
+  float *out1 = &(self->out[1][0]);
+  if(self->channels > 1) {
+    for(int frame = 0; frame < frame_count; frame++) {
+      wet += wet_inc;
+      out_samples[2*frame] = (1.0f-wet)*in_samples[2*frame] + wet*out0[frame];
+      out_samples[2*frame+1] = (1.0f-wet)*in_samples[2*frame+1] + wet*out1[frame];
+    }
+  } else {
+    for(int frame = 0; frame < frame_count; frame++) {
+      wet += wet_inc;
+      float newsample = (1.0f-wet)*in_samples[2*frame] + wet*out0[frame];
+      float newsample1 = (1.0f-wet)*in_samples[2*frame+1] + wet*newsample;
+      out_samples[2*frame] = newsample;
+      out_samples[2*frame+1] = newsample1;
+    }
+  }
+}
+
+// ======================================================================
+// run the block through the lines into out[].  each filter runs over the
+// whole block before the next one starts, so its state & the mask stay
+// in registers.
+void reverb_lines(reverb_state_t *self, float *in_samples, int frame_count)
+{
+  if(self->algorithm == REVERB_FREEVERB) {
+    // one bank of combs takes the mono input for both sides, each side
+    // then has its own allpasses
+    float *in = &(self->in[0][0]);
+    float *out = &(self->out[0][0]);
+    for(int frame = 0; frame < frame_count; frame++) {
+      in[frame] = (0.5f*FREEVERB_GAIN)*(in_samples[2*frame] + in_samples[2*frame+1]);
+      out[frame] = 0.0f;
+    }
+    int moving = 0;
+    for(int i = 0; i < NUM_COMBS; i++) {
+      line_begin_block(&(self->comb[0][i]), frame_count);
+      moving |= (self->comb[0][i].delay_inc != 0.0f);
+    }
+    if(moving) {
+      for(int i = 0; i < NUM_COMBS; i++) {
+        damped_comb_filter(self, &(self->comb[0][i]), in, out, frame_count);
+      }
+    } else {
+      damped_comb_bank(self, in, out, frame_count);
+    }
+    for(int frame = 0; frame < frame_count; frame++) {
+      out[frame] /= 4;
+      self->out[1][frame] = out[frame];
+    }
+    for(int c = 0; c < self->channels; c++) {
+      for(int i = 0; i < NUM_ALLPS; i++) {
+        line_begin_block(&(self->allp[c][i]), frame_count);
+        freeverb_allpass_filter(self, &(self->allp[c][i]), &(self->out[c][0]), frame_count);
+      }
+    }
+  } else {
+    for(int c = 0; c < self->channels; c++) {
+      float *in = &(self->in[c][0]);
+      float *out = &(self->out[c][0]);
+      // tank 0 takes the left input, tank 1 (if there is one) the right
+      for(int frame = 0; frame < frame_count; frame++) {
+        in[frame] = in_samples[2*frame+c];
+        out[frame] = 0.0f;
+      }
+      for(int i = 0; i < NUM_COMBS; i++) {
+        line_begin_block(&(self->comb[c][i]), frame_count);
+        comb_filter(self, &(self->comb[c][i]), in, out, frame_count);
+      }
+      for(int frame = 0; frame < frame_count; frame++) {
+        out[frame] /= 4;
+      }
+      for(int i = 0; i < NUM_ALLPS; i++) {
+        line_begin_block(&(self->allp[c][i]), frame_count);
+        allpass_filter(self, &(self->allp[c][i]), out, frame_count);
+      }
+    }
   }
+  self->pos += frame_count;
 }
 
-inline float comb_filter(float *buf, int *idx, float gain, int lim, float v)
+// ======================================================================
+void line_init(reverb_line_t *line, reverb_sample_t *buf, int offset, int max_delay, float gain)
 {
-  float new_v = buf[*idx]*gain + v;
-  buf[*idx] = new_v;
-  *idx += 1;
-  if (*idx == lim) {
-    *idx = 0;
+  line->buf = buf;
+  line->offset = offset;
+  line->max_delay = max_delay;
+  line->gain = gain;
+  line->store = 0.0f;
+  line->delay = max_delay;
+  line->target = max_delay;
+  line->delay_inc = 0.0f;
+}
+
+// ======================================================================
+// the delay to move to, kept inside the line's slice
+void line_set_target(reverb_line_t *line, int target)
+{
+  line->target = (target < 1) ? 1 : (target > line->max_delay) ? line->max_delay : target;
+}
+
+// ======================================================================
+// set how far the delay moves toward its target in this block
+void line_begin_block(reverb_line_t *line, int frame_count)
+{
+  float change = line->target - line->delay;
+  float max_change = REVERB_DELAY_SLEW * frame_count;
+  change = (change > max_change) ? max_change : (change < -max_change) ? -max_change : change;
+  line->delay_inc = change / frame_count;
+  if(line->delay_inc == 0.0f) {
+    // land exactly on the target
+    line->delay = line->target;
+  }
+}
+
+// ======================================================================
+// LINE_LOOP(line, frame_count, body) runs body for each frame with
+// `delayed` set to the line's sample from delay frames ago & `w` the
+// index in buf to write the line's new sample to.  a line that is not
+// changing its delay reads one frame, a moving one interpolates between two.
+#define LINE_LOOP(line, frame_count, body)                               \
+  {                                                                      \
+    reverb_sample_t *buf = (line)->buf;                                  \
+    uint32_t w = self->pos + (line)->offset;                             \
+    if((line)->delay_inc == 0.0f) {                                      \
+      uint32_t r = w - (uint32_t)(line)->delay;                          \
+      for(int frame = 0; frame < (frame_count); frame++) {               \
+        float delayed = reverb_load(buf[r & REVERB_BUF_MASK]);           \
+        body                                                             \
+        w++;                                                             \
+        r++;                                                             \
+      }                                                                  \
+    } else {                                                             \
+      float delay = (line)->delay;                                       \
+      float delay_inc = (line)->delay_inc;                               \
+      for(int frame = 0; frame < (frame_count); frame++) {               \
+        int d = (int)delay;                                              \
+        float frac = delay - d;                                          \
+        float d0 = reverb_load(buf[(w - d) & REVERB_BUF_MASK]);          \
+        float d1 = reverb_load(buf[(w - d - 1) & REVERB_BUF_MASK]);      \
+        float delayed = d0 + (d1 - d0) * frac;                           \
+        body                                                             \
+        w++;                                                             \
+        delay += delay_inc;                                              \
+      }                                                                  \
+      (line)->delay = delay;                                             \
+    }                                                                    \
   }
-  return new_v;
+
+// ======================================================================
+// add the comb's output for in[] to inout[]
+void comb_filter(reverb_state_t *self, reverb_line_t *line, float *in, float *inout, int frame_count)
+{
+  float gain = line->gain;
+  LINE_LOOP(line, frame_count, {
+    float new_v = delayed*gain + in[frame];
+    buf[w & REVERB_BUF_MASK] = reverb_store(new_v);
+    inout[frame] += new_v;
+  })
+}
+
+// ======================================================================
+void allpass_filter(reverb_state_t *self, reverb_line_t *line, float *inout, int frame_count)
+{
+  float gain = line->gain;
+  LINE_LOOP(line, frame_count, {
+    float v = inout[frame];
+    float feedback = delayed + (-gain) * v;
+    float new_v = feedback*gain + v;
+    buf[w & REVERB_BUF_MASK] = reverb_store(new_v);
+    inout[frame] = new_v;
+  })
 }
 
-inline float allpass_filter(float *buf, int *idx, float gain, int lim, float v)
+// ======================================================================
+// freeverb's lowpass-feedback comb.  add its output for in[] to inout[]
+void damped_comb_filter(reverb_state_t *self, reverb_line_t *line, float *in, float *inout, int frame_count)
 {
-  float feedback = buf[*idx] + (-gain) * v;
-  float new_v = feedback*gain + v;
-  buf[*idx] = new_v;
-  *idx += 1;
-  if (*idx == lim) {
-    *idx = 0;
+  float gain = line->gain;
+  float damp1 = FREEVERB_DAMP_SCALE * self->damp;
+  float damp2 = 1.0f - damp1;
+  float store = line->store;
+  LINE_LOOP(line, frame_count, {
+    store = delayed*damp2 + store*damp1;
+    buf[w & REVERB_BUF_MASK] = reverb_store(in[frame] + store*gain);
+    inout[frame] += delayed;
+  })
+  line->store = store;
+}
+
+// ======================================================================
+// the same for all 4 of freeverb's combs at once, adding their outputs
+// to out[], while none of their delays are moving.  a comb's lowpass has
+// to wait for its previous frame, so one comb at a time stalls on it
+// every frame.  4 side by side don't wait on each other.
+void damped_comb_bank(reverb_state_t *self, float *in, float *out, int frame_count)
+{
+  reverb_line_t *comb = &(self->comb[0][0]);
+  reverb_sample_t *buf = comb[0].buf;
+  float damp1 = FREEVERB_DAMP_SCALE * self->damp;
+  float damp2 = 1.0f - damp1;
+  float gain[NUM_COMBS], store[NUM_COMBS];
+  uint32_t w[NUM_COMBS], r[NUM_COMBS];
+  for(int i = 0; i < NUM_COMBS; i++) {
+    gain[i] = comb[i].gain;
+    store[i] = comb[i].store;
+    w[i] = self->pos + comb[i].offset;
+    r[i] = w[i] - (uint32_t)comb[i].delay;
+  }
+  for(int frame = 0; frame < frame_count; frame++) {
+    float sum = out[frame];
+    for(int i = 0; i < NUM_COMBS; i++) {
+      float delayed = reverb_load(buf[(r[i] + frame) & REVERB_BUF_MASK]);
+      store[i] = delayed*damp2 + store[i]*damp1;
+      buf[(w[i] + frame) & REVERB_BUF_MASK] = reverb_store(in[frame] + store[i]*gain[i]);
+      sum += delayed;
+    }
+    out[frame] = sum;
+  }
+  for(int i = 0; i < NUM_COMBS; i++) {
+    comb[i].store = store[i];
   }
-  return new_v;
+}
+
+// ======================================================================
+void freeverb_allpass_filter(reverb_state_t *self, reverb_line_t *line, float *inout, int frame_count)
+{
+  float gain = line->gain;
+  LINE_LOOP(line, frame_count, {
+    float v = inout[frame];
+    buf[w & REVERB_BUF_MASK] = reverb_store(v + delayed*gain);
+    inout[frame] = delayed - v;
+  })
 }
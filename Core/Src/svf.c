@@ -0,0 +1,142 @@
+/*
+ * svf.c
+ *
+ *  Created on: Oct 17, 2026
+ *      Author: agent
+ */
+//
+// per sample, for each channel, with v0 the input:
+//   v3 = v0 - ic2eq
+//   v1 = a1*ic1eq + a2*v3          bandpass
+//   v2 = ic2eq + a2*ic1eq + a3*v3  lowpass
+//   ic1eq = 2*v1 - ic1eq
+//   ic2eq = 2*v2 - ic2eq
+//   highpass = v0 - k*v1 - v2
+//
+
+#include "svf.h"
+#include "synthutil.h"
+#include <math.h>
+
+// keep pi * cutoff / FRAME_RATE below this, where svf_tan is still close
+// to tan.  1.5 is about 0.48 * FRAME_RATE.
+#define SVF_MAX_W 1.5f
+
+float svf_tan(float x);
+void svf_update(svf_state_t *self);
+
+// ======================================================================
+// [5/4] pade approximation of tan(x), within 1e-6 up to x = 1 & 1e-4
+// at x = 1.5.  one divide instead of a libm call.
+inline float svf_tan(float x)
+{
+  float x2 = x * x;
+  return x * (945.0f + x2 * (-105.0f + x2)) / (945.0f + x2 * (-420.0f + x2 * 15.0f));
+}
+
+// ======================================================================
+void svf_update(svf_state_t *self)
+{
+  self->a1 = 1.0f / (1.0f + self->g * (self->g + self->k));
+  self->a2 = self->g * self->a1;
+  self->a3 = self->g * self->a2;
+}
+
+// ======================================================================
+// cutoff in Hz, resonance in dB like sf_lowpass
+void svf_init(svf_state_t *self, uint8_t mode, float cutoff, float resonance)
+{
+  self->mode = mode;
+  self->ic1eq = (sf_sample_st){ 0, 0 };
+  self->ic2eq = (sf_sample_st){ 0, 0 };
+  self->g = 0.0f;
+  svf_set_resonance(self, resonance);
+  svf_set_cutoff(self, cutoff);
+}
+
+// ======================================================================
+// cheap enough to call every block.  keeps the integrator states.
+void svf_set_cutoff(svf_state_t *self, float cutoff)
+{
+  float w = (float)M_PI * cutoff / FRAME_RATE;
+  w = (w < 0.0f) ? 0.0f : (w > SVF_MAX_W) ? SVF_MAX_W : w;
+  self->g = svf_tan(w);
+  svf_update(self);
+}
+
+// ======================================================================
+// resonance in dB, converted to Q.  keeps the integrator states.
+void svf_set_resonance(svf_state_t *self, float resonance)
+{
+  self->k = 1.0f / powf(10.0f, resonance * 0.05f);
+  svf_update(self);
+}
+
+// ======================================================================
+// mode picks the output.  input & output can be the same buffer.
+void svf_process(svf_state_t *self, int frame_count, sf_sample_st *input, sf_sample_st *output)
+{
+  float a1 = self->a1;
+  float a2 = self->a2;
+  float a3 = self->a3;
+  // output = cl*lowpass + cb*bandpass + ch*highpass.  bandpass is scaled
+  // by k for a 0dB peak, like sf_bandpass.
+  float cl = (self->mode == SVF_LOWPASS) ? 1.0f : 0.0f;
+  float cb = (self->mode == SVF_BANDPASS) ? self->k : 0.0f;
+  float ch = (self->mode == SVF_HIGHPASS) ? 1.0f : 0.0f;
+  // highpass = v0 - k*v1 - v2, folded into the sum
+  cb -= ch * self->k;
+  cl -= ch;
+  float ic1L = self->ic1eq.L, ic1R = self->ic1eq.R;
+  float ic2L = self->ic2eq.L, ic2R = self->ic2eq.R;
+  for(int i = 0; i < frame_count; i++) {
+    float v0L = input[i].L;
+    float v0R = input[i].R;
+    float v3L = v0L - ic2L;
+    float v3R = v0R - ic2R;
+    float v1L = a1 * ic1L + a2 * v3L;
+    float v1R = a1 * ic1R + a2 * v3R;
+    float v2L = ic2L + a2 * ic1L + a3 * v3L;
+    float v2R = ic2R + a2 * ic1R + a3 * v3R;
+    ic1L = 2.0f * v1L - ic1L;
+    ic1R = 2.0f * v1R - ic1R;
+    ic2L = 2.0f * v2L - ic2L;
+    ic2R = 2.0f * v2R - ic2R;
+    output[i].L = cl * v2L + cb * v1L + ch * v0L;
+    output[i].R = cl * v2R + cb * v1R + ch * v0R;
+  }
+  self->ic1eq = (sf_sample_st){ ic1L, ic1R };
+  self->ic2eq = (sf_sample_st){ ic2L, ic2R };
+}
+
+// ======================================================================
+// all three outputs at once.  bandpass is scaled for a 0dB peak.
+void svf_process_split(svf_state_t *self, int frame_count, sf_sample_st *input,
+    sf_sample_st *lowpass, sf_sample_st *bandpass, sf_sample_st *highpass)
+{
+  float a1 = self->a1;
+  float a2 = self->a2;
+  float a3 = self->a3;
+  float k = self->k;
+  float ic1L = self->ic1eq.L, ic1R = self->ic1eq.R;
+  float ic2L = self->ic2eq.L, ic2R = self->ic2eq.R;
+  for(int i = 0; i < frame_count; i++) {
+    float v0L = input[i].L;
+    float v0R = input[i].R;
+    float v3L = v0L - ic2L;
+    float v3R = v0R - ic2R;
+    float v1L = a1 * ic1L + a2 * v3L;
+    float v1R = a1 * ic1R + a2 * v3R;
+    float v2L = ic2L + a2 * ic1L + a3 * v3L;
+    float v2R = ic2R + a2 * ic1R + a3 * v3R;
+    ic1L = 2.0f * v1L - ic1L;
+    ic1R = 2.0f * v1R - ic1R;
+    ic2L = 2.0f * v2L - ic2L;
+    ic2R = 2.0f * v2R - ic2R;
+    lowpass[i]  = (sf_sample_st){ v2L, v2R };
+    bandpass[i] = (sf_sample_st){ k * v1L, k * v1R };
+    highpass[i] = (sf_sample_st){ v0L - k * v1L - v2L, v0R - k * v1R - v2R };
+  }
+  self->ic1eq = (sf_sample_st){ ic1L, ic1R };
+  self->ic2eq = (sf_sample_st){ ic2L, ic2R };
+}
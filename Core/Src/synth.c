@@ -17,11 +17,13 @@
 //          VV                 X
 //    [ Wavetable i ]          X
 //          VV                 X
+//    [ Filter i ] (optional)  X
+//          VV                 X
 //    [ Envelope i ]           X
 //          VV                 X
 //    Mix ]                    X
 //     VV                      X
-//  [ Pan     ]                _
+//  [ Pan     ]                X
 //     VV                      _
 //  [ Compressor ]             _
 //     VV                      _
@@ -29,6 +31,8 @@
 //     VV                      X
 //  [  Reverb  ]               X
 //     VV                      X
+//  [    EQ    ]               X
+//     VV                      X
 //  [  Output  ]               X
 //
 #include "synth.h"
@@ -49,6 +53,10 @@
 #define AUDIO_BUFFER_SAMPLES  AUDIO_BUFFER_FRAMES * AUDIO_BUFFER_CHANNELS
 #define AUDIO_BUFFER_BYTES    sizeof(int16_t)*AUDIO_BUFFER_SAMPLES
 
+#if VCF_MAX_VOICES < MAX_POLYPHONY
+#error VCF_MAX_VOICES must be at least MAX_POLYPHONY
+#endif
+
 // volume of hardware DAC.  86 is the max before distortion occurs
 #define HARDWARE_VOLUME 86
 
@@ -61,11 +69,32 @@ synth_state_t the_synth;
 // audio buffer that is sent over I2S to DAC
 uint16_t audio_buffer[AUDIO_BUFFER_SAMPLES];
 
+// the reverb's delay lines fill the CCMRAM, keeping them out of the
+// main SRAM heap the USB host allocates from.  the rest of its state &
+// the audio scratch buffers stay in main SRAM, there is no room left.
+static reverb_ring_t reverb_ring CCMRAM;
+static reverb_state_t reverb_state;
+
 // ======================================================================
 // private function prototypes
 
 void audio_init(void);
 void update_audio_buffer(uint32_t start_frame, uint32_t num_frames);
+void voice_list_add(uint8_t voice);
+void voice_list_clear(void);
+int8_t steal_voice(void);
+int8_t find_oldest_voice(void);
+int8_t find_quietest_voice(uint8_t releasing_only);
+int64_t synth_get_frame(void);
+void voice_note_on(uint8_t voice, int8_t pitch, int8_t velocity, int64_t frame);
+float voice_cutoff(uint8_t voice, float env_level);
+void voice_mix_samples(uint8_t voice, float *inout_samples, int frame_count);
+void voice_filter_mix_samples(uint8_t voice, float *inout_samples, int frame_count);
+void rlpf_design(sf_biquad_state_st *design);
+int8_t rlpf_svf_mode(void);
+uint8_t rlpf_uses_svf(void);
+void rlpf_retune(void);
+void rlpf_restart(void);
 
 // ======================================================================
 // user code
@@ -74,6 +103,7 @@ void update_audio_buffer(uint32_t start_frame, uint32_t num_frames);
 void synth_init()
 {
   the_synth.voices = DEFAULT_VOICES;
+  the_synth.steal = DEFAULT_STEAL;
   the_synth.wave = DEFAULT_WAVE;
 
   the_synth.attack = DEFAULT_ATTACK;
@@ -81,24 +111,69 @@ void synth_init()
   the_synth.sustain = DEFAULT_SUSTAIN;
   the_synth.release = DEFAULT_RELEASE;
   the_synth.scale = DEFAULT_SCALE;
+  the_synth.curve = DEFAULT_CURVE;
+
+  the_synth.filter = DEFAULT_FILTER;
+  the_synth.fcutoff = DEFAULT_FCUTOFF;
+  the_synth.fresonance = DEFAULT_FRESONANCE;
+  the_synth.fenv = DEFAULT_FENV;
+  the_synth.fvelocity = DEFAULT_FVELOCITY;
+  the_synth.fattack = DEFAULT_FATTACK;
+  the_synth.fdecay = DEFAULT_FDECAY;
+  the_synth.fsustain = DEFAULT_FSUSTAIN;
+  the_synth.frelease = DEFAULT_FRELEASE;
+  vcf_init(&(the_synth.vcf));
+
   for(int i=0; i < MAX_POLYPHONY; i++) {
     wavetable_init( &(the_synth.wavetables[i]), the_synth.wave );
     adsr_init( &(the_synth.envelopes[i]), the_synth.attack, the_synth.decay, the_synth.sustain, the_synth.release, the_synth.scale);
+    the_synth.envelopes[i].curve = the_synth.curve;
+    // filter envelope goes 0 -> 1, the octaves come from fenv
+    adsr_init( &(the_synth.filter_envelopes[i]), the_synth.fattack, the_synth.fdecay, the_synth.fsustain, the_synth.frelease, 1.0);
+    the_synth.filter_envelopes[i].curve = the_synth.curve;
+    the_synth.velocity[i] = 0;
+    the_synth.pending_pitch[i] = -1;
+    the_synth.pending_velocity[i] = 0;
   }
 
   the_synth.cutoff = DEFAULT_CUTOFF;
   the_synth.resonance = DEFAULT_RESONANCE;
-  sf_lowpass(&(the_synth.rlpf), FRAME_RATE, the_synth.cutoff, the_synth.resonance);
+  the_synth.svf = DEFAULT_SVF;
+  the_synth.enable_rlpf = DEFAULT_RLPF;
+  the_synth.type = DEFAULT_TYPE;
+  the_synth.gain = DEFAULT_GAIN;
+  rlpf_restart();
+
+  eq_init(&(the_synth.eq));
+  for(int b = 0; b < EQ_BANDS; b++) {
+    the_synth.eq_freq[b] = the_synth.eq.freq[b];
+    the_synth.eq_gain[b] = the_synth.eq.gain[b];
+  }
 
   the_synth.wet = DEFAULT_WET;
   the_synth.delay = DEFAULT_DELAY;
-  the_synth.reverb = (reverb_state_t *)malloc(sizeof(reverb_state_t));
-  if(the_synth.reverb == 0) {
-    Error_Handler();
-  }
-  reverb_init(the_synth.reverb, the_synth.wet, the_synth.delay);
+  the_synth.verb = DEFAULT_VERB;
+  the_synth.reverb = &reverb_state;
+  // clears the lines the reverb & fdn share, once.  the fdn starts on
+  // them as they are.
+  reverb_init(the_synth.reverb, &reverb_ring, the_synth.verb, the_synth.wet, the_synth.delay);
+  the_synth.room = DEFAULT_ROOM;
+  the_synth.damp = DEFAULT_DAMP;
+  reverb_set_room(the_synth.reverb, the_synth.room);
+  reverb_set_damp(the_synth.reverb, the_synth.damp);
+  fdn_init(&(the_synth.fdn), &reverb_ring, the_synth.wet);
+  fdn_set_room(&(the_synth.fdn), the_synth.room);
+  fdn_set_damp(&(the_synth.fdn), the_synth.damp);
+
+  the_synth.synth_frame = 0;
+
+  voice_list_clear();
+  synth_reset_stats();
 
-  the_synth.synth_time = 0.0;
+  // enable the cycle counter for the stats
+  CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+  DWT->CYCCNT = 0;
+  DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
 
   audio_init();
 
@@ -115,8 +190,26 @@ void set_wave(uint8_t v)
 }
 void set_voices(uint8_t v)
 {
+  if(v < 1) {
+    v = 1;
+  } else if(v > MAX_POLYPHONY) {
+    v = MAX_POLYPHONY;
+  }
   printf("set: voices = %d\r\n",v);
-  the_synth.voices = v;  // FIXME use this
+  the_synth.voices = v;
+  // fade out any voices above the new limit
+  int64_t frame = synth_get_frame();
+  for(int i=v; i < MAX_POLYPHONY; i++) {
+    __disable_irq();
+    the_synth.pending_pitch[i] = -1;
+    adsr_fade(&(the_synth.envelopes[i]), frame);
+    __enable_irq();
+  }
+}
+void set_steal(uint8_t v)
+{
+  printf("set: steal = %d\r\n",v);
+  the_synth.steal = v;
 }
 void set_attack(float v)
 {
@@ -158,29 +251,320 @@ void set_scale(float v)
     the_synth.envelopes[i].scale = v;
   }
 }
+void set_curve(uint8_t v)
+{
+  printf("set: curve = %d\r\n",v);
+  the_synth.curve = v;
+  for(int i=0; i < MAX_POLYPHONY; i++) {
+    the_synth.envelopes[i].curve = v;
+    the_synth.filter_envelopes[i].curve = v;
+  }
+}
+void set_filter(uint8_t v)
+{
+  printf("set: filter = %d\r\n",v);
+  the_synth.filter = v;
+}
+void set_fcutoff(float v)
+{
+  printf("set: fcutoff = %f\r\n",v);
+  the_synth.fcutoff = v;
+}
+void set_fresonance(float v)
+{
+  printf("set: fresonance = %f\r\n",v);
+  the_synth.fresonance = v;
+}
+void set_fenv(float v)
+{
+  printf("set: fenv = %f\r\n",v);
+  the_synth.fenv = v;
+}
+void set_fvelocity(float v)
+{
+  printf("set: fvelocity = %f\r\n",v);
+  the_synth.fvelocity = v;
+}
+void set_fattack(float v)
+{
+  printf("set: fattack = %f\r\n",v);
+  the_synth.fattack = v;
+  for(int i=0; i < MAX_POLYPHONY; i++) {
+    the_synth.filter_envelopes[i].attack = v;
+  }
+}
+void set_fdecay(float v)
+{
+  printf("set: fdecay = %f\r\n",v);
+  the_synth.fdecay = v;
+  for(int i=0; i < MAX_POLYPHONY; i++) {
+    the_synth.filter_envelopes[i].decay = v;
+  }
+}
+void set_fsustain(float v)
+{
+  printf("set: fsustain = %f\r\n",v);
+  the_synth.fsustain = v;
+  for(int i=0; i < MAX_POLYPHONY; i++) {
+    the_synth.filter_envelopes[i].sustain = v;
+  }
+}
+void set_frelease(float v)
+{
+  printf("set: frelease = %f\r\n",v);
+  the_synth.frelease = v;
+  for(int i=0; i < MAX_POLYPHONY; i++) {
+    the_synth.filter_envelopes[i].release = v;
+  }
+}
+void set_rlpf(uint8_t v)
+{
+  printf("set: rlpf = %d\r\n",v);
+  if(v && !the_synth.enable_rlpf) {
+    // history is stale from before it was disabled
+    rlpf_restart();
+  }
+  the_synth.enable_rlpf = v;
+}
+void set_type(uint8_t v)
+{
+  printf("set: type = %d\r\n",v);
+  uint8_t was_svf = rlpf_uses_svf();
+  the_synth.type = v;
+  if(rlpf_uses_svf() != was_svf) {
+    rlpf_restart();
+  } else {
+    rlpf_retune();
+  }
+}
 void set_cutoff(float v)
 {
   printf("set: cutoff = %f\r\n",v);
   the_synth.cutoff = v;
-  sf_lowpass(&(the_synth.rlpf), FRAME_RATE, the_synth.cutoff, the_synth.resonance);
+  rlpf_retune();
 }
 void set_resonance(float v)
 {
   printf("set: resonance = %f\r\n",v);
   the_synth.resonance = v;
-  sf_lowpass(&(the_synth.rlpf), FRAME_RATE, the_synth.cutoff, the_synth.resonance);
+  rlpf_retune();
+}
+void set_gain(float v)
+{
+  printf("set: gain = %f\r\n",v);
+  the_synth.gain = v;
+  rlpf_retune();
+}
+void set_svf(uint8_t v)
+{
+  printf("set: svf = %d\r\n",v);
+  uint8_t was_svf = rlpf_uses_svf();
+  the_synth.svf = v;
+  if(rlpf_uses_svf() != was_svf) {
+    rlpf_restart();
+  }
+}
+void set_eq_freq(uint8_t band, float v)
+{
+  if(band >= EQ_BANDS) {
+    return;
+  }
+  printf("set: eq%d freq = %f\r\n",band,v);
+  the_synth.eq_freq[band] = v;
+  eq_set_band(&(the_synth.eq), band, the_synth.eq_freq[band], the_synth.eq_gain[band]);
+  __disable_irq();
+  eq_update(&(the_synth.eq));
+  __enable_irq();
+}
+void set_eq_gain(uint8_t band, float v)
+{
+  if(band >= EQ_BANDS) {
+    return;
+  }
+  printf("set: eq%d gain = %f\r\n",band,v);
+  the_synth.eq_gain[band] = v;
+  eq_set_band(&(the_synth.eq), band, the_synth.eq_freq[band], the_synth.eq_gain[band]);
+  __disable_irq();
+  eq_update(&(the_synth.eq));
+  __enable_irq();
 }
 void set_wet(float v)
 {
   printf("set: wet = %f\r\n",v);
   the_synth.wet = v;
-  reverb_init(the_synth.reverb, the_synth.wet, the_synth.delay);
+  // the ramps start from the wet level the audio interrupt has reached
+  __disable_irq();
+  reverb_set_wet(the_synth.reverb, the_synth.wet);
+  fdn_set_wet(&(the_synth.fdn), the_synth.wet);
+  __enable_irq();
 }
 void set_delay(float v)
 {
   printf("set: delay = %f\r\n",v);
   the_synth.delay = v;
-  reverb_init(the_synth.reverb, the_synth.wet, the_synth.delay);
+  reverb_set_delay(the_synth.reverb, the_synth.delay);
+}
+void set_verb(uint8_t v)
+{
+  printf("set: verb = %d\r\n",v);
+  if(v > REVERB_FDN) {
+    return;
+  }
+  the_synth.verb = v;
+  // clears the lines the reverb & fdn share, keep the audio interrupt out
+  __disable_irq();
+  if(the_synth.verb == REVERB_FDN) {
+    fdn_clear(&(the_synth.fdn));
+  } else {
+    reverb_set_algorithm(the_synth.reverb, the_synth.verb);
+  }
+  __enable_irq();
+}
+void set_room(float v)
+{
+  printf("set: room = %f\r\n",v);
+  the_synth.room = v;
+  reverb_set_room(the_synth.reverb, the_synth.room);
+  fdn_set_room(&(the_synth.fdn), the_synth.room);
+}
+void set_damp(float v)
+{
+  printf("set: damp = %f\r\n",v);
+  the_synth.damp = v;
+  reverb_set_damp(the_synth.reverb, the_synth.damp);
+  fdn_set_damp(&(the_synth.fdn), the_synth.damp);
+}
+
+// ======================================================================
+void synth_print_stats(void)
+{
+  printf("stats: blocks = %lu\r\n", the_synth.stats.blocks);
+  printf("stats: voices rendered = %d (max %d)\r\n",
+      the_synth.stats.voices_rendered, the_synth.stats.max_voices_rendered);
+  printf("stats: cycles per block = %lu (max %lu)\r\n",
+      the_synth.stats.cycles, the_synth.stats.max_cycles);
+  if(the_synth.stats.voice_blocks > 0) {
+    printf("stats: cycles per voice per block = %lu\r\n",
+        (uint32_t)(the_synth.stats.voice_cycles / the_synth.stats.voice_blocks));
+  }
+}
+
+void synth_reset_stats(void)
+{
+  memset(&(the_synth.stats), 0, sizeof(synth_stats_t));
+}
+
+// ======================================================================
+// The active voice list is read & pruned by update_audio_buffer in the
+// DMA interrupt, so changes from the main loop happen with irqs off.
+void voice_list_add(uint8_t voice)
+{
+  __disable_irq();
+  for(int i = 0; i < the_synth.num_active_voices; i++) {
+    if(the_synth.active_voices[i] == voice) {
+      // still on the list from its last note
+      __enable_irq();
+      return;
+    }
+  }
+  the_synth.active_voices[the_synth.num_active_voices++] = voice;
+  __enable_irq();
+}
+
+void voice_list_clear(void)
+{
+  __disable_irq();
+  the_synth.num_active_voices = 0;
+  __enable_irq();
+}
+
+// ======================================================================
+// the biquad design for the rlpf type.  resonance is in dB, for the
+// types that take a Q it is converted the same way sf_lowpass does.
+void rlpf_design(sf_biquad_state_st *design)
+{
+  float f = the_synth.cutoff;
+  float q = powf(10.0f, the_synth.resonance * 0.05f);
+  switch(the_synth.type) {
+  case FILTER_HIGHPASS:  sf_highpass(design, FRAME_RATE, f, the_synth.resonance); break;
+  case FILTER_BANDPASS:  sf_bandpass(design, FRAME_RATE, f, q); break;
+  case FILTER_NOTCH:     sf_notch(design, FRAME_RATE, f, q); break;
+  case FILTER_PEAKING:   sf_peaking(design, FRAME_RATE, f, q, the_synth.gain); break;
+  case FILTER_ALLPASS:   sf_allpass(design, FRAME_RATE, f, q); break;
+  case FILTER_LOWSHELF:  sf_lowshelf(design, FRAME_RATE, f, q, the_synth.gain); break;
+  case FILTER_HIGHSHELF: sf_highshelf(design, FRAME_RATE, f, q, the_synth.gain); break;
+  case FILTER_LOWPASS:
+  default:
+    sf_lowpass_fast(design, FRAME_RATE, f, the_synth.resonance);
+    break;
+  }
+}
+
+// ======================================================================
+// the svf output for the rlpf type, -1 if the svf can't do it & the
+// biquad is used instead
+int8_t rlpf_svf_mode(void)
+{
+  switch(the_synth.type) {
+  case FILTER_LOWPASS:  return SVF_LOWPASS;
+  case FILTER_HIGHPASS: return SVF_HIGHPASS;
+  case FILTER_BANDPASS: return SVF_BANDPASS;
+  default:              return -1;
+  }
+}
+
+// ======================================================================
+// 1 if the svf is running in place of the biquad
+uint8_t rlpf_uses_svf(void)
+{
+  return the_synth.svf && (rlpf_svf_mode() >= 0);
+}
+
+// ======================================================================
+// change the running rlpf without clearing its history.  the new
+// coefficients are ramped in over the next block so there is no click.
+// the svf keeps its integrators, so it can just take the new values.
+void rlpf_retune(void)
+{
+  sf_biquad_state_st design;
+  rlpf_design(&design);
+  int8_t mode = rlpf_svf_mode();
+  __disable_irq();
+  sf_biquad_retune(&(the_synth.rlpf), &design);
+  sf_biquad_fixed_retune(&(the_synth.rlpf_fixed), &design);
+  if(mode >= 0) {
+    the_synth.rsvf.mode = mode;
+  }
+  svf_set_resonance(&(the_synth.rsvf), the_synth.resonance);
+  svf_set_cutoff(&(the_synth.rsvf), the_synth.cutoff);
+  __enable_irq();
+}
+
+// ======================================================================
+// set up the rlpf from scratch, clearing its history.  also called when
+// it moves between the biquad & the svf, as the one taking over still
+// holds whatever it had when it last ran.
+void rlpf_restart(void)
+{
+  sf_biquad_state_st design;
+  rlpf_design(&design);
+  int8_t mode = rlpf_svf_mode();
+  __disable_irq();
+  the_synth.rlpf = design;
+  sf_biquad_fixed_init(&(the_synth.rlpf_fixed), &design);
+  svf_init(&(the_synth.rsvf), (mode >= 0) ? mode : SVF_LOWPASS, the_synth.cutoff, the_synth.resonance);
+  __enable_irq();
+}
+
+// ======================================================================
+// synth_frame is advanced in the DMA interrupt & a 64-bit read is not
+// atomic, so read it with irqs off from the main loop.
+int64_t synth_get_frame(void)
+{
+  __disable_irq();
+  int64_t frame = the_synth.synth_frame;
+  __enable_irq();
+  return frame;
 }
 
 // ======================================================================
@@ -203,16 +587,37 @@ void synth_all_notes_off(void)
   for(int i = 0; i < MAX_POLYPHONY; i++) {
     wavetable_note_off( &(the_synth.wavetables[i]) );
     adsr_reset(&(the_synth.envelopes[i]));
+    adsr_reset(&(the_synth.filter_envelopes[i]));
+    the_synth.pending_pitch[i] = -1;
   }
+  voice_list_clear();
 }
 
 // ======================================================================
 void note_off(uint8_t midi_cmd, uint8_t midi_param0, uint8_t midi_param1)
 {
+  int64_t frame = synth_get_frame();
+  // the DMA interrupt starts pending notes, so look for one & drop it
+  // with irqs off or it could start in between & never be released.
+  int8_t pending_idx = -1;
+  __disable_irq();
+  for(int8_t j = 0; j < MAX_POLYPHONY; j++) {
+    if(midi_param0 == the_synth.pending_pitch[j]) {
+      // note ended before its stolen voice finished fading, drop it
+      the_synth.pending_pitch[j] = -1;
+      pending_idx = j;
+      break;
+    }
+  }
+  __enable_irq();
+  if(pending_idx >= 0) {
+    printf("Note off: %d %d %d [pending]\r\n", pending_idx, midi_param0, midi_param1);
+    return;
+  }
   int8_t cur_idx = MAX_POLYPHONY;
   for(int8_t j = 0; j < MAX_POLYPHONY; j++) {
     if(midi_param0 == the_synth.wavetables[j].pitch) {
-      if(1 == adsr_releasing(&(the_synth.envelopes[j]), the_synth.synth_time)) {
+      if(1 == adsr_releasing(&(the_synth.envelopes[j]))) {
         // release already in progress here, keep looking
         continue;
       }
@@ -222,7 +627,10 @@ void note_off(uint8_t midi_cmd, uint8_t midi_param0, uint8_t midi_param1)
   }
   if(cur_idx < MAX_POLYPHONY) {
     printf("Note off: %d %d %d\r\n", cur_idx, midi_param0, midi_param1);
-    adsr_note_off(&(the_synth.envelopes[cur_idx]), the_synth.synth_time);
+    __disable_irq();
+    adsr_note_off(&(the_synth.envelopes[cur_idx]), frame);
+    adsr_note_off(&(the_synth.filter_envelopes[cur_idx]), frame);
+    __enable_irq();
   } else {
     printf("Note off: [NOPE] %d %d\r\n", midi_param0, midi_param1);
   }
@@ -231,52 +639,233 @@ void note_off(uint8_t midi_cmd, uint8_t midi_param0, uint8_t midi_param1)
 // ======================================================================
 void note_on(uint8_t midi_cmd, uint8_t midi_param0, uint8_t midi_param1)
 {
-  int8_t cur_idx = MAX_POLYPHONY;
-  for(int8_t j = 0; j < MAX_POLYPHONY; j++) {
-    if(0 == adsr_active(&(the_synth.envelopes[j]), the_synth.synth_time)) {
+  int64_t frame = synth_get_frame();
+  int8_t cur_idx = -1;
+  for(int8_t j = 0; j < the_synth.voices; j++) {
+    if(0 == adsr_active(&(the_synth.envelopes[j]))) {
       // found a spot!
       cur_idx = j;
       break;
     }
   }
-  if(cur_idx < MAX_POLYPHONY) {
+  if(cur_idx >= 0) {
     printf("Note on:  %d %d %d\r\n", cur_idx, midi_param0, midi_param1);
-    wavetable_note_on(&(the_synth.wavetables[cur_idx]), midi_param0, midi_param1);
-    adsr_note_on(&(the_synth.envelopes[cur_idx]), midi_param1, the_synth.synth_time);
-  } else {
+    voice_note_on(cur_idx, midi_param0, midi_param1, frame);
+    voice_list_add(cur_idx);
+    return;
+  }
+  // no free voice.  fade one out & start the note when the fade is done.
+  // pick it with irqs off, so the interrupt can't finish its release
+  // between picking it & fading it.
+  uint8_t stolen = 0;
+  __disable_irq();
+  cur_idx = steal_voice();
+  if(cur_idx >= 0) {
+    if(adsr_active(&(the_synth.envelopes[cur_idx]))) {
+      the_synth.pending_pitch[cur_idx] = midi_param0;
+      the_synth.pending_velocity[cur_idx] = midi_param1;
+      adsr_fade(&(the_synth.envelopes[cur_idx]), frame);
+      stolen = 1;
+    } else {
+      // it went idle since the search above, nothing to fade
+      voice_note_on(cur_idx, midi_param0, midi_param1, frame);
+    }
+  }
+  __enable_irq();
+  if(cur_idx < 0) {
     printf("Note on:  [NOPE] %d %d\r\n", midi_param0, midi_param1);
+  } else if(stolen) {
+    printf("Note on:  %d %d %d [steal]\r\n", cur_idx, midi_param0, midi_param1);
+  } else {
+    printf("Note on:  %d %d %d\r\n", cur_idx, midi_param0, midi_param1);
+    voice_list_add(cur_idx);
+  }
+}
+
+// ======================================================================
+// choose a voice to steal according to the_synth.steal.  voices that
+// are already fading out are never chosen.  returns -1 if none found.
+int8_t steal_voice(void)
+{
+  int8_t idx;
+  switch(the_synth.steal) {
+  case STEAL_OLDEST:
+    return find_oldest_voice();
+  case STEAL_QUIETEST:
+    return find_quietest_voice(0);
+  case STEAL_RELEASING:
+  default:
+    idx = find_quietest_voice(1);
+    if(idx < 0) {
+      idx = find_oldest_voice();
+    }
+    return idx;
+  }
+}
+
+int8_t find_oldest_voice(void)
+{
+  int8_t idx = -1;
+  for(int8_t j = 0; j < the_synth.voices; j++) {
+    adsr_state_t *env = &(the_synth.envelopes[j]);
+    if(adsr_fading(env)) {
+      continue;
+    }
+    if((idx < 0) || (env->start_frame < the_synth.envelopes[idx].start_frame)) {
+      idx = j;
+    }
+  }
+  return idx;
+}
+
+int8_t find_quietest_voice(uint8_t releasing_only)
+{
+  int8_t idx = -1;
+  float min_level = 0;
+  for(int8_t j = 0; j < the_synth.voices; j++) {
+    adsr_state_t *env = &(the_synth.envelopes[j]);
+    if(adsr_fading(env)) {
+      continue;
+    }
+    if(releasing_only && !adsr_releasing(env)) {
+      continue;
+    }
+    if((idx < 0) || (env->cur_amplitude < min_level)) {
+      idx = j;
+      min_level = env->cur_amplitude;
+    }
+  }
+  return idx;
+}
+
+// ======================================================================
+// start a note on a voice that is not being rendered.  any note still
+// waiting for the voice is dropped.
+void voice_note_on(uint8_t voice, int8_t pitch, int8_t velocity, int64_t frame)
+{
+  the_synth.pending_pitch[voice] = -1;
+  wavetable_note_on(&(the_synth.wavetables[voice]), pitch, velocity);
+  adsr_note_on(&(the_synth.envelopes[voice]), velocity, frame);
+  adsr_note_on(&(the_synth.filter_envelopes[voice]), 127, frame);
+  the_synth.velocity[voice] = velocity / 127.0f;
+  vcf_note_on(&(the_synth.vcf), voice, voice_cutoff(voice, 0.0f), the_synth.fresonance);
+}
+
+// ======================================================================
+// vcf cutoff for a voice with its filter envelope at env_level (0-1)
+float voice_cutoff(uint8_t voice, float env_level)
+{
+  float octaves = the_synth.fenv * env_level + the_synth.fvelocity * the_synth.velocity[voice];
+  return the_synth.fcutoff * exp2f(octaves);
+}
+
+// ======================================================================
+// Osc + Env + Mix for one voice in a single pass over inout_samples.
+// the envelope is split into ramps at its segment boundaries.
+void voice_mix_samples(uint8_t voice, float *inout_samples, int frame_count)
+{
+  if(the_synth.filter) {
+    voice_filter_mix_samples(voice, inout_samples, frame_count);
+    return;
+  }
+  wavetable_state_t *wt = &(the_synth.wavetables[voice]);
+  adsr_state_t *env = &(the_synth.envelopes[voice]);
+  int i = 0;
+  while(i < frame_count) {
+    adsr_ramp_t ramp;
+    int n = adsr_get_ramp(env, frame_count - i, &ramp);
+    if(n == 0) {
+      // idle for the rest of the block
+      break;
+    }
+    wavetable_mix_samples(wt, &(inout_samples[i]), n, &ramp);
+    adsr_end_ramp(env, n, ramp.level);
+    i += n;
   }
 }
 
+// ======================================================================
+// Osc -> Filter -> Env -> Mix for one voice.  the filter has to see the
+// raw oscillator, so this takes a pass per stage through voice_buffer.
+// the cutoff follows the filter envelope at the end of each block & the
+// vcf ramps to it across the block.
+void voice_filter_mix_samples(uint8_t voice, float *inout_samples, int frame_count)
+{
+  static float voice_buffer[AUDIO_BUFFER_FRAMES];
+  float env_level = adsr_advance(&(the_synth.filter_envelopes[voice]), frame_count);
+  vcf_set(&(the_synth.vcf), voice, voice_cutoff(voice, env_level), the_synth.fresonance);
+  wavetable_get_samples(&(the_synth.wavetables[voice]), &(voice_buffer[0]), frame_count);
+  vcf_process(&(the_synth.vcf), voice, &(voice_buffer[0]), frame_count);
+  adsr_mix_samples(&(the_synth.envelopes[voice]), &(voice_buffer[0]), inout_samples, frame_count);
+}
+
 // ======================================================================
 // using cur_phase, read from wave_table[] and update the
 // audio_buffer from start to start+num_frames
 void update_audio_buffer(uint32_t start_frame, uint32_t num_frames)
 {
   HAL_GPIO_WritePin(LED_Port, RED_LED, GPIO_PIN_SET);
-  // temp buffers to use for float intermediate data
-  static float sample_buffer[3][AUDIO_BUFFER_SAMPLES];
-
-  memset(&(sample_buffer[0][0]), 0, sizeof(float)*AUDIO_BUFFER_SAMPLES);
-  memset(&(sample_buffer[1][0]), 0, sizeof(float)*AUDIO_BUFFER_SAMPLES);
-  // Osc + Env -> buf1
-  for(int note = 0; note < MAX_POLYPHONY; note++) {
-    wavetable_get_samples(&(the_synth.wavetables[note]), &(sample_buffer[0][0]), num_frames);
-    adsr_get_samples(&(the_synth.envelopes[note]), &(sample_buffer[0][0]), num_frames, the_synth.synth_time);
-    for(int i = 0; i < num_frames; i++) {
-      sample_buffer[1][2*i] += sample_buffer[0][2*i];
-      sample_buffer[1][2*i+1] += sample_buffer[0][2*i+1];
+  uint32_t start_cycles = DWT->CYCCNT;
+  // temp buffers to use for float intermediate data.  voices are mixed
+  // in mono until the pan stage, after that the buffers are stereo.
+  static float mix_buffer[AUDIO_BUFFER_FRAMES];
+  static float sample_buffer[2][AUDIO_BUFFER_SAMPLES];
+
+  memset(&(mix_buffer[0]), 0, sizeof(float)*num_frames);
+  // Osc + Env -> mix, only for the voices that are sounding
+  int64_t end_frame = the_synth.synth_frame + num_frames;
+  uint8_t num_rendered = the_synth.num_active_voices;
+  uint8_t num_active = 0;
+  uint32_t voice_start_cycles = DWT->CYCCNT;
+  for(int v = 0; v < num_rendered; v++) {
+    uint8_t note = the_synth.active_voices[v];
+    voice_mix_samples(note, &(mix_buffer[0]), num_frames);
+    // keep the voice on the list until its release is done
+    if(adsr_active(&(the_synth.envelopes[note]))) {
+      the_synth.active_voices[num_active++] = note;
+    } else if(the_synth.pending_pitch[note] >= 0) {
+      // stolen voice has faded out, start its new note
+      voice_note_on(note, the_synth.pending_pitch[note], the_synth.pending_velocity[note], end_frame);
+      the_synth.active_voices[num_active++] = note;
     }
   }
-  // Reverb buf1 -> buf2
-  reverb_get_samples(the_synth.reverb, &(sample_buffer[1][0]), &(sample_buffer[2][0]), num_frames);
+  the_synth.num_active_voices = num_active;
+  the_synth.stats.voice_cycles += DWT->CYCCNT - voice_start_cycles;
+  the_synth.stats.voice_blocks += num_rendered;
 
-  // RLPF buf2 -> buf1
-  sf_biquad_process(&(the_synth.rlpf), num_frames, (sf_sample_st *)&(sample_buffer[2][0]), (sf_sample_st *)&(sample_buffer[1][0]));
+  // Pan mix -> buf0 (center)
+  for(int i = 0; i < num_frames; i++) {
+    sample_buffer[0][2*i]   = mix_buffer[i];
+    sample_buffer[0][2*i+1] = mix_buffer[i];
+  }
 
-  // convert buf1 -> uint16 output buffer
-  int i = 0;
+  // Reverb buf0 -> buf1
+  if(the_synth.verb == REVERB_FDN) {
+    fdn_get_samples(&(the_synth.fdn), &(sample_buffer[0][0]), &(sample_buffer[1][0]), num_frames);
+  } else {
+    reverb_get_samples(the_synth.reverb, &(sample_buffer[0][0]), &(sample_buffer[1][0]), num_frames);
+  }
+
+  // RLPF buf1 -> buf0, skipped entirely when disabled
   int outidx = 1;
+  if(the_synth.enable_rlpf) {
+    if(rlpf_uses_svf()) {
+      svf_process(&(the_synth.rsvf), num_frames, (sf_sample_st *)&(sample_buffer[1][0]), (sf_sample_st *)&(sample_buffer[0][0]));
+    } else {
+#if SYNTH_RLPF_FIXED
+      sf_biquad_fixed_process(&(the_synth.rlpf_fixed), num_frames, (sf_sample_st *)&(sample_buffer[1][0]), (sf_sample_st *)&(sample_buffer[0][0]));
+#else
+      sf_biquad_process(&(the_synth.rlpf), num_frames, (sf_sample_st *)&(sample_buffer[1][0]), (sf_sample_st *)&(sample_buffer[0][0]));
+#endif
+    }
+    outidx = 0;
+  }
+
+  // EQ buf[outidx] in place, skipped when every band is flat
+  eq_process(&(the_synth.eq), &(sample_buffer[outidx][0]), num_frames);
+
+  // convert buf[outidx] -> uint16 output buffer
+  int i = 0;
   for(int frame = start_frame; frame < start_frame+num_frames; frame++) {
     float sample0_f = sample_buffer[outidx][2*i];
     float sample1_f = sample_buffer[outidx][2*i+1];
@@ -286,6 +875,17 @@ void update_audio_buffer(uint32_t start_frame, uint32_t num_frames)
     audio_buffer[2*frame+1] = float2uint16(sample1_f);
     i++;
   }
+
+  uint32_t cycles = DWT->CYCCNT - start_cycles;
+  the_synth.stats.blocks++;
+  the_synth.stats.voices_rendered = num_rendered;
+  if(num_rendered > the_synth.stats.max_voices_rendered) {
+    the_synth.stats.max_voices_rendered = num_rendered;
+  }
+  the_synth.stats.cycles = cycles;
+  if(cycles > the_synth.stats.max_cycles) {
+    the_synth.stats.max_cycles = cycles;
+  }
   HAL_GPIO_WritePin(LED_Port, RED_LED, GPIO_PIN_RESET);
 }
 
@@ -295,7 +895,7 @@ void update_audio_buffer(uint32_t start_frame, uint32_t num_frames)
 void BSP_AUDIO_OUT_HalfTransfer_CallBack(void)
 {
   update_audio_buffer(0, AUDIO_BUFFER_FRAMES/2);
-  the_synth.synth_time += (float)(AUDIO_BUFFER_FRAMES/2)/FRAME_RATE;
+  the_synth.synth_frame += AUDIO_BUFFER_FRAMES/2;
 }
 
 // ======================================================================
@@ -304,7 +904,7 @@ void BSP_AUDIO_OUT_HalfTransfer_CallBack(void)
 void BSP_AUDIO_OUT_TransferComplete_CallBack(void)
 {
   update_audio_buffer(AUDIO_BUFFER_FRAMES/2, AUDIO_BUFFER_FRAMES/2);
-  the_synth.synth_time += (float)(AUDIO_BUFFER_FRAMES/2)/FRAME_RATE;
+  the_synth.synth_frame += AUDIO_BUFFER_FRAMES/2;
 }
 
 // ======================================================================
@@ -0,0 +1,100 @@
+/*
+ * vcf.c
+ *
+ *  Created on: Oct 17, 2026
+ *      Author: agent
+ */
+
+#include "vcf.h"
+#include "biquad.h"
+#include "synthutil.h"
+#include <string.h>
+
+// ======================================================================
+// private defines
+
+// highest cutoff vcf_set designs for.  sf_lowpass uses w0 = 2 pi
+// cutoff / nyquist, so above a quarter of the rate the poles leave the
+// unit circle (& at nyquist it becomes a passthrough, which the b0 only
+// bank can't hold).  stay a little below it: the poles are then inside
+// a radius of 0.9994 up to 40 dB of resonance.
+#define VCF_MAX_CUTOFF (0.24f * FRAME_RATE)
+
+// ======================================================================
+void vcf_init(vcf_bank_t *self)
+{
+  memset(self, 0, sizeof(vcf_bank_t));
+}
+
+// ======================================================================
+// start a new note on voice: clear its history & go straight to the
+// design without a ramp.
+void vcf_note_on(vcf_bank_t *self, uint8_t voice, float cutoff, float resonance)
+{
+  vcf_set(self, voice, cutoff, resonance);
+  self->b0[voice] = self->tb0[voice];
+  self->a1[voice] = self->ta1[voice];
+  self->a2[voice] = self->ta2[voice];
+  self->x1[voice] = 0.0f;
+  self->x2[voice] = 0.0f;
+  self->y1[voice] = 0.0f;
+  self->y2[voice] = 0.0f;
+}
+
+// ======================================================================
+// set the design the voice ramps to over the next vcf_process.
+// cutoff in Hz, resonance in dB, same as sf_lowpass.  the cutoff is
+// limited to VCF_MAX_CUTOFF.
+void vcf_set(vcf_bank_t *self, uint8_t voice, float cutoff, float resonance)
+{
+  if(!(cutoff < VCF_MAX_CUTOFF)) {
+    // written this way round so inf & NaN are caught too
+    cutoff = VCF_MAX_CUTOFF;
+  }
+  sf_biquad_state_st design;
+  sf_lowpass_fast(&design, FRAME_RATE, cutoff, resonance);
+  self->tb0[voice] = design.b0;
+  self->ta1[voice] = design.a1;
+  self->ta2[voice] = design.a2;
+}
+
+// ======================================================================
+// filter the mono inout_samples in place, ramping the coefficients to
+// their targets.
+void vcf_process(vcf_bank_t *self, uint8_t voice, float *inout_samples, int frame_count)
+{
+  if(frame_count <= 0) {
+    return;
+  }
+  float b0 = self->b0[voice];
+  float a1 = self->a1[voice];
+  float a2 = self->a2[voice];
+  float inv = 1.0f / frame_count;
+  float db0 = (self->tb0[voice] - b0) * inv;
+  float da1 = (self->ta1[voice] - a1) * inv;
+  float da2 = (self->ta2[voice] - a2) * inv;
+  float x1 = self->x1[voice];
+  float x2 = self->x2[voice];
+  float y1 = self->y1[voice];
+  float y2 = self->y2[voice];
+  for(int i = 0; i < frame_count; i++) {
+    b0 += db0;
+    a1 += da1;
+    a2 += da2;
+    float x0 = inout_samples[i];
+    float y0 = b0 * (x0 + 2.0f * x1 + x2) - a1 * y1 - a2 * y2;
+    inout_samples[i] = y0;
+    x2 = x1;
+    x1 = x0;
+    y2 = y1;
+    y1 = y0;
+  }
+  // land exactly on the targets
+  self->b0[voice] = self->tb0[voice];
+  self->a1[voice] = self->ta1[voice];
+  self->a2[voice] = self->ta2[voice];
+  self->x1[voice] = x1;
+  self->x2[voice] = x2;
+  self->y1[voice] = y1;
+  self->y2[voice] = y2;
+}
@@ -7,47 +7,129 @@
 
 #include "wavetable.h"
 #include "synthutil.h"
-#include <math.h>
-#include <string.h>
 
 // ======================================================================
 // private defines
 
 // ======================================================================
-// private vars
-static uint8_t wavetables_initialized = 0;
+// private prototypes & functions
+uint32_t freq_to_phase_inc(float freq);
+int mip_harmonics(int level);
+uint8_t mip_level_for(uint32_t phase_inc);
+float wavetable_lookup(const float *table, uint32_t phase);
+uint8_t wave_index(wavetable_state_t *self);
 
 // ======================================================================
-// private prototypes & functions
-void wavetable_sine_init(void);
-void wavetable_saw_init(void);
+// number of harmonics in a mip level.  level 0 is limited by the table
+// length, which can hold up to WAVE_TABLE_LENGTH/2 - 1 harmonics.
+// wavetable_gen.py must agree with this.
+inline int mip_harmonics(int level)
+{
+  return (WAVE_TABLE_LENGTH/2 - 1) >> level;
+}
 
 // ======================================================================
-// create a wave_table with a single sine wave cycle.
-// values are stored as float to make further math easy.
-void wavetable_sine_init(void)
+// pick the level with the most harmonics that all stay below nyquist.
+// nyquist is a phase_inc of 2^31.
+uint8_t mip_level_for(uint32_t phase_inc)
 {
-  float phase_inc = (2.0f * (float)M_PI) / (float)WAVE_TABLE_LENGTH;
-  float phase = 0;
-  for (int i = 0; i < WAVE_TABLE_LENGTH; i++) {
-    sine_wave_table[i] = sin(phase);
-    phase += phase_inc;
+  uint8_t level = 0;
+  while ((level < WAVE_MIP_LEVELS - 1) &&
+         ((uint64_t)phase_inc * mip_harmonics(level) > (1ULL << 31))) {
+    level++;
   }
+  return level;
 }
 
-void wavetable_saw_init(void)
+// ======================================================================
+// phase_inc is the fraction of a cycle per frame, scaled by 2^32
+inline uint32_t freq_to_phase_inc(float freq)
 {
-  memset(saw_wave_table, 0, sizeof(float) * WAVE_TABLE_LENGTH);
-  float num_octaves = (int)(FRAME_RATE / 2.0 / 440.0);
-  for (int octave = 1; octave < num_octaves; octave++) {
-    float phase_inc = (octave * 2.0 * (float)M_PI) / (float)WAVE_TABLE_LENGTH;
-    float phase = 0;
-    float sign = (octave & 1) ? -1.0f : 1.0f;
-    for (int i = 0; i < WAVE_TABLE_LENGTH; i++) {
-      saw_wave_table[i] += (sign * sin(phase) / octave) * (2.0f / (float)M_PI);
-      phase += phase_inc;
-    }
-  }
+  return (uint32_t)((freq / FRAME_RATE) * 4294967296.0f);
+}
+
+// ======================================================================
+// linear interpolation between the two table entries around phase
+inline float wavetable_lookup(const float *table, uint32_t phase)
+{
+  uint32_t idx = phase >> WAVE_PHASE_FRAC_BITS;
+  float frac = (float)(phase & WAVE_PHASE_FRAC_MASK) * (1.0f / (float)(1UL << WAVE_PHASE_FRAC_BITS));
+  float a = table[idx];
+  return a + (table[idx + 1] - a) * frac;
+}
+
+// ======================================================================
+// per-waveform kernels.  WAVE_KERNELS(name, table) defines the kernels
+// for one waveform, where table is the expression for the voice's table.
+// the waveform & envelope curve are fixed in each kernel, so its loop has
+// no branches & the table pointer & ramp steps stay in registers.
+// to add a waveform, add a WAVE_KERNELS line & its entry in wave_kernels[].
+#define WAVE_KERNELS(name, table_expr)                                   \
+static void name##_get(wavetable_state_t *self, float *out_samples, int frame_count) \
+{                                                                        \
+  const float *table = (table_expr);                                     \
+  uint32_t phase = self->phase;                                          \
+  uint32_t phase_inc = self->phase_inc;                                  \
+  for(int frame = 0; frame < frame_count; frame++) {                     \
+    out_samples[frame] = wavetable_lookup(table, phase);                 \
+    phase += phase_inc; /* wraps around at the end of the cycle */       \
+  }                                                                      \
+  self->phase = phase;                                                   \
+}                                                                        \
+static void name##_mix_linear(wavetable_state_t *self, float *inout_samples, int frame_count, adsr_ramp_t *ramp) \
+{                                                                        \
+  const float *table = (table_expr);                                     \
+  uint32_t phase = self->phase;                                          \
+  uint32_t phase_inc = self->phase_inc;                                  \
+  float level = ramp->level;                                             \
+  float inc = ramp->inc;                                                 \
+  for(int frame = 0; frame < frame_count; frame++) {                     \
+    inout_samples[frame] += wavetable_lookup(table, phase) * level;      \
+    level += inc;                                                        \
+    phase += phase_inc;                                                  \
+  }                                                                      \
+  self->phase = phase;                                                   \
+  ramp->level = level;                                                   \
+}                                                                        \
+static void name##_mix_exp(wavetable_state_t *self, float *inout_samples, int frame_count, adsr_ramp_t *ramp) \
+{                                                                        \
+  const float *table = (table_expr);                                     \
+  uint32_t phase = self->phase;                                          \
+  uint32_t phase_inc = self->phase_inc;                                  \
+  float level = ramp->level;                                             \
+  float coef = ramp->coef;                                               \
+  float base = ramp->base;                                               \
+  for(int frame = 0; frame < frame_count; frame++) {                     \
+    inout_samples[frame] += wavetable_lookup(table, phase) * level;      \
+    level = level * coef + base;                                         \
+    phase += phase_inc;                                                  \
+  }                                                                      \
+  self->phase = phase;                                                   \
+  ramp->level = level;                                                   \
+}
+
+#define WAVE_KERNELS_ENTRY(name) { name##_get, name##_mix_linear, name##_mix_exp }
+
+typedef struct {
+  void (*get)(wavetable_state_t *self, float *out_samples, int frame_count);
+  void (*mix_linear)(wavetable_state_t *self, float *inout_samples, int frame_count, adsr_ramp_t *ramp);
+  void (*mix_exp)(wavetable_state_t *self, float *inout_samples, int frame_count, adsr_ramp_t *ramp);
+} wave_kernels_t;
+
+WAVE_KERNELS(sine, sine_wave_table)
+WAVE_KERNELS(saw,  saw_wave_table[self->mip_level])
+
+// indexed by wavetable_state_t.wave
+static const wave_kernels_t wave_kernels[NUM_WAVES] = {
+  WAVE_KERNELS_ENTRY(sine), // WAVE_SINE
+  WAVE_KERNELS_ENTRY(saw),  // WAVE_SAW
+};
+
+// ======================================================================
+// unknown waves play as saw
+inline uint8_t wave_index(wavetable_state_t *self)
+{
+  return (self->wave < NUM_WAVES) ? self->wave : WAVE_SAW;
 }
 
 // ======================================================================
@@ -57,16 +139,12 @@ void wavetable_saw_init(void)
 // ======================================================================
 void wavetable_init(wavetable_state_t *self, uint8_t wave)
 {
-  if(!wavetables_initialized) {
-    wavetable_sine_init();
-    wavetable_saw_init();
-    wavetables_initialized = 1;
-  }
   self->wave      = wave;
   self->phase     = 0;
   self->pitch     = 0;
   self->pitch_hz  = pitch_to_freq(A4);
-  self->phase_inc = (self->pitch_hz / FRAME_RATE) * WAVE_TABLE_LENGTH;
+  self->phase_inc = freq_to_phase_inc(self->pitch_hz);
+  self->mip_level = mip_level_for(self->phase_inc);
 }
 
 // ======================================================================
@@ -75,7 +153,8 @@ void wavetable_note_on(wavetable_state_t *self, int8_t pitch, int8_t velocity)
   self->phase     = 0;
   self->pitch     = pitch;
   self->pitch_hz  = pitch_to_freq(pitch);
-  self->phase_inc = (self->pitch_hz / FRAME_RATE) * WAVE_TABLE_LENGTH;
+  self->phase_inc = freq_to_phase_inc(self->pitch_hz);
+  self->mip_level = mip_level_for(self->phase_inc);
 }
 
 // ======================================================================
@@ -84,28 +163,27 @@ void wavetable_note_off(wavetable_state_t *self)
   self->phase     = 0;
   self->pitch     = 0;
   self->pitch_hz  = pitch_to_freq(A4);
-  self->phase_inc = (self->pitch_hz / FRAME_RATE) * WAVE_TABLE_LENGTH;
+  self->phase_inc = freq_to_phase_inc(self->pitch_hz);
+  self->mip_level = mip_level_for(self->phase_inc);
 }
 
 // ======================================================================
+// out_samples is mono, one sample per frame
 void wavetable_get_samples(wavetable_state_t *self, float *out_samples, int frame_count)
 {
-  for(int frame = 0; frame < frame_count; frame++) {
-    float sample_f;
-    switch(self->wave) {
-    case 0:
-      sample_f = sine_wave_table[(uint32_t)self->phase];
-      break;
-    case 1:
-    default:
-      sample_f = saw_wave_table[(uint32_t)self->phase];
-      break;
-    }
-    out_samples[2*frame]   = sample_f;
-    out_samples[2*frame+1] = sample_f;
-    self->phase += self->phase_inc;
-    if(self->phase > WAVE_TABLE_LENGTH) {
-      self->phase -= WAVE_TABLE_LENGTH;
-    }
+  wave_kernels[wave_index(self)].get(self, out_samples, frame_count);
+}
+
+// ======================================================================
+// voice kernel: read the wavetable, apply the envelope ramp & add into
+// the mono inout_samples, all in one pass.  ramp->level is updated to
+// the level after the last frame.
+void wavetable_mix_samples(wavetable_state_t *self, float *inout_samples, int frame_count, adsr_ramp_t *ramp)
+{
+  const wave_kernels_t *kernels = &(wave_kernels[wave_index(self)]);
+  if(ramp->curve == ADSR_CURVE_EXP) {
+    kernels->mix_exp(self, inout_samples, frame_count, ramp);
+  } else {
+    kernels->mix_linear(self, inout_samples, frame_count, ramp);
   }
 }
@@ -0,0 +1,1325 @@
+/*
+ * wavetable_data.c
+ *
+ * GENERATED by wavetable_gen.py -- do not edit.
+ */
+
+#include "wavetable.h"
+
+#if WAVE_TABLE_BITS != 10
+#error wavetable_data.c is out of date, rerun wavetable_gen.py
+#endif
+
+const float sine_wave_table[WAVE_TABLE_LENGTH + 1] = {
+   0.000000000e+00f,  6.135884649e-03f,  1.227153829e-02f,  1.840672991e-02f,  2.454122852e-02f,  3.067480318e-02f,  3.680722294e-02f,  4.293825693e-02f,
+   4.906767433e-02f,  5.519524435e-02f,  6.132073630e-02f,  6.744391956e-02f,  7.356456360e-02f,  7.968243797e-02f,  8.579731234e-02f,  9.190895650e-02f,
+   9.801714033e-02f,  1.041216339e-01f,  1.102222073e-01f,  1.163186309e-01f,  1.224106752e-01f,  1.284981108e-01f,  1.345807085e-01f,  1.406582393e-01f,
+   1.467304745e-01f,  1.527971853e-01f,  1.588581433e-01f,  1.649131205e-01f,  1.709618888e-01f,  1.770042204e-01f,  1.830398880e-01f,  1.890686641e-01f,
+   1.950903220e-01f,  2.011046348e-01f,  2.071113762e-01f,  2.131103199e-01f,  2.191012402e-01f,  2.250839114e-01f,  2.310581083e-01f,  2.370236060e-01f,
+   2.429801799e-01f,  2.489276057e-01f,  2.548656596e-01f,  2.607941179e-01f,  2.667127575e-01f,  2.726213554e-01f,  2.785196894e-01f,  2.844075372e-01f,
+   2.902846773e-01f,  2.961508882e-01f,  3.020059493e-01f,  3.078496400e-01f,  3.136817404e-01f,  3.195020308e-01f,  3.253102922e-01f,  3.311063058e-01f,
+   3.368898534e-01f,  3.426607173e-01f,  3.484186802e-01f,  3.541635254e-01f,  3.598950365e-01f,  3.656129978e-01f,  3.713171940e-01f,  3.770074102e-01f,
+   3.826834324e-01f,  3.883450467e-01f,  3.939920401e-01f,  3.996241998e-01f,  4.052413140e-01f,  4.108431711e-01f,  4.164295601e-01f,  4.220002708e-01f,
+   4.275550934e-01f,  4.330938189e-01f,  4.386162385e-01f,  4.441221446e-01f,  4.496113297e-01f,  4.550835871e-01f,  4.605387110e-01f,  4.659764958e-01f,
+   4.713967368e-01f,  4.767992301e-01f,  4.821837721e-01f,  4.875501601e-01f,  4.928981922e-01f,  4.982276670e-01f,  5.035383837e-01f,  5.088301425e-01f,
+   5.141027442e-01f,  5.193559902e-01f,  5.245896827e-01f,  5.298036247e-01f,  5.349976199e-01f,  5.401714727e-01f,  5.453249884e-01f,  5.504579729e-01f,
+   5.555702330e-01f,  5.606615762e-01f,  5.657318108e-01f,  5.707807459e-01f,  5.758081914e-01f,  5.808139581e-01f,  5.857978575e-01f,  5.907597019e-01f,
+   5.956993045e-01f,  6.006164794e-01f,  6.055110414e-01f,  6.103828063e-01f,  6.152315906e-01f,  6.200572118e-01f,  6.248594881e-01f,  6.296382389e-01f,
+   6.343932842e-01f,  6.391244449e-01f,  6.438315429e-01f,  6.485144010e-01f,  6.531728430e-01f,  6.578066933e-01f,  6.624157776e-01f,  6.669999223e-01f,
+   6.715589548e-01f,  6.760927036e-01f,  6.806009978e-01f,  6.850836678e-01f,  6.895405447e-01f,  6.939714609e-01f,  6.983762494e-01f,  7.027547445e-01f,
+   7.071067812e-01f,  7.114321957e-01f,  7.157308253e-01f,  7.200025080e-01f,  7.242470830e-01f,  7.284643904e-01f,  7.326542717e-01f,  7.368165689e-01f,
+   7.409511254e-01f,  7.450577854e-01f,  7.491363945e-01f,  7.531867990e-01f,  7.572088465e-01f,  7.612023855e-01f,  7.651672656e-01f,  7.691033376e-01f,
+   7.730104534e-01f,  7.768884657e-01f,  7.807372286e-01f,  7.845565972e-01f,  7.883464276e-01f,  7.921065773e-01f,  7.958369046e-01f,  7.995372691e-01f,
+   8.032075315e-01f,  8.068475535e-01f,  8.104571983e-01f,  8.140363297e-01f,  8.175848132e-01f,  8.211025150e-01f,  8.245893028e-01f,  8.280450453e-01f,
+   8.314696123e-01f,  8.348628750e-01f,  8.382247056e-01f,  8.415549774e-01f,  8.448535652e-01f,  8.481203448e-01f,  8.513551931e-01f,  8.545579884e-01f,
+   8.577286100e-01f,  8.608669386e-01f,  8.639728561e-01f,  8.670462455e-01f,  8.700869911e-01f,  8.730949784e-01f,  8.760700942e-01f,  8.790122264e-01f,
+   8.819212643e-01f,  8.847970984e-01f,  8.876396204e-01f,  8.904487232e-01f,  8.932243012e-01f,  8.959662498e-01f,  8.986744657e-01f,  9.013488470e-01f,
+   9.039892931e-01f,  9.065957045e-01f,  9.091679831e-01f,  9.117060320e-01f,  9.142097557e-01f,  9.166790599e-01f,  9.191138517e-01f,  9.215140393e-01f,
+   9.238795325e-01f,  9.262102421e-01f,  9.285060805e-01f,  9.307669611e-01f,  9.329927988e-01f,  9.351835099e-01f,  9.373390119e-01f,  9.394592236e-01f,
+   9.415440652e-01f,  9.435934582e-01f,  9.456073254e-01f,  9.475855910e-01f,  9.495281806e-01f,  9.514350210e-01f,  9.533060404e-01f,  9.551411683e-01f,
+   9.569403357e-01f,  9.587034749e-01f,  9.604305194e-01f,  9.621214043e-01f,  9.637760658e-01f,  9.653944417e-01f,  9.669764710e-01f,  9.685220943e-01f,
+   9.700312532e-01f,  9.715038910e-01f,  9.729399522e-01f,  9.743393828e-01f,  9.757021300e-01f,  9.770281427e-01f,  9.783173707e-01f,  9.795697657e-01f,
+   9.807852804e-01f,  9.819638691e-01f,  9.831054874e-01f,  9.842100924e-01f,  9.852776424e-01f,  9.863080972e-01f,  9.873014182e-01f,  9.882575677e-01f,
+   9.891765100e-01f,  9.900582103e-01f,  9.909026354e-01f,  9.917097537e-01f,  9.924795346e-01f,  9.932119492e-01f,  9.939069700e-01f,  9.945645707e-01f,
+   9.951847267e-01f,  9.957674145e-01f,  9.963126122e-01f,  9.968202993e-01f,  9.972904567e-01f,  9.977230666e-01f,  9.981181129e-01f,  9.984755806e-01f,
+   9.987954562e-01f,  9.990777278e-01f,  9.993223846e-01f,  9.995294175e-01f,  9.996988187e-01f,  9.998305818e-01f,  9.999247018e-01f,  9.999811753e-01f,
+   1.000000000e+00f,  9.999811753e-01f,  9.999247018e-01f,  9.998305818e-01f,  9.996988187e-01f,  9.995294175e-01f,  9.993223846e-01f,  9.990777278e-01f,
+   9.987954562e-01f,  9.984755806e-01f,  9.981181129e-01f,  9.977230666e-01f,  9.972904567e-01f,  9.968202993e-01f,  9.963126122e-01f,  9.957674145e-01f,
+   9.951847267e-01f,  9.945645707e-01f,  9.939069700e-01f,  9.932119492e-01f,  9.924795346e-01f,  9.917097537e-01f,  9.909026354e-01f,  9.900582103e-01f,
+   9.891765100e-01f,  9.882575677e-01f,  9.873014182e-01f,  9.863080972e-01f,  9.852776424e-01f,  9.842100924e-01f,  9.831054874e-01f,  9.819638691e-01f,
+   9.807852804e-01f,  9.795697657e-01f,  9.783173707e-01f,  9.770281427e-01f,  9.757021300e-01f,  9.743393828e-01f,  9.729399522e-01f,  9.715038910e-01f,
+   9.700312532e-01f,  9.685220943e-01f,  9.669764710e-01f,  9.653944417e-01f,  9.637760658e-01f,  9.621214043e-01f,  9.604305194e-01f,  9.587034749e-01f,
+   9.569403357e-01f,  9.551411683e-01f,  9.533060404e-01f,  9.514350210e-01f,  9.495281806e-01f,  9.475855910e-01f,  9.456073254e-01f,  9.435934582e-01f,
+   9.415440652e-01f,  9.394592236e-01f,  9.373390119e-01f,  9.351835099e-01f,  9.329927988e-01f,  9.307669611e-01f,  9.285060805e-01f,  9.262102421e-01f,
+   9.238795325e-01f,  9.215140393e-01f,  9.191138517e-01f,  9.166790599e-01f,  9.142097557e-01f,  9.117060320e-01f,  9.091679831e-01f,  9.065957045e-01f,
+   9.039892931e-01f,  9.013488470e-01f,  8.986744657e-01f,  8.959662498e-01f,  8.932243012e-01f,  8.904487232e-01f,  8.876396204e-01f,  8.847970984e-01f,
+   8.819212643e-01f,  8.790122264e-01f,  8.760700942e-01f,  8.730949784e-01f,  8.700869911e-01f,  8.670462455e-01f,  8.639728561e-01f,  8.608669386e-01f,
+   8.577286100e-01f,  8.545579884e-01f,  8.513551931e-01f,  8.481203448e-01f,  8.448535652e-01f,  8.415549774e-01f,  8.382247056e-01f,  8.348628750e-01f,
+   8.314696123e-01f,  8.280450453e-01f,  8.245893028e-01f,  8.211025150e-01f,  8.175848132e-01f,  8.140363297e-01f,  8.104571983e-01f,  8.068475535e-01f,
+   8.032075315e-01f,  7.995372691e-01f,  7.958369046e-01f,  7.921065773e-01f,  7.883464276e-01f,  7.845565972e-01f,  7.807372286e-01f,  7.768884657e-01f,
+   7.730104534e-01f,  7.691033376e-01f,  7.651672656e-01f,  7.612023855e-01f,  7.572088465e-01f,  7.531867990e-01f,  7.491363945e-01f,  7.450577854e-01f,
+   7.409511254e-01f,  7.368165689e-01f,  7.326542717e-01f,  7.284643904e-01f,  7.242470830e-01f,  7.200025080e-01f,  7.157308253e-01f,  7.114321957e-01f,
+   7.071067812e-01f,  7.027547445e-01f,  6.983762494e-01f,  6.939714609e-01f,  6.895405447e-01f,  6.850836678e-01f,  6.806009978e-01f,  6.760927036e-01f,
+   6.715589548e-01f,  6.669999223e-01f,  6.624157776e-01f,  6.578066933e-01f,  6.531728430e-01f,  6.485144010e-01f,  6.438315429e-01f,  6.391244449e-01f,
+   6.343932842e-01f,  6.296382389e-01f,  6.248594881e-01f,  6.200572118e-01f,  6.152315906e-01f,  6.103828063e-01f,  6.055110414e-01f,  6.006164794e-01f,
+   5.956993045e-01f,  5.907597019e-01f,  5.857978575e-01f,  5.808139581e-01f,  5.758081914e-01f,  5.707807459e-01f,  5.657318108e-01f,  5.606615762e-01f,
+   5.555702330e-01f,  5.504579729e-01f,  5.453249884e-01f,  5.401714727e-01f,  5.349976199e-01f,  5.298036247e-01f,  5.245896827e-01f,  5.193559902e-01f,
+   5.141027442e-01f,  5.088301425e-01f,  5.035383837e-01f,  4.982276670e-01f,  4.928981922e-01f,  4.875501601e-01f,  4.821837721e-01f,  4.767992301e-01f,
+   4.713967368e-01f,  4.659764958e-01f,  4.605387110e-01f,  4.550835871e-01f,  4.496113297e-01f,  4.441221446e-01f,  4.386162385e-01f,  4.330938189e-01f,
+   4.275550934e-01f,  4.220002708e-01f,  4.164295601e-01f,  4.108431711e-01f,  4.052413140e-01f,  3.996241998e-01f,  3.939920401e-01f,  3.883450467e-01f,
+   3.826834324e-01f,  3.770074102e-01f,  3.713171940e-01f,  3.656129978e-01f,  3.598950365e-01f,  3.541635254e-01f,  3.484186802e-01f,  3.426607173e-01f,
+   3.368898534e-01f,  3.311063058e-01f,  3.253102922e-01f,  3.195020308e-01f,  3.136817404e-01f,  3.078496400e-01f,  3.020059493e-01f,  2.961508882e-01f,
+   2.902846773e-01f,  2.844075372e-01f,  2.785196894e-01f,  2.726213554e-01f,  2.667127575e-01f,  2.607941179e-01f,  2.548656596e-01f,  2.489276057e-01f,
+   2.429801799e-01f,  2.370236060e-01f,  2.310581083e-01f,  2.250839114e-01f,  2.191012402e-01f,  2.131103199e-01f,  2.071113762e-01f,  2.011046348e-01f,
+   1.950903220e-01f,  1.890686641e-01f,  1.830398880e-01f,  1.770042204e-01f,  1.709618888e-01f,  1.649131205e-01f,  1.588581433e-01f,  1.527971853e-01f,
+   1.467304745e-01f,  1.406582393e-01f,  1.345807085e-01f,  1.284981108e-01f,  1.224106752e-01f,  1.163186309e-01f,  1.102222073e-01f,  1.041216339e-01f,
+   9.801714033e-02f,  9.190895650e-02f,  8.579731234e-02f,  7.968243797e-02f,  7.356456360e-02f,  6.744391956e-02f,  6.132073630e-02f,  5.519524435e-02f,
+   4.906767433e-02f,  4.293825693e-02f,  3.680722294e-02f,  3.067480318e-02f,  2.454122852e-02f,  1.840672991e-02f,  1.227153829e-02f,  6.135884649e-03f,
+   1.224646799e-16f, -6.135884649e-03f, -1.227153829e-02f, -1.840672991e-02f, -2.454122852e-02f, -3.067480318e-02f, -3.680722294e-02f, -4.293825693e-02f,
+  -4.906767433e-02f, -5.519524435e-02f, -6.132073630e-02f, -6.744391956e-02f, -7.356456360e-02f, -7.968243797e-02f, -8.579731234e-02f, -9.190895650e-02f,
+  -9.801714033e-02f, -1.041216339e-01f, -1.102222073e-01f, -1.163186309e-01f, -1.224106752e-01f, -1.284981108e-01f, -1.345807085e-01f, -1.406582393e-01f,
+  -1.467304745e-01f, -1.527971853e-01f, -1.588581433e-01f, -1.649131205e-01f, -1.709618888e-01f, -1.770042204e-01f, -1.830398880e-01f, -1.890686641e-01f,
+  -1.950903220e-01f, -2.011046348e-01f, -2.071113762e-01f, -2.131103199e-01f, -2.191012402e-01f, -2.250839114e-01f, -2.310581083e-01f, -2.370236060e-01f,
+  -2.429801799e-01f, -2.489276057e-01f, -2.548656596e-01f, -2.607941179e-01f, -2.667127575e-01f, -2.726213554e-01f, -2.785196894e-01f, -2.844075372e-01f,
+  -2.902846773e-01f, -2.961508882e-01f, -3.020059493e-01f, -3.078496400e-01f, -3.136817404e-01f, -3.195020308e-01f, -3.253102922e-01f, -3.311063058e-01f,
+  -3.368898534e-01f, -3.426607173e-01f, -3.484186802e-01f, -3.541635254e-01f, -3.598950365e-01f, -3.656129978e-01f, -3.713171940e-01f, -3.770074102e-01f,
+  -3.826834324e-01f, -3.883450467e-01f, -3.939920401e-01f, -3.996241998e-01f, -4.052413140e-01f, -4.108431711e-01f, -4.164295601e-01f, -4.220002708e-01f,
+  -4.275550934e-01f, -4.330938189e-01f, -4.386162385e-01f, -4.441221446e-01f, -4.496113297e-01f, -4.550835871e-01f, -4.605387110e-01f, -4.659764958e-01f,
+  -4.713967368e-01f, -4.767992301e-01f, -4.821837721e-01f, -4.875501601e-01f, -4.928981922e-01f, -4.982276670e-01f, -5.035383837e-01f, -5.088301425e-01f,
+  -5.141027442e-01f, -5.193559902e-01f, -5.245896827e-01f, -5.298036247e-01f, -5.349976199e-01f, -5.401714727e-01f, -5.453249884e-01f, -5.504579729e-01f,
+  -5.555702330e-01f, -5.606615762e-01f, -5.657318108e-01f, -5.707807459e-01f, -5.758081914e-01f, -5.808139581e-01f, -5.857978575e-01f, -5.907597019e-01f,
+  -5.956993045e-01f, -6.006164794e-01f, -6.055110414e-01f, -6.103828063e-01f, -6.152315906e-01f, -6.200572118e-01f, -6.248594881e-01f, -6.296382389e-01f,
+  -6.343932842e-01f, -6.391244449e-01f, -6.438315429e-01f, -6.485144010e-01f, -6.531728430e-01f, -6.578066933e-01f, -6.624157776e-01f, -6.669999223e-01f,
+  -6.715589548e-01f, -6.760927036e-01f, -6.806009978e-01f, -6.850836678e-01f, -6.895405447e-01f, -6.939714609e-01f, -6.983762494e-01f, -7.027547445e-01f,
+  -7.071067812e-01f, -7.114321957e-01f, -7.157308253e-01f, -7.200025080e-01f, -7.242470830e-01f, -7.284643904e-01f, -7.326542717e-01f, -7.368165689e-01f,
+  -7.409511254e-01f, -7.450577854e-01f, -7.491363945e-01f, -7.531867990e-01f, -7.572088465e-01f, -7.612023855e-01f, -7.651672656e-01f, -7.691033376e-01f,
+  -7.730104534e-01f, -7.768884657e-01f, -7.807372286e-01f, -7.845565972e-01f, -7.883464276e-01f, -7.921065773e-01f, -7.958369046e-01f, -7.995372691e-01f,
+  -8.032075315e-01f, -8.068475535e-01f, -8.104571983e-01f, -8.140363297e-01f, -8.175848132e-01f, -8.211025150e-01f, -8.245893028e-01f, -8.280450453e-01f,
+  -8.314696123e-01f, -8.348628750e-01f, -8.382247056e-01f, -8.415549774e-01f, -8.448535652e-01f, -8.481203448e-01f, -8.513551931e-01f, -8.545579884e-01f,
+  -8.577286100e-01f, -8.608669386e-01f, -8.639728561e-01f, -8.670462455e-01f, -8.700869911e-01f, -8.730949784e-01f, -8.760700942e-01f, -8.790122264e-01f,
+  -8.819212643e-01f, -8.847970984e-01f, -8.876396204e-01f, -8.904487232e-01f, -8.932243012e-01f, -8.959662498e-01f, -8.986744657e-01f, -9.013488470e-01f,
+  -9.039892931e-01f, -9.065957045e-01f, -9.091679831e-01f, -9.117060320e-01f, -9.142097557e-01f, -9.166790599e-01f, -9.191138517e-01f, -9.215140393e-01f,
+  -9.238795325e-01f, -9.262102421e-01f, -9.285060805e-01f, -9.307669611e-01f, -9.329927988e-01f, -9.351835099e-01f, -9.373390119e-01f, -9.394592236e-01f,
+  -9.415440652e-01f, -9.435934582e-01f, -9.456073254e-01f, -9.475855910e-01f, -9.495281806e-01f, -9.514350210e-01f, -9.533060404e-01f, -9.551411683e-01f,
+  -9.569403357e-01f, -9.587034749e-01f, -9.604305194e-01f, -9.621214043e-01f, -9.637760658e-01f, -9.653944417e-01f, -9.669764710e-01f, -9.685220943e-01f,
+  -9.700312532e-01f, -9.715038910e-01f, -9.729399522e-01f, -9.743393828e-01f, -9.757021300e-01f, -9.770281427e-01f, -9.783173707e-01f, -9.795697657e-01f,
+  -9.807852804e-01f, -9.819638691e-01f, -9.831054874e-01f, -9.842100924e-01f, -9.852776424e-01f, -9.863080972e-01f, -9.873014182e-01f, -9.882575677e-01f,
+  -9.891765100e-01f, -9.900582103e-01f, -9.909026354e-01f, -9.917097537e-01f, -9.924795346e-01f, -9.932119492e-01f, -9.939069700e-01f, -9.945645707e-01f,
+  -9.951847267e-01f, -9.957674145e-01f, -9.963126122e-01f, -9.968202993e-01f, -9.972904567e-01f, -9.977230666e-01f, -9.981181129e-01f, -9.984755806e-01f,
+  -9.987954562e-01f, -9.990777278e-01f, -9.993223846e-01f, -9.995294175e-01f, -9.996988187e-01f, -9.998305818e-01f, -9.999247018e-01f, -9.999811753e-01f,
+  -1.000000000e+00f, -9.999811753e-01f, -9.999247018e-01f, -9.998305818e-01f, -9.996988187e-01f, -9.995294175e-01f, -9.993223846e-01f, -9.990777278e-01f,
+  -9.987954562e-01f, -9.984755806e-01f, -9.981181129e-01f, -9.977230666e-01f, -9.972904567e-01f, -9.968202993e-01f, -9.963126122e-01f, -9.957674145e-01f,
+  -9.951847267e-01f, -9.945645707e-01f, -9.939069700e-01f, -9.932119492e-01f, -9.924795346e-01f, -9.917097537e-01f, -9.909026354e-01f, -9.900582103e-01f,
+  -9.891765100e-01f, -9.882575677e-01f, -9.873014182e-01f, -9.863080972e-01f, -9.852776424e-01f, -9.842100924e-01f, -9.831054874e-01f, -9.819638691e-01f,
+  -9.807852804e-01f, -9.795697657e-01f, -9.783173707e-01f, -9.770281427e-01f, -9.757021300e-01f, -9.743393828e-01f, -9.729399522e-01f, -9.715038910e-01f,
+  -9.700312532e-01f, -9.685220943e-01f, -9.669764710e-01f, -9.653944417e-01f, -9.637760658e-01f, -9.621214043e-01f, -9.604305194e-01f, -9.587034749e-01f,
+  -9.569403357e-01f, -9.551411683e-01f, -9.533060404e-01f, -9.514350210e-01f, -9.495281806e-01f, -9.475855910e-01f, -9.456073254e-01f, -9.435934582e-01f,
+  -9.415440652e-01f, -9.394592236e-01f, -9.373390119e-01f, -9.351835099e-01f, -9.329927988e-01f, -9.307669611e-01f, -9.285060805e-01f, -9.262102421e-01f,
+  -9.238795325e-01f, -9.215140393e-01f, -9.191138517e-01f, -9.166790599e-01f, -9.142097557e-01f, -9.117060320e-01f, -9.091679831e-01f, -9.065957045e-01f,
+  -9.039892931e-01f, -9.013488470e-01f, -8.986744657e-01f, -8.959662498e-01f, -8.932243012e-01f, -8.904487232e-01f, -8.876396204e-01f, -8.847970984e-01f,
+  -8.819212643e-01f, -8.790122264e-01f, -8.760700942e-01f, -8.730949784e-01f, -8.700869911e-01f, -8.670462455e-01f, -8.639728561e-01f, -8.608669386e-01f,
+  -8.577286100e-01f, -8.545579884e-01f, -8.513551931e-01f, -8.481203448e-01f, -8.448535652e-01f, -8.415549774e-01f, -8.382247056e-01f, -8.348628750e-01f,
+  -8.314696123e-01f, -8.280450453e-01f, -8.245893028e-01f, -8.211025150e-01f, -8.175848132e-01f, -8.140363297e-01f, -8.104571983e-01f, -8.068475535e-01f,
+  -8.032075315e-01f, -7.995372691e-01f, -7.958369046e-01f, -7.921065773e-01f, -7.883464276e-01f, -7.845565972e-01f, -7.807372286e-01f, -7.768884657e-01f,
+  -7.730104534e-01f, -7.691033376e-01f, -7.651672656e-01f, -7.612023855e-01f, -7.572088465e-01f, -7.531867990e-01f, -7.491363945e-01f, -7.450577854e-01f,
+  -7.409511254e-01f, -7.368165689e-01f, -7.326542717e-01f, -7.284643904e-01f, -7.242470830e-01f, -7.200025080e-01f, -7.157308253e-01f, -7.114321957e-01f,
+  -7.071067812e-01f, -7.027547445e-01f, -6.983762494e-01f, -6.939714609e-01f, -6.895405447e-01f, -6.850836678e-01f, -6.806009978e-01f, -6.760927036e-01f,
+  -6.715589548e-01f, -6.669999223e-01f, -6.624157776e-01f, -6.578066933e-01f, -6.531728430e-01f, -6.485144010e-01f, -6.438315429e-01f, -6.391244449e-01f,
+  -6.343932842e-01f, -6.296382389e-01f, -6.248594881e-01f, -6.200572118e-01f, -6.152315906e-01f, -6.103828063e-01f, -6.055110414e-01f, -6.006164794e-01f,
+  -5.956993045e-01f, -5.907597019e-01f, -5.857978575e-01f, -5.808139581e-01f, -5.758081914e-01f, -5.707807459e-01f, -5.657318108e-01f, -5.606615762e-01f,
+  -5.555702330e-01f, -5.504579729e-01f, -5.453249884e-01f, -5.401714727e-01f, -5.349976199e-01f, -5.298036247e-01f, -5.245896827e-01f, -5.193559902e-01f,
+  -5.141027442e-01f, -5.088301425e-01f, -5.035383837e-01f, -4.982276670e-01f, -4.928981922e-01f, -4.875501601e-01f, -4.821837721e-01f, -4.767992301e-01f,
+  -4.713967368e-01f, -4.659764958e-01f, -4.605387110e-01f, -4.550835871e-01f, -4.496113297e-01f, -4.441221446e-01f, -4.386162385e-01f, -4.330938189e-01f,
+  -4.275550934e-01f, -4.220002708e-01f, -4.164295601e-01f, -4.108431711e-01f, -4.052413140e-01f, -3.996241998e-01f, -3.939920401e-01f, -3.883450467e-01f,
+  -3.826834324e-01f, -3.770074102e-01f, -3.713171940e-01f, -3.656129978e-01f, -3.598950365e-01f, -3.541635254e-01f, -3.484186802e-01f, -3.426607173e-01f,
+  -3.368898534e-01f, -3.311063058e-01f, -3.253102922e-01f, -3.195020308e-01f, -3.136817404e-01f, -3.078496400e-01f, -3.020059493e-01f, -2.961508882e-01f,
+  -2.902846773e-01f, -2.844075372e-01f, -2.785196894e-01f, -2.726213554e-01f, -2.667127575e-01f, -2.607941179e-01f, -2.548656596e-01f, -2.489276057e-01f,
+  -2.429801799e-01f, -2.370236060e-01f, -2.310581083e-01f, -2.250839114e-01f, -2.191012402e-01f, -2.131103199e-01f, -2.071113762e-01f, -2.011046348e-01f,
+  -1.950903220e-01f, -1.890686641e-01f, -1.830398880e-01f, -1.770042204e-01f, -1.709618888e-01f, -1.649131205e-01f, -1.588581433e-01f, -1.527971853e-01f,
+  -1.467304745e-01f, -1.406582393e-01f, -1.345807085e-01f, -1.284981108e-01f, -1.224106752e-01f, -1.163186309e-01f, -1.102222073e-01f, -1.041216339e-01f,
+  -9.801714033e-02f, -9.190895650e-02f, -8.579731234e-02f, -7.968243797e-02f, -7.356456360e-02f, -6.744391956e-02f, -6.132073630e-02f, -5.519524435e-02f,
+  -4.906767433e-02f, -4.293825693e-02f, -3.680722294e-02f, -3.067480318e-02f, -2.454122852e-02f, -1.840672991e-02f, -1.227153829e-02f, -6.135884649e-03f,
+   0.000000000e+00f,
+};
+
+const float saw_wave_table[WAVE_MIP_LEVELS][WAVE_TABLE_LENGTH + 1] = {
+  { // level 0: 511 harmonics
+     0.000000000e+00f, -1.955032351e-03f, -3.902435262e-03f, -5.865097197e-03f, -7.804870237e-03f, -9.775162473e-03f, -1.170730464e-02f, -1.368522847e-02f,
+    -1.560973818e-02f, -1.759529547e-02f, -1.951217056e-02f, -2.150536376e-02f, -2.341460151e-02f, -2.541543364e-02f, -2.731703074e-02f, -2.932550539e-02f,
+    -3.121945795e-02f, -3.323557930e-02f, -3.512188285e-02f, -3.714565566e-02f, -3.902430515e-02f, -4.105573476e-02f, -4.292672457e-02f, -4.496581689e-02f,
+    -4.682914081e-02f, -4.887590235e-02f, -5.073155358e-02f, -5.278599143e-02f, -5.463396259e-02f, -5.669608442e-02f, -5.853636753e-02f, -6.060618162e-02f,
+    -6.243876811e-02f, -6.451628332e-02f, -6.634116404e-02f, -6.842638984e-02f, -7.024355501e-02f, -7.233650145e-02f, -7.414594073e-02f, -7.624661848e-02f,
+    -7.804832089e-02f, -8.015674121e-02f, -8.195069519e-02f, -8.406686996e-02f, -8.585306332e-02f, -8.797700502e-02f, -8.975542498e-02f, -9.188714672e-02f,
+    -9.365777985e-02f, -9.579729536e-02f, -9.756012762e-02f, -9.970745125e-02f, -1.014624680e-01f, -1.036176147e-01f, -1.053648006e-01f, -1.075277861e-01f,
+    -1.092671252e-01f, -1.114379656e-01f, -1.131694414e-01f, -1.153481537e-01f, -1.170717490e-01f, -1.192583506e-01f, -1.209740475e-01f, -1.231685568e-01f,
+    -1.248763366e-01f, -1.270787724e-01f, -1.287786161e-01f, -1.309889979e-01f, -1.326808856e-01f, -1.348992336e-01f, -1.365831447e-01f, -1.388094797e-01f,
+    -1.404853931e-01f, -1.427197368e-01f, -1.443876305e-01f, -1.466300051e-01f, -1.482898565e-01f, -1.505402849e-01f, -1.521920707e-01f, -1.544505767e-01f,
+    -1.560942728e-01f, -1.583608808e-01f, -1.599964625e-01f, -1.622711975e-01f, -1.638986393e-01f, -1.661815272e-01f, -1.678008030e-01f, -1.700918703e-01f,
+    -1.717029531e-01f, -1.740022271e-01f, -1.756050892e-01f, -1.779125981e-01f, -1.795072110e-01f, -1.818229836e-01f, -1.834093181e-01f, -1.857333840e-01f,
+    -1.873114101e-01f, -1.896437997e-01f, -1.912134865e-01f, -1.935542312e-01f, -1.951155471e-01f, -1.974646787e-01f, -1.990175913e-01f, -2.013751428e-01f,
+    -2.029196188e-01f, -2.052856238e-01f, -2.068216292e-01f, -2.091961222e-01f, -2.107236220e-01f, -2.131066384e-01f, -2.146255967e-01f, -2.170171728e-01f,
+    -2.185275530e-01f, -2.209277259e-01f, -2.224294904e-01f, -2.248382981e-01f, -2.263314085e-01f, -2.287488899e-01f, -2.302333068e-01f, -2.326595017e-01f,
+    -2.341351848e-01f, -2.365701340e-01f, -2.380370420e-01f, -2.404807873e-01f, -2.419388780e-01f, -2.443914621e-01f, -2.458406923e-01f, -2.483021588e-01f,
+    -2.497424844e-01f, -2.522128780e-01f, -2.536442538e-01f, -2.561236202e-01f, -2.575459999e-01f, -2.600343859e-01f, -2.614477223e-01f, -2.639451756e-01f,
+    -2.653494204e-01f, -2.678559898e-01f, -2.692510937e-01f, -2.717668292e-01f, -2.731527416e-01f, -2.756776942e-01f, -2.770543635e-01f, -2.795885854e-01f,
+    -2.809559590e-01f, -2.834995034e-01f, -2.848575273e-01f, -2.874104489e-01f, -2.887590680e-01f, -2.913214223e-01f, -2.926605803e-01f, -2.952324243e-01f,
+    -2.965620638e-01f, -2.991434555e-01f, -3.004635177e-01f, -3.030545166e-01f, -3.043649414e-01f, -3.069656082e-01f, -3.082663344e-01f, -3.108767310e-01f,
+    -3.121676958e-01f, -3.147878855e-01f, -3.160690250e-01f, -3.186990726e-01f, -3.199703214e-01f, -3.226102929e-01f, -3.238715842e-01f, -3.265215472e-01f,
+    -3.277728128e-01f, -3.304328361e-01f, -3.316740062e-01f, -3.343441604e-01f, -3.355751640e-01f, -3.382555208e-01f, -3.394762851e-01f, -3.421669183e-01f,
+    -3.433773689e-01f, -3.460783534e-01f, -3.472784146e-01f, -3.499898271e-01f, -3.511794213e-01f, -3.539013402e-01f, -3.550803882e-01f, -3.578128935e-01f,
+    -3.589813145e-01f, -3.617244879e-01f, -3.628821992e-01f, -3.656361243e-01f, -3.667830415e-01f, -3.695478035e-01f, -3.706838405e-01f, -3.734595266e-01f,
+    -3.745845952e-01f, -3.773712944e-01f, -3.784853046e-01f, -3.812831080e-01f, -3.823859678e-01f, -3.851949683e-01f, -3.862865837e-01f, -3.891068763e-01f,
+    -3.901871514e-01f, -3.930188332e-01f, -3.940876698e-01f, -3.969308399e-01f, -3.979881377e-01f, -4.008428975e-01f, -4.018885542e-01f, -4.047550073e-01f,
+    -4.057889180e-01f, -4.086671703e-01f, -4.096892279e-01f, -4.125793876e-01f, -4.135894829e-01f, -4.164916606e-01f, -4.174896816e-01f, -4.204039905e-01f,
+    -4.213898228e-01f, -4.243163785e-01f, -4.252899053e-01f, -4.282288260e-01f, -4.291899276e-01f, -4.321413342e-01f, -4.330898885e-01f, -4.360539046e-01f,
+    -4.369897864e-01f, -4.399665386e-01f, -4.408896201e-01f, -4.438792376e-01f, -4.447893881e-01f, -4.477920031e-01f, -4.486890887e-01f, -4.517048367e-01f,
+    -4.525887205e-01f, -4.556177399e-01f, -4.564882819e-01f, -4.595307143e-01f, -4.603877712e-01f, -4.634437617e-01f, -4.642871868e-01f, -4.673568836e-01f,
+    -4.681865268e-01f, -4.712700820e-01f, -4.720857896e-01f, -4.751833586e-01f, -4.759849732e-01f, -4.790967152e-01f, -4.798840759e-01f, -4.830101538e-01f,
+    -4.837830955e-01f, -4.869236764e-01f, -4.876820302e-01f, -4.908372850e-01f, -4.915808778e-01f, -4.947509817e-01f, -4.954796363e-01f, -4.986647686e-01f,
+    -4.993783034e-01f, -5.025786480e-01f, -5.032768768e-01f, -5.064926223e-01f, -5.071753543e-01f, -5.104066936e-01f, -5.110737335e-01f, -5.143208646e-01f,
+    -5.149720117e-01f, -5.182351377e-01f, -5.188701866e-01f, -5.221495156e-01f, -5.227682554e-01f, -5.260640008e-01f, -5.266662154e-01f, -5.299785963e-01f,
+    -5.305640638e-01f, -5.338933048e-01f, -5.344617976e-01f, -5.378081294e-01f, -5.383594139e-01f, -5.417230730e-01f, -5.422569095e-01f, -5.456381389e-01f,
+    -5.461542813e-01f, -5.495533303e-01f, -5.500515259e-01f, -5.534686506e-01f, -5.539486398e-01f, -5.573841034e-01f, -5.578456194e-01f, -5.612996922e-01f,
+    -5.617424612e-01f, -5.652154209e-01f, -5.656391612e-01f, -5.691312932e-01f, -5.695357155e-01f, -5.730473133e-01f, -5.734321200e-01f, -5.769634853e-01f,
+    -5.773283704e-01f, -5.808798136e-01f, -5.812244623e-01f, -5.847963026e-01f, -5.851203911e-01f, -5.887129571e-01f, -5.890161522e-01f, -5.926297818e-01f,
+    -5.929117404e-01f, -5.965467818e-01f, -5.968071508e-01f, -6.004639623e-01f, -6.007023780e-01f, -6.043813288e-01f, -6.045974164e-01f, -6.082988869e-01f,
+    -6.084922603e-01f, -6.122166425e-01f, -6.123869037e-01f, -6.161346017e-01f, -6.162813404e-01f, -6.200527707e-01f, -6.201755639e-01f, -6.239711564e-01f,
+    -6.240695674e-01f, -6.278897655e-01f, -6.279633440e-01f, -6.318086052e-01f, -6.318568861e-01f, -6.357276830e-01f, -6.357501863e-01f, -6.396470068e-01f,
+    -6.396432365e-01f, -6.435665847e-01f, -6.435360285e-01f, -6.474864252e-01f, -6.474285534e-01f, -6.514065371e-01f, -6.513208022e-01f, -6.553269299e-01f,
+    -6.552127654e-01f, -6.592476132e-01f, -6.591044330e-01f, -6.631685972e-01f, -6.629957948e-01f, -6.670898924e-01f, -6.668868397e-01f, -6.710115102e-01f,
+    -6.707775564e-01f, -6.749334620e-01f, -6.746679329e-01f, -6.788557603e-01f, -6.785579567e-01f, -6.827784177e-01f, -6.824476147e-01f, -6.867014478e-01f,
+    -6.863368930e-01f, -6.906248648e-01f, -6.902257771e-01f, -6.945486834e-01f, -6.941142518e-01f, -6.984729194e-01f, -6.980023010e-01f, -7.023975892e-01f,
+    -7.018899079e-01f, -7.063227101e-01f, -7.057770546e-01f, -7.102483003e-01f, -7.096637225e-01f, -7.141743792e-01f, -7.135498918e-01f, -7.181009670e-01f,
+    -7.174355416e-01f, -7.220280851e-01f, -7.213206499e-01f, -7.259557563e-01f, -7.252051934e-01f, -7.298840044e-01f, -7.290891474e-01f, -7.338128548e-01f,
+    -7.329724858e-01f, -7.377423343e-01f, -7.368551811e-01f, -7.416724716e-01f, -7.407372039e-01f, -7.456032966e-01f, -7.446185230e-01f, -7.495348416e-01f,
+    -7.484991054e-01f, -7.534671406e-01f, -7.523789160e-01f, -7.574002298e-01f, -7.562579172e-01f, -7.613341480e-01f, -7.601360693e-01f, -7.652689363e-01f,
+    -7.640133297e-01f, -7.692046386e-01f, -7.678896529e-01f, -7.731413019e-01f, -7.717649905e-01f, -7.770789765e-01f, -7.756392903e-01f, -7.810177161e-01f,
+    -7.795124969e-01f, -7.849575783e-01f, -7.833845504e-01f, -7.888986251e-01f, -7.872553868e-01f, -7.928409228e-01f, -7.911249370e-01f, -7.967845432e-01f,
+    -7.949931268e-01f, -8.007295633e-01f, -7.988598760e-01f, -8.046760663e-01f, -8.027250982e-01f, -8.086241423e-01f, -8.065886998e-01f, -8.125738885e-01f,
+    -8.104505795e-01f, -8.165254105e-01f, -8.143106271e-01f, -8.204788230e-01f, -8.181687233e-01f, -8.244342506e-01f, -8.220247379e-01f, -8.283918294e-01f,
+    -8.258785287e-01f, -8.323517077e-01f, -8.297299407e-01f, -8.363140479e-01f, -8.335788038e-01f, -8.402790280e-01f, -8.374249316e-01f, -8.442468437e-01f,
+    -8.412681186e-01f, -8.482177104e-01f, -8.451081389e-01f, -8.521918658e-01f, -8.489447421e-01f, -8.561695731e-01f, -8.527776513e-01f, -8.601511242e-01f,
+    -8.566065586e-01f, -8.641368441e-01f, -8.604311210e-01f, -8.681270953e-01f, -8.642509549e-01f, -8.721222835e-01f, -8.680656307e-01f, -8.761228645e-01f,
+    -8.718746647e-01f, -8.801293519e-01f, -8.756775109e-01f, -8.841423266e-01f, -8.794735507e-01f, -8.881624482e-01f, -8.832620799e-01f, -8.921904689e-01f,
+    -8.870422941e-01f, -8.962272504e-01f, -8.908132695e-01f, -9.002737842e-01f, -8.945739402e-01f, -9.043312174e-01f, -8.983230701e-01f, -9.084008843e-01f,
+    -9.020592169e-01f, -9.124843461e-01f, -9.057806877e-01f, -9.165834417e-01f, -9.094854819e-01f, -9.207003516e-01f, -9.131712181e-01f, -9.248376818e-01f,
+    -9.168350388e-01f, -9.289985722e-01f, -9.204734855e-01f, -9.331868416e-01f, -9.240823315e-01f, -9.374071806e-01f, -9.276563564e-01f, -9.416654162e-01f,
+    -9.311890358e-01f, -9.459688777e-01f, -9.346721075e-01f, -9.503269141e-01f, -9.380949510e-01f, -9.547516411e-01f, -9.414436823e-01f, -9.592590459e-01f,
+    -9.446997966e-01f, -9.638706675e-01f, -9.478380716e-01f, -9.686162345e-01f, -9.508232180e-01f, -9.735379633e-01f, -9.536043021e-01f, -9.786978806e-01f,
+    -9.561050045e-01f, -9.841909759e-01f, -9.582055708e-01f, -9.901704246e-01f, -9.597068334e-01f, -9.969001149e-01f, -9.602514505e-01f, -1.004876458e+00f,
+    -9.591285366e-01f, -1.015155669e+00f, -9.546954998e-01f, -1.030445524e+00f, -9.421293829e-01f, -1.060325193e+00f, -8.989183551e-01f, -1.177025984e+00f,
+    -2.927015648e-16f,  1.177025984e+00f,  8.989183551e-01f,  1.060325193e+00f,  9.421293829e-01f,  1.030445524e+00f,  9.546954998e-01f,  1.015155669e+00f,
+     9.591285366e-01f,  1.004876458e+00f,  9.602514505e-01f,  9.969001149e-01f,  9.597068334e-01f,  9.901704246e-01f,  9.582055708e-01f,  9.841909759e-01f,
+     9.561050045e-01f,  9.786978806e-01f,  9.536043021e-01f,  9.735379633e-01f,  9.508232180e-01f,  9.686162345e-01f,  9.478380716e-01f,  9.638706675e-01f,
+     9.446997966e-01f,  9.592590459e-01f,  9.414436823e-01f,  9.547516411e-01f,  9.380949510e-01f,  9.503269141e-01f,  9.346721075e-01f,  9.459688777e-01f,
+     9.311890358e-01f,  9.416654162e-01f,  9.276563564e-01f,  9.374071806e-01f,  9.240823315e-01f,  9.331868416e-01f,  9.204734855e-01f,  9.289985722e-01f,
+     9.168350388e-01f,  9.248376818e-01f,  9.131712181e-01f,  9.207003516e-01f,  9.094854819e-01f,  9.165834417e-01f,  9.057806877e-01f,  9.124843461e-01f,
+     9.020592169e-01f,  9.084008843e-01f,  8.983230701e-01f,  9.043312174e-01f,  8.945739402e-01f,  9.002737842e-01f,  8.908132695e-01f,  8.962272504e-01f,
+     8.870422941e-01f,  8.921904689e-01f,  8.832620799e-01f,  8.881624482e-01f,  8.794735507e-01f,  8.841423266e-01f,  8.756775109e-01f,  8.801293519e-01f,
+     8.718746647e-01f,  8.761228645e-01f,  8.680656307e-01f,  8.721222835e-01f,  8.642509549e-01f,  8.681270953e-01f,  8.604311210e-01f,  8.641368441e-01f,
+     8.566065586e-01f,  8.601511242e-01f,  8.527776513e-01f,  8.561695731e-01f,  8.489447421e-01f,  8.521918658e-01f,  8.451081389e-01f,  8.482177104e-01f,
+     8.412681186e-01f,  8.442468437e-01f,  8.374249316e-01f,  8.402790280e-01f,  8.335788038e-01f,  8.363140479e-01f,  8.297299407e-01f,  8.323517077e-01f,
+     8.258785287e-01f,  8.283918294e-01f,  8.220247379e-01f,  8.244342506e-01f,  8.181687233e-01f,  8.204788230e-01f,  8.143106271e-01f,  8.165254105e-01f,
+     8.104505795e-01f,  8.125738885e-01f,  8.065886998e-01f,  8.086241423e-01f,  8.027250982e-01f,  8.046760663e-01f,  7.988598760e-01f,  8.007295633e-01f,
+     7.949931268e-01f,  7.967845432e-01f,  7.911249370e-01f,  7.928409228e-01f,  7.872553868e-01f,  7.888986251e-01f,  7.833845504e-01f,  7.849575783e-01f,
+     7.795124969e-01f,  7.810177161e-01f,  7.756392903e-01f,  7.770789765e-01f,  7.717649905e-01f,  7.731413019e-01f,  7.678896529e-01f,  7.692046386e-01f,
+     7.640133297e-01f,  7.652689363e-01f,  7.601360693e-01f,  7.613341480e-01f,  7.562579172e-01f,  7.574002298e-01f,  7.523789160e-01f,  7.534671406e-01f,
+     7.484991054e-01f,  7.495348416e-01f,  7.446185230e-01f,  7.456032966e-01f,  7.407372039e-01f,  7.416724716e-01f,  7.368551811e-01f,  7.377423343e-01f,
+     7.329724858e-01f,  7.338128548e-01f,  7.290891474e-01f,  7.298840044e-01f,  7.252051934e-01f,  7.259557563e-01f,  7.213206499e-01f,  7.220280851e-01f,
+     7.174355416e-01f,  7.181009670e-01f,  7.135498918e-01f,  7.141743792e-01f,  7.096637225e-01f,  7.102483003e-01f,  7.057770546e-01f,  7.063227101e-01f,
+     7.018899079e-01f,  7.023975892e-01f,  6.980023010e-01f,  6.984729194e-01f,  6.941142518e-01f,  6.945486834e-01f,  6.902257771e-01f,  6.906248648e-01f,
+     6.863368930e-01f,  6.867014478e-01f,  6.824476147e-01f,  6.827784177e-01f,  6.785579567e-01f,  6.788557603e-01f,  6.746679329e-01f,  6.749334620e-01f,
+     6.707775564e-01f,  6.710115102e-01f,  6.668868397e-01f,  6.670898924e-01f,  6.629957948e-01f,  6.631685972e-01f,  6.591044330e-01f,  6.592476132e-01f,
+     6.552127654e-01f,  6.553269299e-01f,  6.513208022e-01f,  6.514065371e-01f,  6.474285534e-01f,  6.474864252e-01f,  6.435360285e-01f,  6.435665847e-01f,
+     6.396432365e-01f,  6.396470068e-01f,  6.357501863e-01f,  6.357276830e-01f,  6.318568861e-01f,  6.318086052e-01f,  6.279633440e-01f,  6.278897655e-01f,
+     6.240695674e-01f,  6.239711564e-01f,  6.201755639e-01f,  6.200527707e-01f,  6.162813404e-01f,  6.161346017e-01f,  6.123869037e-01f,  6.122166425e-01f,
+     6.084922603e-01f,  6.082988869e-01f,  6.045974164e-01f,  6.043813288e-01f,  6.007023780e-01f,  6.004639623e-01f,  5.968071508e-01f,  5.965467818e-01f,
+     5.929117404e-01f,  5.926297818e-01f,  5.890161522e-01f,  5.887129571e-01f,  5.851203911e-01f,  5.847963026e-01f,  5.812244623e-01f,  5.808798136e-01f,
+     5.773283704e-01f,  5.769634853e-01f,  5.734321200e-01f,  5.730473133e-01f,  5.695357155e-01f,  5.691312932e-01f,  5.656391612e-01f,  5.652154209e-01f,
+     5.617424612e-01f,  5.612996922e-01f,  5.578456194e-01f,  5.573841034e-01f,  5.539486398e-01f,  5.534686506e-01f,  5.500515259e-01f,  5.495533303e-01f,
+     5.461542813e-01f,  5.456381389e-01f,  5.422569095e-01f,  5.417230730e-01f,  5.383594139e-01f,  5.378081294e-01f,  5.344617976e-01f,  5.338933048e-01f,
+     5.305640638e-01f,  5.299785963e-01f,  5.266662154e-01f,  5.260640008e-01f,  5.227682554e-01f,  5.221495156e-01f,  5.188701866e-01f,  5.182351377e-01f,
+     5.149720117e-01f,  5.143208646e-01f,  5.110737335e-01f,  5.104066936e-01f,  5.071753543e-01f,  5.064926223e-01f,  5.032768768e-01f,  5.025786480e-01f,
+     4.993783034e-01f,  4.986647686e-01f,  4.954796363e-01f,  4.947509817e-01f,  4.915808778e-01f,  4.908372850e-01f,  4.876820302e-01f,  4.869236764e-01f,
+     4.837830955e-01f,  4.830101538e-01f,  4.798840759e-01f,  4.790967152e-01f,  4.759849732e-01f,  4.751833586e-01f,  4.720857896e-01f,  4.712700820e-01f,
+     4.681865268e-01f,  4.673568836e-01f,  4.642871868e-01f,  4.634437617e-01f,  4.603877712e-01f,  4.595307143e-01f,  4.564882819e-01f,  4.556177399e-01f,
+     4.525887205e-01f,  4.517048367e-01f,  4.486890887e-01f,  4.477920031e-01f,  4.447893881e-01f,  4.438792376e-01f,  4.408896201e-01f,  4.399665386e-01f,
+     4.369897864e-01f,  4.360539046e-01f,  4.330898885e-01f,  4.321413342e-01f,  4.291899276e-01f,  4.282288260e-01f,  4.252899053e-01f,  4.243163785e-01f,
+     4.213898228e-01f,  4.204039905e-01f,  4.174896816e-01f,  4.164916606e-01f,  4.135894829e-01f,  4.125793876e-01f,  4.096892279e-01f,  4.086671703e-01f,
+     4.057889180e-01f,  4.047550073e-01f,  4.018885542e-01f,  4.008428975e-01f,  3.979881377e-01f,  3.969308399e-01f,  3.940876698e-01f,  3.930188332e-01f,
+     3.901871514e-01f,  3.891068763e-01f,  3.862865837e-01f,  3.851949683e-01f,  3.823859678e-01f,  3.812831080e-01f,  3.784853046e-01f,  3.773712944e-01f,
+     3.745845952e-01f,  3.734595266e-01f,  3.706838405e-01f,  3.695478035e-01f,  3.667830415e-01f,  3.656361243e-01f,  3.628821992e-01f,  3.617244879e-01f,
+     3.589813145e-01f,  3.578128935e-01f,  3.550803882e-01f,  3.539013402e-01f,  3.511794213e-01f,  3.499898271e-01f,  3.472784146e-01f,  3.460783534e-01f,
+     3.433773689e-01f,  3.421669183e-01f,  3.394762851e-01f,  3.382555208e-01f,  3.355751640e-01f,  3.343441604e-01f,  3.316740062e-01f,  3.304328361e-01f,
+     3.277728128e-01f,  3.265215472e-01f,  3.238715842e-01f,  3.226102929e-01f,  3.199703214e-01f,  3.186990726e-01f,  3.160690250e-01f,  3.147878855e-01f,
+     3.121676958e-01f,  3.108767310e-01f,  3.082663344e-01f,  3.069656082e-01f,  3.043649414e-01f,  3.030545166e-01f,  3.004635177e-01f,  2.991434555e-01f,
+     2.965620638e-01f,  2.952324243e-01f,  2.926605803e-01f,  2.913214223e-01f,  2.887590680e-01f,  2.874104489e-01f,  2.848575273e-01f,  2.834995034e-01f,
+     2.809559590e-01f,  2.795885854e-01f,  2.770543635e-01f,  2.756776942e-01f,  2.731527416e-01f,  2.717668292e-01f,  2.692510937e-01f,  2.678559898e-01f,
+     2.653494204e-01f,  2.639451756e-01f,  2.614477223e-01f,  2.600343859e-01f,  2.575459999e-01f,  2.561236202e-01f,  2.536442538e-01f,  2.522128780e-01f,
+     2.497424844e-01f,  2.483021588e-01f,  2.458406923e-01f,  2.443914621e-01f,  2.419388780e-01f,  2.404807873e-01f,  2.380370420e-01f,  2.365701340e-01f,
+     2.341351848e-01f,  2.326595017e-01f,  2.302333068e-01f,  2.287488899e-01f,  2.263314085e-01f,  2.248382981e-01f,  2.224294904e-01f,  2.209277259e-01f,
+     2.185275530e-01f,  2.170171728e-01f,  2.146255967e-01f,  2.131066384e-01f,  2.107236220e-01f,  2.091961222e-01f,  2.068216292e-01f,  2.052856238e-01f,
+     2.029196188e-01f,  2.013751428e-01f,  1.990175913e-01f,  1.974646787e-01f,  1.951155471e-01f,  1.935542312e-01f,  1.912134865e-01f,  1.896437997e-01f,
+     1.873114101e-01f,  1.857333840e-01f,  1.834093181e-01f,  1.818229836e-01f,  1.795072110e-01f,  1.779125981e-01f,  1.756050892e-01f,  1.740022271e-01f,
+     1.717029531e-01f,  1.700918703e-01f,  1.678008030e-01f,  1.661815272e-01f,  1.638986393e-01f,  1.622711975e-01f,  1.599964625e-01f,  1.583608808e-01f,
+     1.560942728e-01f,  1.544505767e-01f,  1.521920707e-01f,  1.505402849e-01f,  1.482898565e-01f,  1.466300051e-01f,  1.443876305e-01f,  1.427197368e-01f,
+     1.404853931e-01f,  1.388094797e-01f,  1.365831447e-01f,  1.348992336e-01f,  1.326808856e-01f,  1.309889979e-01f,  1.287786161e-01f,  1.270787724e-01f,
+     1.248763366e-01f,  1.231685568e-01f,  1.209740475e-01f,  1.192583506e-01f,  1.170717490e-01f,  1.153481537e-01f,  1.131694414e-01f,  1.114379656e-01f,
+     1.092671252e-01f,  1.075277861e-01f,  1.053648006e-01f,  1.036176147e-01f,  1.014624680e-01f,  9.970745125e-02f,  9.756012762e-02f,  9.579729536e-02f,
+     9.365777985e-02f,  9.188714672e-02f,  8.975542498e-02f,  8.797700502e-02f,  8.585306332e-02f,  8.406686996e-02f,  8.195069519e-02f,  8.015674121e-02f,
+     7.804832089e-02f,  7.624661848e-02f,  7.414594073e-02f,  7.233650145e-02f,  7.024355501e-02f,  6.842638984e-02f,  6.634116404e-02f,  6.451628332e-02f,
+     6.243876811e-02f,  6.060618162e-02f,  5.853636753e-02f,  5.669608442e-02f,  5.463396259e-02f,  5.278599143e-02f,  5.073155358e-02f,  4.887590235e-02f,
+     4.682914081e-02f,  4.496581689e-02f,  4.292672457e-02f,  4.105573476e-02f,  3.902430515e-02f,  3.714565566e-02f,  3.512188285e-02f,  3.323557930e-02f,
+     3.121945795e-02f,  2.932550539e-02f,  2.731703074e-02f,  2.541543364e-02f,  2.341460151e-02f,  2.150536376e-02f,  1.951217056e-02f,  1.759529547e-02f,
+     1.560973818e-02f,  1.368522847e-02f,  1.170730464e-02f,  9.775162473e-03f,  7.804870237e-03f,  5.865097197e-03f,  3.902435262e-03f,  1.955032351e-03f,
+     0.000000000e+00f,
+  },
+  { // level 1: 255 harmonics
+     0.000000000e+00f, -3.198951509e-03f, -3.913879432e-03f, -4.613548308e-03f, -7.797240561e-03f, -1.101145206e-02f, -1.174164059e-02f, -1.242604739e-02f,
+    -1.559447653e-02f, -1.882395334e-02f, -1.956940865e-02f, -2.023854575e-02f, -2.339170329e-02f, -2.663645535e-02f, -2.739718822e-02f, -2.805104336e-02f,
+    -3.118891624e-02f, -3.444895810e-02f, -3.522498391e-02f, -3.586354024e-02f, -3.898611075e-02f, -4.226146159e-02f, -4.305280037e-02f, -4.367603638e-02f,
+    -4.678328216e-02f, -5.007396583e-02f, -5.088064226e-02f, -5.148853177e-02f, -5.458042579e-02f, -5.788647081e-02f, -5.870851428e-02f, -5.930102641e-02f,
+    -6.237753693e-02f, -6.569897655e-02f, -6.653642117e-02f, -6.711352030e-02f, -7.017461082e-02f, -7.351148305e-02f, -7.436436769e-02f, -7.492601341e-02f,
+    -7.797164267e-02f, -8.132399032e-02f, -8.219235868e-02f, -8.273850576e-02f, -8.576862762e-02f, -8.913649837e-02f, -9.002039902e-02f, -9.055099731e-02f,
+    -9.356556077e-02f, -9.694900720e-02f, -9.784849364e-02f, -9.836348808e-02f, -1.013624371e-01f, -1.047615168e-01f, -1.056766475e-01f, -1.061759780e-01f,
+    -1.091592517e-01f, -1.125740273e-01f, -1.135048658e-01f, -1.139884672e-01f, -1.169559993e-01f, -1.203865386e-01f, -1.213331537e-01f, -1.218009555e-01f,
+    -1.247526747e-01f, -1.281990507e-01f, -1.291615163e-01f, -1.296134429e-01f, -1.325492727e-01f, -1.360115636e-01f, -1.369899590e-01f, -1.374259295e-01f,
+    -1.403457879e-01f, -1.438240775e-01f, -1.448184873e-01f, -1.452384153e-01f, -1.481422147e-01f, -1.516365922e-01f, -1.526471068e-01f, -1.530509001e-01f,
+    -1.559385475e-01f, -1.594491079e-01f, -1.604758231e-01f, -1.608633840e-01f, -1.637347807e-01f, -1.672616244e-01f, -1.683046420e-01f, -1.686758669e-01f,
+    -1.715309083e-01f, -1.750741419e-01f, -1.761335694e-01f, -1.764883489e-01f, -1.793269242e-01f, -1.828866604e-01f, -1.839626115e-01f, -1.843008300e-01f,
+    -1.871228225e-01f, -1.906991799e-01f, -1.917917745e-01f, -1.921133100e-01f, -1.949185967e-01f, -1.985117004e-01f, -1.996210648e-01f, -1.999257889e-01f,
+    -2.027142403e-01f, -2.063242220e-01f, -2.074504890e-01f, -2.077382668e-01f, -2.105097466e-01f, -2.141367447e-01f, -2.152800538e-01f, -2.155507436e-01f,
+    -2.183051089e-01f, -2.219492684e-01f, -2.231097662e-01f, -2.233632192e-01f, -2.261003200e-01f, -2.297617934e-01f, -2.309396334e-01f, -2.311756937e-01f,
+    -2.338953727e-01f, -2.375743195e-01f, -2.387696628e-01f, -2.389881670e-01f, -2.416902593e-01f, -2.453868468e-01f, -2.465998620e-01f, -2.468006391e-01f,
+    -2.494849723e-01f, -2.531993754e-01f, -2.544302389e-01f, -2.546131098e-01f, -2.572795035e-01f, -2.610119053e-01f, -2.622608017e-01f, -2.624255792e-01f,
+    -2.650738446e-01f, -2.688244366e-01f, -2.700915588e-01f, -2.702380473e-01f, -2.728679871e-01f, -2.766369693e-01f, -2.779225189e-01f, -2.780505139e-01f,
+    -2.806619220e-01f, -2.844495034e-01f, -2.857536912e-01f, -2.858629790e-01f, -2.884556402e-01f, -2.922620390e-01f, -2.935850850e-01f, -2.936754426e-01f,
+    -2.962491320e-01f, -3.000745762e-01f, -3.014167100e-01f, -3.014879046e-01f, -3.040423876e-01f, -3.078871151e-01f, -3.092485765e-01f, -3.093003649e-01f,
+    -3.118353964e-01f, -3.156996556e-01f, -3.170806949e-01f, -3.171128235e-01f, -3.196281479e-01f, -3.235121979e-01f, -3.249130763e-01f, -3.249252803e-01f,
+    -3.274206308e-01f, -3.313247420e-01f, -3.327457321e-01f, -3.327377352e-01f, -3.352128335e-01f, -3.391372881e-01f, -3.405786741e-01f, -3.405501882e-01f,
+    -3.430047437e-01f, -3.469498361e-01f, -3.484119149e-01f, -3.483626391e-01f, -3.507963487e-01f, -3.547623862e-01f, -3.562454673e-01f, -3.561750879e-01f,
+    -3.585876353e-01f, -3.625749386e-01f, -3.640793451e-01f, -3.639875344e-01f, -3.663785897e-01f, -3.703874932e-01f, -3.719135623e-01f, -3.717999786e-01f,
+    -3.741691972e-01f, -3.782000502e-01f, -3.797481338e-01f, -3.796124204e-01f, -3.819594427e-01f, -3.860126097e-01f, -3.875830752e-01f, -3.874248596e-01f,
+    -3.897493103e-01f, -3.938251718e-01f, -3.954184028e-01f, -3.952372961e-01f, -3.975387833e-01f, -4.016377367e-01f, -4.032541336e-01f, -4.030497298e-01f,
+    -4.053278441e-01f, -4.094503044e-01f, -4.110902858e-01f, -4.108621605e-01f, -4.131164743e-01f, -4.172628753e-01f, -4.189268780e-01f, -4.186745881e-01f,
+    -4.209046546e-01f, -4.250754493e-01f, -4.267639303e-01f, -4.264870124e-01f, -4.286923645e-01f, -4.328880267e-01f, -4.346014635e-01f, -4.342994333e-01f,
+    -4.364795827e-01f, -4.407006076e-01f, -4.424394997e-01f, -4.421118505e-01f, -4.442662864e-01f, -4.485131923e-01f, -4.502780621e-01f, -4.499242639e-01f,
+    -4.520524518e-01f, -4.563257810e-01f, -4.581171752e-01f, -4.577366731e-01f, -4.598380537e-01f, -4.641383738e-01f, -4.659568650e-01f, -4.655490781e-01f,
+    -4.676230654e-01f, -4.719509711e-01f, -4.737971588e-01f, -4.733614786e-01f, -4.754074588e-01f, -4.797635730e-01f, -4.816380857e-01f, -4.811738742e-01f,
+    -4.831912039e-01f, -4.875761799e-01f, -4.894796764e-01f, -4.889862647e-01f, -4.909742692e-01f, -4.953887921e-01f, -4.973219636e-01f, -4.967986498e-01f,
+    -4.987566210e-01f, -5.032014099e-01f, -5.051649817e-01f, -5.046110291e-01f, -5.065382236e-01f, -5.110140336e-01f, -5.130087677e-01f, -5.124234022e-01f,
+    -5.143190392e-01f, -5.188266636e-01f, -5.208533607e-01f, -5.202357689e-01f, -5.220990273e-01f, -5.266393004e-01f, -5.286988023e-01f, -5.280481286e-01f,
+    -5.298781449e-01f, -5.344519443e-01f, -5.365451369e-01f, -5.358604809e-01f, -5.376563462e-01f, -5.422645959e-01f, -5.443924121e-01f, -5.436728252e-01f,
+    -5.454335820e-01f, -5.500772558e-01f, -5.522406784e-01f, -5.514851610e-01f, -5.532097999e-01f, -5.578899244e-01f, -5.600899902e-01f, -5.592974878e-01f,
+    -5.609849439e-01f, -5.657026024e-01f, -5.679404055e-01f, -5.671098048e-01f, -5.687589537e-01f, -5.735152905e-01f, -5.757919867e-01f, -5.749221114e-01f,
+    -5.765317648e-01f, -5.813279895e-01f, -5.836448006e-01f, -5.827344067e-01f, -5.843033078e-01f, -5.891407001e-01f, -5.914989194e-01f, -5.905466899e-01f,
+    -5.920735079e-01f, -5.969534233e-01f, -5.993544205e-01f, -5.983589601e-01f, -5.998422847e-01f, -6.047661601e-01f, -6.072113876e-01f, -6.061712161e-01f,
+    -6.076095511e-01f, -6.125789115e-01f, -6.150699111e-01f, -6.139834569e-01f, -6.153752133e-01f, -6.203916788e-01f, -6.229300887e-01f, -6.217956812e-01f,
+    -6.231391694e-01f, -6.282044633e-01f, -6.307920265e-01f, -6.296078875e-01f, -6.309013091e-01f, -6.360172665e-01f, -6.386558394e-01f, -6.374200744e-01f,
+    -6.386615123e-01f, -6.438300900e-01f, -6.465216525e-01f, -6.452322400e-01f, -6.464196487e-01f, -6.516429357e-01f, -6.543896023e-01f, -6.530443825e-01f,
+    -6.541755756e-01f, -6.594558056e-01f, -6.622598374e-01f, -6.608564997e-01f, -6.619291377e-01f, -6.672687020e-01f, -6.701325207e-01f, -6.686685891e-01f,
+    -6.696801645e-01f, -6.750816274e-01f, -6.780078306e-01f, -6.764806481e-01f, -6.774284691e-01f, -6.828945848e-01f, -6.858859629e-01f, -6.842926736e-01f,
+    -6.851738458e-01f, -6.907075773e-01f, -6.937671336e-01f, -6.921046621e-01f, -6.929160682e-01f, -6.985206087e-01f, -7.016515808e-01f, -6.999166098e-01f,
+    -7.006548857e-01f, -7.063336831e-01f, -7.095395680e-01f, -7.077285121e-01f, -7.083900208e-01f, -7.141468052e-01f, -7.174313874e-01f, -7.155403642e-01f,
+    -7.161211655e-01f, -7.219599805e-01f, -7.253273644e-01f, -7.233521600e-01f, -7.238479763e-01f, -7.297732151e-01f, -7.332278618e-01f, -7.311638931e-01f,
+    -7.315700694e-01f, -7.375865162e-01f, -7.411332857e-01f, -7.389755558e-01f, -7.392870146e-01f, -7.453998920e-01f, -7.490440921e-01f, -7.467871392e-01f,
+    -7.469983280e-01f, -7.532133521e-01f, -7.569607952e-01f, -7.545986329e-01f, -7.547034634e-01f, -7.610269075e-01f, -7.648839759e-01f, -7.624100250e-01f,
+    -7.624018017e-01f, -7.688405713e-01f, -7.728142944e-01f, -7.702213014e-01f, -7.700926385e-01f, -7.766543589e-01f, -7.807525033e-01f, -7.780324454e-01f,
+    -7.777751689e-01f, -7.844682883e-01f, -7.886994643e-01f, -7.858434371e-01f, -7.854484689e-01f, -7.922823813e-01f, -7.966561694e-01f, -7.936542531e-01f,
+    -7.931114723e-01f, -8.000966635e-01f, -8.046237661e-01f, -8.014648649e-01f, -8.007629425e-01f, -8.079111662e-01f, -8.126035889e-01f, -8.092752382e-01f,
+    -8.084014371e-01f, -8.157259274e-01f, -8.205971994e-01f, -8.170853311e-01f, -8.160252627e-01f, -8.235409933e-01f, -8.286064367e-01f, -8.248950921e-01f,
+    -8.236324186e-01f, -8.313564212e-01f, -8.366334817e-01f, -8.327044573e-01f, -8.312205229e-01f, -8.391722827e-01f, -8.446809405e-01f, -8.405133468e-01f,
+    -8.387867179e-01f, -8.469886675e-01f, -8.527519537e-01f, -8.483216592e-01f, -8.463275448e-01f, -8.548056902e-01f, -8.608503401e-01f, -8.561292647e-01f,
+    -8.538387765e-01f, -8.626234983e-01f, -8.689807908e-01f, -8.639359950e-01f, -8.613151923e-01f, -8.704422849e-01f, -8.771491329e-01f, -8.717416281e-01f,
+    -8.687502677e-01f, -8.782623057e-01f, -8.853626961e-01f, -8.795458675e-01f, -8.761357400e-01f, -8.860839063e-01f, -8.936308297e-01f, -8.873483090e-01f,
+    -8.834609884e-01f, -8.939075621e-01f, -9.019656496e-01f, -8.951483905e-01f, -8.907121288e-01f, -9.017339414e-01f, -9.103831435e-01f, -9.029453120e-01f,
+    -8.978706558e-01f, -9.095640083e-01f, -9.189048506e-01f, -9.107379033e-01f, -9.049113471e-01f, -9.173991941e-01f, -9.275604997e-01f, -9.185243985e-01f,
+    -9.117989128e-01f, -9.252416984e-01f, -9.363923076e-01f, -9.263020305e-01f, -9.184824192e-01f, -9.330950413e-01f, -9.454623013e-01f, -9.340662651e-01f,
+    -9.248855466e-01f, -9.409651433e-01f, -9.548654705e-01f, -9.418092527e-01f, -9.308885401e-01f, -9.488625922e-01f, -9.647549909e-01f, -9.495164328e-01f,
+    -9.362922319e-01f, -9.568078605e-01f, -9.753947511e-01f, -9.571582739e-01f, -9.407392800e-01f, -9.648448375e-01f, -9.872811625e-01f, -9.646672037e-01f,
+    -9.435187984e-01f, -9.730820772e-01f, -1.001470440e+00f, -9.718594726e-01f, -9.429881951e-01f, -9.818518524e-01f, -1.020670362e+00f, -9.780799117e-01f,
+    -9.343245127e-01f, -9.926098394e-01f, -1.054460096e+00f, -9.794629364e-01f, -8.950159199e-01f, -1.019306729e+00f, -1.175070951e+00f, -8.694569670e-01f,
+    -2.656815710e-16f,  8.694569670e-01f,  1.175070951e+00f,  1.019306729e+00f,  8.950159199e-01f,  9.794629364e-01f,  1.054460096e+00f,  9.926098394e-01f,
+     9.343245127e-01f,  9.780799117e-01f,  1.020670362e+00f,  9.818518524e-01f,  9.429881951e-01f,  9.718594726e-01f,  1.001470440e+00f,  9.730820772e-01f,
+     9.435187984e-01f,  9.646672037e-01f,  9.872811625e-01f,  9.648448375e-01f,  9.407392800e-01f,  9.571582739e-01f,  9.753947511e-01f,  9.568078605e-01f,
+     9.362922319e-01f,  9.495164328e-01f,  9.647549909e-01f,  9.488625922e-01f,  9.308885401e-01f,  9.418092527e-01f,  9.548654705e-01f,  9.409651433e-01f,
+     9.248855466e-01f,  9.340662651e-01f,  9.454623013e-01f,  9.330950413e-01f,  9.184824192e-01f,  9.263020305e-01f,  9.363923076e-01f,  9.252416984e-01f,
+     9.117989128e-01f,  9.185243985e-01f,  9.275604997e-01f,  9.173991941e-01f,  9.049113471e-01f,  9.107379033e-01f,  9.189048506e-01f,  9.095640083e-01f,
+     8.978706558e-01f,  9.029453120e-01f,  9.103831435e-01f,  9.017339414e-01f,  8.907121288e-01f,  8.951483905e-01f,  9.019656496e-01f,  8.939075621e-01f,
+     8.834609884e-01f,  8.873483090e-01f,  8.936308297e-01f,  8.860839063e-01f,  8.761357400e-01f,  8.795458675e-01f,  8.853626961e-01f,  8.782623057e-01f,
+     8.687502677e-01f,  8.717416281e-01f,  8.771491329e-01f,  8.704422849e-01f,  8.613151923e-01f,  8.639359950e-01f,  8.689807908e-01f,  8.626234983e-01f,
+     8.538387765e-01f,  8.561292647e-01f,  8.608503401e-01f,  8.548056902e-01f,  8.463275448e-01f,  8.483216592e-01f,  8.527519537e-01f,  8.469886675e-01f,
+     8.387867179e-01f,  8.405133468e-01f,  8.446809405e-01f,  8.391722827e-01f,  8.312205229e-01f,  8.327044573e-01f,  8.366334817e-01f,  8.313564212e-01f,
+     8.236324186e-01f,  8.248950921e-01f,  8.286064367e-01f,  8.235409933e-01f,  8.160252627e-01f,  8.170853311e-01f,  8.205971994e-01f,  8.157259274e-01f,
+     8.084014371e-01f,  8.092752382e-01f,  8.126035889e-01f,  8.079111662e-01f,  8.007629425e-01f,  8.014648649e-01f,  8.046237661e-01f,  8.000966635e-01f,
+     7.931114723e-01f,  7.936542531e-01f,  7.966561694e-01f,  7.922823813e-01f,  7.854484689e-01f,  7.858434371e-01f,  7.886994643e-01f,  7.844682883e-01f,
+     7.777751689e-01f,  7.780324454e-01f,  7.807525033e-01f,  7.766543589e-01f,  7.700926385e-01f,  7.702213014e-01f,  7.728142944e-01f,  7.688405713e-01f,
+     7.624018017e-01f,  7.624100250e-01f,  7.648839759e-01f,  7.610269075e-01f,  7.547034634e-01f,  7.545986329e-01f,  7.569607952e-01f,  7.532133521e-01f,
+     7.469983280e-01f,  7.467871392e-01f,  7.490440921e-01f,  7.453998920e-01f,  7.392870146e-01f,  7.389755558e-01f,  7.411332857e-01f,  7.375865162e-01f,
+     7.315700694e-01f,  7.311638931e-01f,  7.332278618e-01f,  7.297732151e-01f,  7.238479763e-01f,  7.233521600e-01f,  7.253273644e-01f,  7.219599805e-01f,
+     7.161211655e-01f,  7.155403642e-01f,  7.174313874e-01f,  7.141468052e-01f,  7.083900208e-01f,  7.077285121e-01f,  7.095395680e-01f,  7.063336831e-01f,
+     7.006548857e-01f,  6.999166098e-01f,  7.016515808e-01f,  6.985206087e-01f,  6.929160682e-01f,  6.921046621e-01f,  6.937671336e-01f,  6.907075773e-01f,
+     6.851738458e-01f,  6.842926736e-01f,  6.858859629e-01f,  6.828945848e-01f,  6.774284691e-01f,  6.764806481e-01f,  6.780078306e-01f,  6.750816274e-01f,
+     6.696801645e-01f,  6.686685891e-01f,  6.701325207e-01f,  6.672687020e-01f,  6.619291377e-01f,  6.608564997e-01f,  6.622598374e-01f,  6.594558056e-01f,
+     6.541755756e-01f,  6.530443825e-01f,  6.543896023e-01f,  6.516429357e-01f,  6.464196487e-01f,  6.452322400e-01f,  6.465216525e-01f,  6.438300900e-01f,
+     6.386615123e-01f,  6.374200744e-01f,  6.386558394e-01f,  6.360172665e-01f,  6.309013091e-01f,  6.296078875e-01f,  6.307920265e-01f,  6.282044633e-01f,
+     6.231391694e-01f,  6.217956812e-01f,  6.229300887e-01f,  6.203916788e-01f,  6.153752133e-01f,  6.139834569e-01f,  6.150699111e-01f,  6.125789115e-01f,
+     6.076095511e-01f,  6.061712161e-01f,  6.072113876e-01f,  6.047661601e-01f,  5.998422847e-01f,  5.983589601e-01f,  5.993544205e-01f,  5.969534233e-01f,
+     5.920735079e-01f,  5.905466899e-01f,  5.914989194e-01f,  5.891407001e-01f,  5.843033078e-01f,  5.827344067e-01f,  5.836448006e-01f,  5.813279895e-01f,
+     5.765317648e-01f,  5.749221114e-01f,  5.757919867e-01f,  5.735152905e-01f,  5.687589537e-01f,  5.671098048e-01f,  5.679404055e-01f,  5.657026024e-01f,
+     5.609849439e-01f,  5.592974878e-01f,  5.600899902e-01f,  5.578899244e-01f,  5.532097999e-01f,  5.514851610e-01f,  5.522406784e-01f,  5.500772558e-01f,
+     5.454335820e-01f,  5.436728252e-01f,  5.443924121e-01f,  5.422645959e-01f,  5.376563462e-01f,  5.358604809e-01f,  5.365451369e-01f,  5.344519443e-01f,
+     5.298781449e-01f,  5.280481286e-01f,  5.286988023e-01f,  5.266393004e-01f,  5.220990273e-01f,  5.202357689e-01f,  5.208533607e-01f,  5.188266636e-01f,
+     5.143190392e-01f,  5.124234022e-01f,  5.130087677e-01f,  5.110140336e-01f,  5.065382236e-01f,  5.046110291e-01f,  5.051649817e-01f,  5.032014099e-01f,
+     4.987566210e-01f,  4.967986498e-01f,  4.973219636e-01f,  4.953887921e-01f,  4.909742692e-01f,  4.889862647e-01f,  4.894796764e-01f,  4.875761799e-01f,
+     4.831912039e-01f,  4.811738742e-01f,  4.816380857e-01f,  4.797635730e-01f,  4.754074588e-01f,  4.733614786e-01f,  4.737971588e-01f,  4.719509711e-01f,
+     4.676230654e-01f,  4.655490781e-01f,  4.659568650e-01f,  4.641383738e-01f,  4.598380537e-01f,  4.577366731e-01f,  4.581171752e-01f,  4.563257810e-01f,
+     4.520524518e-01f,  4.499242639e-01f,  4.502780621e-01f,  4.485131923e-01f,  4.442662864e-01f,  4.421118505e-01f,  4.424394997e-01f,  4.407006076e-01f,
+     4.364795827e-01f,  4.342994333e-01f,  4.346014635e-01f,  4.328880267e-01f,  4.286923645e-01f,  4.264870124e-01f,  4.267639303e-01f,  4.250754493e-01f,
+     4.209046546e-01f,  4.186745881e-01f,  4.189268780e-01f,  4.172628753e-01f,  4.131164743e-01f,  4.108621605e-01f,  4.110902858e-01f,  4.094503044e-01f,
+     4.053278441e-01f,  4.030497298e-01f,  4.032541336e-01f,  4.016377367e-01f,  3.975387833e-01f,  3.952372961e-01f,  3.954184028e-01f,  3.938251718e-01f,
+     3.897493103e-01f,  3.874248596e-01f,  3.875830752e-01f,  3.860126097e-01f,  3.819594427e-01f,  3.796124204e-01f,  3.797481338e-01f,  3.782000502e-01f,
+     3.741691972e-01f,  3.717999786e-01f,  3.719135623e-01f,  3.703874932e-01f,  3.663785897e-01f,  3.639875344e-01f,  3.640793451e-01f,  3.625749386e-01f,
+     3.585876353e-01f,  3.561750879e-01f,  3.562454673e-01f,  3.547623862e-01f,  3.507963487e-01f,  3.483626391e-01f,  3.484119149e-01f,  3.469498361e-01f,
+     3.430047437e-01f,  3.405501882e-01f,  3.405786741e-01f,  3.391372881e-01f,  3.352128335e-01f,  3.327377352e-01f,  3.327457321e-01f,  3.313247420e-01f,
+     3.274206308e-01f,  3.249252803e-01f,  3.249130763e-01f,  3.235121979e-01f,  3.196281479e-01f,  3.171128235e-01f,  3.170806949e-01f,  3.156996556e-01f,
+     3.118353964e-01f,  3.093003649e-01f,  3.092485765e-01f,  3.078871151e-01f,  3.040423876e-01f,  3.014879046e-01f,  3.014167100e-01f,  3.000745762e-01f,
+     2.962491320e-01f,  2.936754426e-01f,  2.935850850e-01f,  2.922620390e-01f,  2.884556402e-01f,  2.858629790e-01f,  2.857536912e-01f,  2.844495034e-01f,
+     2.806619220e-01f,  2.780505139e-01f,  2.779225189e-01f,  2.766369693e-01f,  2.728679871e-01f,  2.702380473e-01f,  2.700915588e-01f,  2.688244366e-01f,
+     2.650738446e-01f,  2.624255792e-01f,  2.622608017e-01f,  2.610119053e-01f,  2.572795035e-01f,  2.546131098e-01f,  2.544302389e-01f,  2.531993754e-01f,
+     2.494849723e-01f,  2.468006391e-01f,  2.465998620e-01f,  2.453868468e-01f,  2.416902593e-01f,  2.389881670e-01f,  2.387696628e-01f,  2.375743195e-01f,
+     2.338953727e-01f,  2.311756937e-01f,  2.309396334e-01f,  2.297617934e-01f,  2.261003200e-01f,  2.233632192e-01f,  2.231097662e-01f,  2.219492684e-01f,
+     2.183051089e-01f,  2.155507436e-01f,  2.152800538e-01f,  2.141367447e-01f,  2.105097466e-01f,  2.077382668e-01f,  2.074504890e-01f,  2.063242220e-01f,
+     2.027142403e-01f,  1.999257889e-01f,  1.996210648e-01f,  1.985117004e-01f,  1.949185967e-01f,  1.921133100e-01f,  1.917917745e-01f,  1.906991799e-01f,
+     1.871228225e-01f,  1.843008300e-01f,  1.839626115e-01f,  1.828866604e-01f,  1.793269242e-01f,  1.764883489e-01f,  1.761335694e-01f,  1.750741419e-01f,
+     1.715309083e-01f,  1.686758669e-01f,  1.683046420e-01f,  1.672616244e-01f,  1.637347807e-01f,  1.608633840e-01f,  1.604758231e-01f,  1.594491079e-01f,
+     1.559385475e-01f,  1.530509001e-01f,  1.526471068e-01f,  1.516365922e-01f,  1.481422147e-01f,  1.452384153e-01f,  1.448184873e-01f,  1.438240775e-01f,
+     1.403457879e-01f,  1.374259295e-01f,  1.369899590e-01f,  1.360115636e-01f,  1.325492727e-01f,  1.296134429e-01f,  1.291615163e-01f,  1.281990507e-01f,
+     1.247526747e-01f,  1.218009555e-01f,  1.213331537e-01f,  1.203865386e-01f,  1.169559993e-01f,  1.139884672e-01f,  1.135048658e-01f,  1.125740273e-01f,
+     1.091592517e-01f,  1.061759780e-01f,  1.056766475e-01f,  1.047615168e-01f,  1.013624371e-01f,  9.836348808e-02f,  9.784849364e-02f,  9.694900720e-02f,
+     9.356556077e-02f,  9.055099731e-02f,  9.002039902e-02f,  8.913649837e-02f,  8.576862762e-02f,  8.273850576e-02f,  8.219235868e-02f,  8.132399032e-02f,
+     7.797164267e-02f,  7.492601341e-02f,  7.436436769e-02f,  7.351148305e-02f,  7.017461082e-02f,  6.711352030e-02f,  6.653642117e-02f,  6.569897655e-02f,
+     6.237753693e-02f,  5.930102641e-02f,  5.870851428e-02f,  5.788647081e-02f,  5.458042579e-02f,  5.148853177e-02f,  5.088064226e-02f,  5.007396583e-02f,
+     4.678328216e-02f,  4.367603638e-02f,  4.305280037e-02f,  4.226146159e-02f,  3.898611075e-02f,  3.586354024e-02f,  3.522498391e-02f,  3.444895810e-02f,
+     3.118891624e-02f,  2.805104336e-02f,  2.739718822e-02f,  2.663645535e-02f,  2.339170329e-02f,  2.023854575e-02f,  1.956940865e-02f,  1.882395334e-02f,
+     1.559447653e-02f,  1.242604739e-02f,  1.174164059e-02f,  1.101145206e-02f,  7.797240561e-03f,  4.613548308e-03f,  3.913879432e-03f,  3.198951509e-03f,
+     0.000000000e+00f,
+  },
+  { // level 2: 127 harmonics
+     0.000000000e+00f, -3.713029380e-03f, -6.402760102e-03f, -7.640858899e-03f, -7.843018179e-03f, -8.027299696e-03f, -9.222236972e-03f, -1.186880464e-02f,
+    -1.556395445e-02f, -1.929486517e-02f, -2.202776888e-02f, -2.330904528e-02f, -2.352909132e-02f, -2.369548252e-02f, -2.484722232e-02f, -2.745058482e-02f,
+    -3.112783528e-02f, -3.487665070e-02f, -3.765278942e-02f, -3.897731160e-02f, -3.921527500e-02f, -3.936374171e-02f, -4.047219588e-02f, -4.303225887e-02f,
+    -4.669156854e-02f, -5.045833367e-02f, -5.327782180e-02f, -5.464571040e-02f, -5.490164348e-02f, -5.503212978e-02f, -5.609715752e-02f, -5.861377393e-02f,
+    -6.225507952e-02f, -6.603986129e-02f, -6.890286619e-02f, -7.031429486e-02f, -7.058827196e-02f, -7.070069984e-02f, -7.172210705e-02f, -7.419507643e-02f,
+    -7.781829247e-02f, -8.162118003e-02f, -8.452792281e-02f, -8.598311907e-02f, -8.627523688e-02f, -8.636950593e-02f, -8.734704422e-02f, -8.977611170e-02f,
+    -9.338113017e-02f, -9.720223533e-02f, -1.001529919e-01f, -1.016522383e-01f, -1.019626163e-01f, -1.020386032e-01f, -1.029719687e-01f, -1.053568238e-01f,
+    -1.089435135e-01f, -1.127829713e-01f, -1.157780739e-01f, -1.173217093e-01f, -1.176504905e-01f, -1.177080483e-01f, -1.185968802e-01f, -1.209371551e-01f,
+    -1.245053612e-01f, -1.283633306e-01f, -1.314031691e-01f, -1.329915905e-01f, -1.333389420e-01f, -1.333778996e-01f, -1.342217782e-01f, -1.365170463e-01f,
+    -1.400665892e-01f, -1.439432537e-01f, -1.470282781e-01f, -1.486619425e-01f, -1.490280563e-01f, -1.490482175e-01f, -1.498466621e-01f, -1.520964354e-01f,
+    -1.556271102e-01f, -1.595226791e-01f, -1.626534013e-01f, -1.643328283e-01f, -1.647179226e-01f, -1.647190648e-01f, -1.654715315e-01f, -1.676752581e-01f,
+    -1.711868335e-01f, -1.751015427e-01f, -1.782785396e-01f, -1.800043138e-01f, -1.804086336e-01f, -1.803905071e-01f, -1.810963855e-01f, -1.832534472e-01f,
+    -1.867456638e-01f, -1.906797773e-01f, -1.939036935e-01f, -1.956764678e-01f, -1.961002869e-01f, -1.960626132e-01f, -1.967212234e-01f, -1.988309319e-01f,
+    -2.023035014e-01f, -2.062573124e-01f, -2.095288639e-01f, -2.113493631e-01f, -2.117929848e-01f, -2.117354554e-01f, -2.123460443e-01f, -2.144076375e-01f,
+    -2.178602408e-01f, -2.218340737e-01f, -2.251540519e-01f, -2.270230764e-01f, -2.274868359e-01f, -2.274091103e-01f, -2.279708472e-01f, -2.299834850e-01f,
+    -2.334157706e-01f, -2.374099824e-01f, -2.407792584e-01f, -2.426976891e-01f, -2.431819549e-01f, -2.430836588e-01f, -2.435956310e-01f, -2.455583905e-01f,
+    -2.489699722e-01f, -2.529849551e-01f, -2.564044847e-01f, -2.583732878e-01f, -2.588784642e-01f, -2.587591873e-01f, -2.592203944e-01f, -2.611322645e-01f,
+    -2.645227194e-01f, -2.685589025e-01f, -2.720297321e-01f, -2.740499650e-01f, -2.745764943e-01f, -2.744357878e-01f, -2.748451358e-01f, -2.767050111e-01f,
+    -2.800738770e-01f, -2.841317294e-01f, -2.876550022e-01f, -2.897278201e-01f, -2.902761852e-01f, -2.901135590e-01f, -2.904698538e-01f, -2.922765277e-01f,
+    -2.956233000e-01f, -2.997033334e-01f, -3.032802966e-01f, -3.054069596e-01f, -3.059776874e-01f, -3.057926072e-01f, -3.060945464e-01f, -3.078467034e-01f,
+    -3.111708320e-01f, -3.152736044e-01f, -3.189056174e-01f, -3.210874987e-01f, -3.216811633e-01f, -3.214730468e-01f, -3.217192116e-01f, -3.234154184e-01f,
+    -3.267163043e-01f, -3.308424233e-01f, -3.345309668e-01f, -3.367695619e-01f, -3.373867886e-01f, -3.371550018e-01f, -3.373438471e-01f, -3.389825430e-01f,
+    -3.422595337e-01f, -3.464096609e-01f, -3.501563471e-01f, -3.524532847e-01f, -3.530947542e-01f, -3.528386065e-01f, -3.529684502e-01f, -3.545479361e-01f,
+    -3.578003211e-01f, -3.619751771e-01f, -3.657817613e-01f, -3.681388143e-01f, -3.688052680e-01f, -3.685240077e-01f, -3.685930180e-01f, -3.701114435e-01f,
+    -3.733384494e-01f, -3.775388185e-01f, -3.814072124e-01f, -3.838263120e-01f, -3.845185571e-01f, -3.842113655e-01f, -3.842175470e-01f, -3.856728966e-01f,
+    -3.888736806e-01f, -3.931004177e-01f, -3.970327041e-01f, -3.995159544e-01f, -4.002348708e-01f, -3.999008554e-01f, -3.998420335e-01f, -4.012321101e-01f,
+    -4.044057536e-01f, -4.086597905e-01f, -4.126582405e-01f, -4.152079360e-01f, -4.159544830e-01f, -4.155926705e-01f, -4.154664731e-01f, -4.167888799e-01f,
+    -4.199343806e-01f, -4.242167342e-01f, -4.282838262e-01f, -4.309024713e-01f, -4.316776962e-01f, -4.312870240e-01f, -4.310908608e-01f, -4.323429802e-01f,
+    -4.354592435e-01f, -4.397710246e-01f, -4.439094666e-01f, -4.465997979e-01f, -4.474048455e-01f, -4.469841519e-01f, -4.467151908e-01f, -4.478941606e-01f,
+    -4.509799892e-01f, -4.553224130e-01f, -4.595351679e-01f, -4.623001801e-01f, -4.631363030e-01f, -4.626843162e-01f, -4.623394565e-01f, -4.634421422e-01f,
+    -4.664962248e-01f, -4.708706228e-01f, -4.751609370e-01f, -4.780039125e-01f, -4.788724840e-01f, -4.783878096e-01f, -4.779636505e-01f, -4.789866134e-01f,
+    -4.820075111e-01f, -4.864153446e-01f, -4.907867822e-01f, -4.937113250e-01f, -4.946138533e-01f, -4.940949593e-01f, -4.935877637e-01f, -4.945272247e-01f,
+    -4.975133557e-01f, -5.019562316e-01f, -5.064127130e-01f, -5.094227883e-01f, -5.103609332e-01f, -5.098061330e-01f, -5.092117861e-01f, -5.100635823e-01f,
+    -5.130132041e-01f, -5.174928935e-01f, -5.220387405e-01f, -5.251387208e-01f, -5.261143132e-01f, -5.255217457e-01f, -5.248357056e-01f, -5.255952411e-01f,
+    -5.285064290e-01f, -5.330248888e-01f, -5.376648776e-01f, -5.408595969e-01f, -5.418746611e-01f, -5.412422675e-01f, -5.404595080e-01f, -5.411216954e-01f,
+    -5.439923185e-01f, -5.485517163e-01f, -5.532911397e-01f, -5.565859563e-01f, -5.576427371e-01f, -5.569682334e-01f, -5.560831769e-01f, -5.566423683e-01f,
+    -5.594700600e-01f, -5.640728044e-01f, -5.689175448e-01f, -5.723184163e-01f, -5.734194105e-01f, -5.727002550e-01f, -5.717066925e-01f, -5.721565983e-01f,
+    -5.749387222e-01f, -5.795874978e-01f, -5.845441144e-01f, -5.880576867e-01f, -5.892056805e-01f, -5.884390351e-01f, -5.873300311e-01f, -5.876636229e-01f,
+    -5.903972320e-01f, -5.950950416e-01f, -6.001708746e-01f, -6.038045875e-01f, -6.050027013e-01f, -6.041853856e-01f, -6.029531645e-01f, -6.031625588e-01f,
+    -6.058443458e-01f, -6.105945614e-01f, -6.157978563e-01f, -6.195600719e-01f, -6.208118144e-01f, -6.199402497e-01f, -6.185760583e-01f, -6.186523761e-01f,
+    -6.212786146e-01f, -6.260850383e-01f, -6.314250974e-01f, -6.353252543e-01f, -6.366345879e-01f, -6.357047298e-01f, -6.341986706e-01f, -6.341318667e-01f,
+    -6.366983385e-01f, -6.415652776e-01f, -6.470526443e-01f, -6.511014466e-01f, -6.524728673e-01f, -6.514801228e-01f, -6.498209502e-01f, -6.495996037e-01f,
+    -6.521015103e-01f, -6.570338689e-01f, -6.626805543e-01f, -6.668902038e-01f, -6.683288397e-01f, -6.672679655e-01f, -6.654428329e-01f, -6.650538891e-01f,
+    -6.674857422e-01f, -6.724891348e-01f, -6.783088987e-01f, -6.826933836e-01f, -6.842051175e-01f, -6.830700926e-01f, -6.810642390e-01f, -6.804926861e-01f,
+    -6.828481704e-01f, -6.879290641e-01f, -6.939377674e-01f, -6.985132241e-01f, -7.001048470e-01f, -6.988887131e-01f, -6.966850670e-01f, -6.959135298e-01f,
+    -6.981853301e-01f, -7.033512247e-01f, -7.095672749e-01f, -7.143524466e-01f, -7.160318528e-01f, -7.147265114e-01f, -7.123051873e-01f, -7.113134082e-01f,
+    -7.134929886e-01f, -7.187526466e-01f, -7.251975688e-01f, -7.302143941e-01f, -7.319908318e-01f, -7.305867824e-01f, -7.279244313e-01f, -7.266886008e-01f,
+    -7.287659196e-01f, -7.341296643e-01f, -7.408288419e-01f, -7.461032192e-01f, -7.479876166e-01f, -7.464736158e-01f, -7.435425774e-01f, -7.420344576e-01f,
+    -7.439975930e-01f, -7.494777001e-01f, -7.564613502e-01f, -7.620241461e-01f, -7.640295425e-01f, -7.623921522e-01f, -7.591593290e-01f, -7.573450888e-01f,
+    -7.591797407e-01f, -7.647909616e-01f, -7.720954392e-01f, -7.779838402e-01f, -7.801259639e-01f, -7.783489431e-01f, -7.747742817e-01f, -7.726129215e-01f,
+    -7.743017367e-01f, -7.800620093e-01f, -7.877315840e-01f, -7.939909417e-01f, -7.962890021e-01f, -7.943524715e-01f, -7.903868736e-01f, -7.878280525e-01f,
+    -7.893496916e-01f, -7.952811267e-01f, -8.033704533e-01f, -8.100568565e-01f, -8.125346499e-01f, -8.104139206e-01f, -8.059963048e-01f, -8.029772770e-01f,
+    -8.043050950e-01f, -8.104353763e-01f, -8.190130109e-01f, -8.261969585e-01f, -8.288844516e-01f, -8.265483406e-01f, -8.216014050e-01f, -8.180425871e-01f,
+    -8.191427194e-01f, -8.255071447e-01f, -8.346606884e-01f, -8.424324791e-01f, -8.453681410e-01f, -8.427764783e-01f, -8.372004082e-01f, -8.329987715e-01f,
+    -8.338272702e-01f, -8.404718219e-01f, -8.503156849e-01f, -8.587935893e-01f, -8.620279399e-01f, -8.591277519e-01f, -8.527905475e-01f, -8.478094154e-01f,
+    -8.483078084e-01f, -8.552939457e-01f, -8.659815210e-01f, -8.753246539e-01f, -8.789258801e-01f, -8.756453055e-01f, -8.683672886e-01f, -8.624199053e-01f,
+    -8.625080096e-01f, -8.699204869e-01f, -8.816641169e-01f, -8.920936810e-01f, -8.961569562e-01f, -8.923950612e-01f, -8.839227819e-01f, -8.767444550e-01f,
+    -8.763081143e-01f, -8.842684517e-01f, -8.973740604e-01f, -9.092104649e-01f, -9.138743487e-01f, -9.094830056e-01f, -8.994424670e-01f, -8.906402079e-01f,
+    -8.895089497e-01f, -8.982002864e-01f, -9.131318241e-01f, -9.268644232e-01f, -9.323419507e-01f, -9.270909898e-01f, -9.148968123e-01f, -9.038504597e-01f,
+    -9.017531692e-01f, -9.114703907e-01f, -9.289812973e-01f, -9.454124780e-01f, -9.520561786e-01f, -9.455590900e-01f, -9.302182456e-01f, -9.158635891e-01f,
+    -9.123298822e-01f, -9.235937399e-01f, -9.450310338e-01f, -9.656155677e-01f, -9.740732519e-01f, -9.656041559e-01f, -9.452230172e-01f, -9.254949315e-01f,
+    -9.195964919e-01f, -9.334633701e-01f, -9.616133066e-01f, -9.894286393e-01f, -1.001100953e+00f, -9.890328340e-01f, -9.592559583e-01f, -9.292595835e-01f,
+    -9.187300362e-01f, -9.379100318e-01f, -9.801837920e-01f, -1.023773261e+00f, -1.042718455e+00f, -1.021977534e+00f, -9.684514843e-01f, -9.109371853e-01f,
+    -8.872186793e-01f, -9.233011695e-01f, -1.014693181e+00f, -1.119879629e+00f, -1.171157072e+00f, -1.099932780e+00f, -8.662580155e-01f, -4.794670060e-01f,
+    -2.386618002e-16f,  4.794670060e-01f,  8.662580155e-01f,  1.099932780e+00f,  1.171157072e+00f,  1.119879629e+00f,  1.014693181e+00f,  9.233011695e-01f,
+     8.872186793e-01f,  9.109371853e-01f,  9.684514843e-01f,  1.021977534e+00f,  1.042718455e+00f,  1.023773261e+00f,  9.801837920e-01f,  9.379100318e-01f,
+     9.187300362e-01f,  9.292595835e-01f,  9.592559583e-01f,  9.890328340e-01f,  1.001100953e+00f,  9.894286393e-01f,  9.616133066e-01f,  9.334633701e-01f,
+     9.195964919e-01f,  9.254949315e-01f,  9.452230172e-01f,  9.656041559e-01f,  9.740732519e-01f,  9.656155677e-01f,  9.450310338e-01f,  9.235937399e-01f,
+     9.123298822e-01f,  9.158635891e-01f,  9.302182456e-01f,  9.455590900e-01f,  9.520561786e-01f,  9.454124780e-01f,  9.289812973e-01f,  9.114703907e-01f,
+     9.017531692e-01f,  9.038504597e-01f,  9.148968123e-01f,  9.270909898e-01f,  9.323419507e-01f,  9.268644232e-01f,  9.131318241e-01f,  8.982002864e-01f,
+     8.895089497e-01f,  8.906402079e-01f,  8.994424670e-01f,  9.094830056e-01f,  9.138743487e-01f,  9.092104649e-01f,  8.973740604e-01f,  8.842684517e-01f,
+     8.763081143e-01f,  8.767444550e-01f,  8.839227819e-01f,  8.923950612e-01f,  8.961569562e-01f,  8.920936810e-01f,  8.816641169e-01f,  8.699204869e-01f,
+     8.625080096e-01f,  8.624199053e-01f,  8.683672886e-01f,  8.756453055e-01f,  8.789258801e-01f,  8.753246539e-01f,  8.659815210e-01f,  8.552939457e-01f,
+     8.483078084e-01f,  8.478094154e-01f,  8.527905475e-01f,  8.591277519e-01f,  8.620279399e-01f,  8.587935893e-01f,  8.503156849e-01f,  8.404718219e-01f,
+     8.338272702e-01f,  8.329987715e-01f,  8.372004082e-01f,  8.427764783e-01f,  8.453681410e-01f,  8.424324791e-01f,  8.346606884e-01f,  8.255071447e-01f,
+     8.191427194e-01f,  8.180425871e-01f,  8.216014050e-01f,  8.265483406e-01f,  8.288844516e-01f,  8.261969585e-01f,  8.190130109e-01f,  8.104353763e-01f,
+     8.043050950e-01f,  8.029772770e-01f,  8.059963048e-01f,  8.104139206e-01f,  8.125346499e-01f,  8.100568565e-01f,  8.033704533e-01f,  7.952811267e-01f,
+     7.893496916e-01f,  7.878280525e-01f,  7.903868736e-01f,  7.943524715e-01f,  7.962890021e-01f,  7.939909417e-01f,  7.877315840e-01f,  7.800620093e-01f,
+     7.743017367e-01f,  7.726129215e-01f,  7.747742817e-01f,  7.783489431e-01f,  7.801259639e-01f,  7.779838402e-01f,  7.720954392e-01f,  7.647909616e-01f,
+     7.591797407e-01f,  7.573450888e-01f,  7.591593290e-01f,  7.623921522e-01f,  7.640295425e-01f,  7.620241461e-01f,  7.564613502e-01f,  7.494777001e-01f,
+     7.439975930e-01f,  7.420344576e-01f,  7.435425774e-01f,  7.464736158e-01f,  7.479876166e-01f,  7.461032192e-01f,  7.408288419e-01f,  7.341296643e-01f,
+     7.287659196e-01f,  7.266886008e-01f,  7.279244313e-01f,  7.305867824e-01f,  7.319908318e-01f,  7.302143941e-01f,  7.251975688e-01f,  7.187526466e-01f,
+     7.134929886e-01f,  7.113134082e-01f,  7.123051873e-01f,  7.147265114e-01f,  7.160318528e-01f,  7.143524466e-01f,  7.095672749e-01f,  7.033512247e-01f,
+     6.981853301e-01f,  6.959135298e-01f,  6.966850670e-01f,  6.988887131e-01f,  7.001048470e-01f,  6.985132241e-01f,  6.939377674e-01f,  6.879290641e-01f,
+     6.828481704e-01f,  6.804926861e-01f,  6.810642390e-01f,  6.830700926e-01f,  6.842051175e-01f,  6.826933836e-01f,  6.783088987e-01f,  6.724891348e-01f,
+     6.674857422e-01f,  6.650538891e-01f,  6.654428329e-01f,  6.672679655e-01f,  6.683288397e-01f,  6.668902038e-01f,  6.626805543e-01f,  6.570338689e-01f,
+     6.521015103e-01f,  6.495996037e-01f,  6.498209502e-01f,  6.514801228e-01f,  6.524728673e-01f,  6.511014466e-01f,  6.470526443e-01f,  6.415652776e-01f,
+     6.366983385e-01f,  6.341318667e-01f,  6.341986706e-01f,  6.357047298e-01f,  6.366345879e-01f,  6.353252543e-01f,  6.314250974e-01f,  6.260850383e-01f,
+     6.212786146e-01f,  6.186523761e-01f,  6.185760583e-01f,  6.199402497e-01f,  6.208118144e-01f,  6.195600719e-01f,  6.157978563e-01f,  6.105945614e-01f,
+     6.058443458e-01f,  6.031625588e-01f,  6.029531645e-01f,  6.041853856e-01f,  6.050027013e-01f,  6.038045875e-01f,  6.001708746e-01f,  5.950950416e-01f,
+     5.903972320e-01f,  5.876636229e-01f,  5.873300311e-01f,  5.884390351e-01f,  5.892056805e-01f,  5.880576867e-01f,  5.845441144e-01f,  5.795874978e-01f,
+     5.749387222e-01f,  5.721565983e-01f,  5.717066925e-01f,  5.727002550e-01f,  5.734194105e-01f,  5.723184163e-01f,  5.689175448e-01f,  5.640728044e-01f,
+     5.594700600e-01f,  5.566423683e-01f,  5.560831769e-01f,  5.569682334e-01f,  5.576427371e-01f,  5.565859563e-01f,  5.532911397e-01f,  5.485517163e-01f,
+     5.439923185e-01f,  5.411216954e-01f,  5.404595080e-01f,  5.412422675e-01f,  5.418746611e-01f,  5.408595969e-01f,  5.376648776e-01f,  5.330248888e-01f,
+     5.285064290e-01f,  5.255952411e-01f,  5.248357056e-01f,  5.255217457e-01f,  5.261143132e-01f,  5.251387208e-01f,  5.220387405e-01f,  5.174928935e-01f,
+     5.130132041e-01f,  5.100635823e-01f,  5.092117861e-01f,  5.098061330e-01f,  5.103609332e-01f,  5.094227883e-01f,  5.064127130e-01f,  5.019562316e-01f,
+     4.975133557e-01f,  4.945272247e-01f,  4.935877637e-01f,  4.940949593e-01f,  4.946138533e-01f,  4.937113250e-01f,  4.907867822e-01f,  4.864153446e-01f,
+     4.820075111e-01f,  4.789866134e-01f,  4.779636505e-01f,  4.783878096e-01f,  4.788724840e-01f,  4.780039125e-01f,  4.751609370e-01f,  4.708706228e-01f,
+     4.664962248e-01f,  4.634421422e-01f,  4.623394565e-01f,  4.626843162e-01f,  4.631363030e-01f,  4.623001801e-01f,  4.595351679e-01f,  4.553224130e-01f,
+     4.509799892e-01f,  4.478941606e-01f,  4.467151908e-01f,  4.469841519e-01f,  4.474048455e-01f,  4.465997979e-01f,  4.439094666e-01f,  4.397710246e-01f,
+     4.354592435e-01f,  4.323429802e-01f,  4.310908608e-01f,  4.312870240e-01f,  4.316776962e-01f,  4.309024713e-01f,  4.282838262e-01f,  4.242167342e-01f,
+     4.199343806e-01f,  4.167888799e-01f,  4.154664731e-01f,  4.155926705e-01f,  4.159544830e-01f,  4.152079360e-01f,  4.126582405e-01f,  4.086597905e-01f,
+     4.044057536e-01f,  4.012321101e-01f,  3.998420335e-01f,  3.999008554e-01f,  4.002348708e-01f,  3.995159544e-01f,  3.970327041e-01f,  3.931004177e-01f,
+     3.888736806e-01f,  3.856728966e-01f,  3.842175470e-01f,  3.842113655e-01f,  3.845185571e-01f,  3.838263120e-01f,  3.814072124e-01f,  3.775388185e-01f,
+     3.733384494e-01f,  3.701114435e-01f,  3.685930180e-01f,  3.685240077e-01f,  3.688052680e-01f,  3.681388143e-01f,  3.657817613e-01f,  3.619751771e-01f,
+     3.578003211e-01f,  3.545479361e-01f,  3.529684502e-01f,  3.528386065e-01f,  3.530947542e-01f,  3.524532847e-01f,  3.501563471e-01f,  3.464096609e-01f,
+     3.422595337e-01f,  3.389825430e-01f,  3.373438471e-01f,  3.371550018e-01f,  3.373867886e-01f,  3.367695619e-01f,  3.345309668e-01f,  3.308424233e-01f,
+     3.267163043e-01f,  3.234154184e-01f,  3.217192116e-01f,  3.214730468e-01f,  3.216811633e-01f,  3.210874987e-01f,  3.189056174e-01f,  3.152736044e-01f,
+     3.111708320e-01f,  3.078467034e-01f,  3.060945464e-01f,  3.057926072e-01f,  3.059776874e-01f,  3.054069596e-01f,  3.032802966e-01f,  2.997033334e-01f,
+     2.956233000e-01f,  2.922765277e-01f,  2.904698538e-01f,  2.901135590e-01f,  2.902761852e-01f,  2.897278201e-01f,  2.876550022e-01f,  2.841317294e-01f,
+     2.800738770e-01f,  2.767050111e-01f,  2.748451358e-01f,  2.744357878e-01f,  2.745764943e-01f,  2.740499650e-01f,  2.720297321e-01f,  2.685589025e-01f,
+     2.645227194e-01f,  2.611322645e-01f,  2.592203944e-01f,  2.587591873e-01f,  2.588784642e-01f,  2.583732878e-01f,  2.564044847e-01f,  2.529849551e-01f,
+     2.489699722e-01f,  2.455583905e-01f,  2.435956310e-01f,  2.430836588e-01f,  2.431819549e-01f,  2.426976891e-01f,  2.407792584e-01f,  2.374099824e-01f,
+     2.334157706e-01f,  2.299834850e-01f,  2.279708472e-01f,  2.274091103e-01f,  2.274868359e-01f,  2.270230764e-01f,  2.251540519e-01f,  2.218340737e-01f,
+     2.178602408e-01f,  2.144076375e-01f,  2.123460443e-01f,  2.117354554e-01f,  2.117929848e-01f,  2.113493631e-01f,  2.095288639e-01f,  2.062573124e-01f,
+     2.023035014e-01f,  1.988309319e-01f,  1.967212234e-01f,  1.960626132e-01f,  1.961002869e-01f,  1.956764678e-01f,  1.939036935e-01f,  1.906797773e-01f,
+     1.867456638e-01f,  1.832534472e-01f,  1.810963855e-01f,  1.803905071e-01f,  1.804086336e-01f,  1.800043138e-01f,  1.782785396e-01f,  1.751015427e-01f,
+     1.711868335e-01f,  1.676752581e-01f,  1.654715315e-01f,  1.647190648e-01f,  1.647179226e-01f,  1.643328283e-01f,  1.626534013e-01f,  1.595226791e-01f,
+     1.556271102e-01f,  1.520964354e-01f,  1.498466621e-01f,  1.490482175e-01f,  1.490280563e-01f,  1.486619425e-01f,  1.470282781e-01f,  1.439432537e-01f,
+     1.400665892e-01f,  1.365170463e-01f,  1.342217782e-01f,  1.333778996e-01f,  1.333389420e-01f,  1.329915905e-01f,  1.314031691e-01f,  1.283633306e-01f,
+     1.245053612e-01f,  1.209371551e-01f,  1.185968802e-01f,  1.177080483e-01f,  1.176504905e-01f,  1.173217093e-01f,  1.157780739e-01f,  1.127829713e-01f,
+     1.089435135e-01f,  1.053568238e-01f,  1.029719687e-01f,  1.020386032e-01f,  1.019626163e-01f,  1.016522383e-01f,  1.001529919e-01f,  9.720223533e-02f,
+     9.338113017e-02f,  8.977611170e-02f,  8.734704422e-02f,  8.636950593e-02f,  8.627523688e-02f,  8.598311907e-02f,  8.452792281e-02f,  8.162118003e-02f,
+     7.781829247e-02f,  7.419507643e-02f,  7.172210705e-02f,  7.070069984e-02f,  7.058827196e-02f,  7.031429486e-02f,  6.890286619e-02f,  6.603986129e-02f,
+     6.225507952e-02f,  5.861377393e-02f,  5.609715752e-02f,  5.503212978e-02f,  5.490164348e-02f,  5.464571040e-02f,  5.327782180e-02f,  5.045833367e-02f,
+     4.669156854e-02f,  4.303225887e-02f,  4.047219588e-02f,  3.936374171e-02f,  3.921527500e-02f,  3.897731160e-02f,  3.765278942e-02f,  3.487665070e-02f,
+     3.112783528e-02f,  2.745058482e-02f,  2.484722232e-02f,  2.369548252e-02f,  2.352909132e-02f,  2.330904528e-02f,  2.202776888e-02f,  1.929486517e-02f,
+     1.556395445e-02f,  1.186880464e-02f,  9.222236972e-03f,  8.027299696e-03f,  7.843018179e-03f,  7.640858899e-03f,  6.402760102e-03f,  3.713029380e-03f,
+     0.000000000e+00f,
+  },
+  { // level 3: 63 harmonics
+     0.000000000e+00f, -3.857208585e-03f, -7.429006941e-03f, -1.047275571e-02f, -1.282494927e-02f, -1.442572248e-02f, -1.532782901e-02f, -1.568874501e-02f,
+    -1.574707992e-02f, -1.578682691e-02f, -1.609480802e-02f, -1.691768891e-02f, -1.842500390e-02f, -2.068373227e-02f, -2.364823776e-02f, -2.716708166e-02f,
+    -3.100569298e-02f, -3.488150255e-02f, -3.850628010e-02f, -4.162933241e-02f, -4.407509001e-02f, -4.576944814e-02f, -4.675091124e-02f, -4.716486520e-02f,
+    -4.724182918e-02f, -4.726293963e-02f, -4.751783319e-02f, -4.826123668e-02f, -4.967476857e-02f, -5.183967894e-02f, -5.472461835e-02f, -5.819027647e-02f,
+    -6.201020429e-02f, -6.590470862e-02f, -6.958274663e-02f, -7.278554698e-02f, -7.532542105e-02f, -7.711394478e-02f, -7.817528067e-02f, -7.864263330e-02f,
+    -7.873835808e-02f, -7.874069263e-02f, -7.894208739e-02f, -7.960537411e-02f, -8.092434019e-02f, -8.299462119e-02f, -8.579928240e-02f, -8.921126285e-02f,
+    -9.301232932e-02f, -9.692571401e-02f, -1.006575558e-01f, -1.039409415e-01f, -1.065759489e-01f, -1.084596842e-01f, -1.096018044e-01f, -1.101231812e-01f,
+    -1.102378916e-01f, -1.102212175e-01f, -1.103684355e-01f, -1.109505659e-01f, -1.121737103e-01f, -1.141480761e-01f, -1.168713437e-01f, -1.202288844e-01f,
+    -1.240108165e-01f, -1.279433627e-01f, -1.317298242e-01f, -1.350950421e-01f, -1.378266840e-01f, -1.398071629e-01f, -1.410313922e-01f, -1.416076957e-01f,
+    -1.417417143e-01f, -1.417057006e-01f, -1.417977837e-01f, -1.422972976e-01f, -1.434228663e-01f, -1.452995311e-01f, -1.479398641e-01f, -1.512419174e-01f,
+    -1.550043416e-01f, -1.589564315e-01f, -1.627986179e-01f, -1.662473492e-01f, -1.690776413e-01f, -1.711569126e-01f, -1.724650161e-01f, -1.730974441e-01f,
+    -1.732511975e-01f, -1.731954087e-01f, -1.732310991e-01f, -1.736460857e-01f, -1.746717906e-01f, -1.764484320e-01f, -1.790038324e-01f, -1.822490440e-01f,
+    -1.859914784e-01f, -1.899636033e-01f, -1.938629315e-01f, -1.973973264e-01f, -2.003288410e-01f, -2.025095129e-01f, -2.039037321e-01f, -2.045938028e-01f,
+    -2.047678305e-01f, -2.046917170e-01f, -2.046694312e-01f, -2.049974892e-01f, -2.059204603e-01f, -2.075941706e-01f, -2.100621411e-01f, -2.132488209e-01f,
+    -2.169706652e-01f, -2.209634359e-01f, -2.249216648e-01f, -2.285443887e-01f, -2.315803092e-01f, -2.338656049e-01f, -2.353487063e-01f, -2.360982909e-01f,
+    -2.362932572e-01f, -2.361961438e-01f, -2.361139377e-01f, -2.363521231e-01f, -2.371688458e-01f, -2.387360681e-01f, -2.411135575e-01f, -2.442396430e-01f,
+    -2.479401652e-01f, -2.519543252e-01f, -2.559735948e-01f, -2.596878872e-01f, -2.628320794e-01f, -2.652259094e-01f, -2.668012465e-01f, -2.676126109e-01f,
+    -2.678293199e-01f, -2.677103903e-01f, -2.675659155e-01f, -2.677106743e-01f, -2.684169094e-01f, -2.698733565e-01f, -2.721566896e-01f, -2.752196978e-01f,
+    -2.788980173e-01f, -2.829344605e-01f, -2.870173415e-01f, -2.908270919e-01f, -2.940841941e-01f, -2.965912480e-01f, -2.982628400e-01f, -2.991386989e-01f,
+    -2.993781130e-01f, -2.992363904e-01f, -2.990268382e-01f, -2.990739217e-01f, -2.996646030e-01f, -3.010051541e-01f, -3.031899427e-01f, -3.061869103e-01f,
+    -3.098419766e-01f, -3.139017688e-01f, -3.180513259e-01f, -3.219611691e-01f, -3.253367072e-01f, -3.279625699e-01f, -3.297352020e-01f, -3.306787864e-01f,
+    -3.309420511e-01f, -3.307763735e-01f, -3.304984036e-01f, -3.304427604e-01f, -3.309118661e-01f, -3.321304355e-01f, -3.342114658e-01f, -3.371388727e-01f,
+    -3.407694380e-01f, -3.448538448e-01f, -3.490737164e-01f, -3.530891546e-01f, -3.565896871e-01f, -3.593409865e-01f, -3.612203367e-01f, -3.622354801e-01f,
+    -3.625239542e-01f, -3.623329435e-01f, -3.619825939e-01f, -3.618182327e-01f, -3.621586215e-01f, -3.632479923e-01f, -3.652190817e-01f, -3.680727539e-01f,
+    -3.716773384e-01f, -3.757878607e-01f, -3.800823607e-01f, -3.842099177e-01f, -3.878432210e-01f, -3.907278159e-01f, -3.927206168e-01f, -3.938118647e-01f,
+    -3.941271595e-01f, -3.939091813e-01f, -3.934817535e-01f, -3.932015689e-01f, -3.934047704e-01f, -3.943563822e-01f, -3.962101964e-01f, -3.989851818e-01f,
+    -4.025620301e-01f, -4.067004486e-01f, -4.110746970e-01f, -4.153221158e-01f, -4.190974211e-01f, -4.221246415e-01f, -4.242388876e-01f, -4.254116381e-01f,
+    -4.257556676e-01f, -4.255087802e-01f, -4.249986913e-01f, -4.245942391e-01f, -4.246501851e-01f, -4.254538607e-01f, -4.271816788e-01f, -4.298720878e-01f,
+    -4.334191116e-01f, -4.375875453e-01f, -4.420476355e-01f, -4.464241338e-01f, -4.503524330e-01f, -4.535333913e-01f, -4.557786063e-01f, -4.570392923e-01f,
+    -4.574143375e-01f, -4.571362257e-01f, -4.565368173e-01f, -4.559980235e-01f, -4.558946992e-01f, -4.565382902e-01f, -4.581296983e-01f, -4.607284960e-01f,
+    -4.642432002e-01f, -4.684441821e-01f, -4.729973998e-01f, -4.775140028e-01f, -4.816084476e-01f, -4.849564444e-01f, -4.873440319e-01f, -4.887003582e-01f,
+    -4.891091525e-01f, -4.887970409e-01f, -4.881003281e-01f, -4.874151070e-01f, -4.871380928e-01f, -4.876070127e-01f, -4.890495025e-01f, -4.915482356e-01f,
+    -4.950276208e-01f, -4.992641974e-01f, -5.039193096e-01f, -5.085892895e-01f, -5.128657192e-01f, -5.163967808e-01f, -5.189404873e-01f, -5.204017465e-01f,
+    -5.208475876e-01f, -5.204981252e-01f, -5.196944632e-01f, -5.188482096e-01f, -5.183800706e-01f, -5.186566743e-01f, -5.199351063e-01f, -5.223235378e-01f,
+    -5.257639702e-01f, -5.300398354e-01f, -5.348074766e-01f, -5.396469421e-01f, -5.441245919e-01f, -5.478581914e-01f, -5.505747299e-01f, -5.521522262e-01f,
+    -5.526391280e-01f, -5.522482331e-01f, -5.513258667e-01f, -5.503007692e-01f, -5.496202298e-01f, -5.496829716e-01f, -5.507788478e-01f, -5.530444619e-01f,
+    -5.564414960e-01f, -5.607611725e-01f, -5.656543718e-01f, -5.706830718e-01f, -5.753855397e-01f, -5.793455835e-01f, -5.822554862e-01f, -5.839631170e-01f,
+    -5.844960173e-01f, -5.840586635e-01f, -5.830031084e-01f, -5.817772037e-01f, -5.808580097e-01f, -5.806802814e-01f, -5.815707402e-01f, -5.836980567e-01f,
+    -5.870461902e-01f, -5.914152821e-01f, -5.964501948e-01f, -6.016926362e-01f, -6.066492299e-01f, -6.108654336e-01f, -6.139942433e-01f, -6.158493116e-01f,
+    -6.164343630e-01f, -6.159442802e-01f, -6.147374528e-01f, -6.132832961e-01f, -6.120926113e-01f, -6.116411038e-01f, -6.122974997e-01f, -6.142671044e-01f,
+    -6.175594312e-01f, -6.219849815e-01f, -6.271819290e-01f, -6.326689685e-01f, -6.379166255e-01f, -6.424264779e-01f, -6.458064514e-01f, -6.478308306e-01f,
+    -6.484758180e-01f, -6.479250612e-01f, -6.465440269e-01f, -6.448267747e-01f, -6.433228654e-01f, -6.425551983e-01f, -6.429410444e-01f, -6.447281815e-01f,
+    -6.479558860e-01f, -6.524468985e-01f, -6.578318866e-01f, -6.636030572e-01f, -6.691891569e-01f, -6.740408021e-01f, -6.777134144e-01f, -6.799352623e-01f,
+    -6.806502185e-01f, -6.800285316e-01f, -6.784436500e-01f, -6.764182142e-01f, -6.745470069e-01f, -6.734081962e-01f, -6.734760924e-01f, -6.750485590e-01f,
+    -6.782001599e-01f, -6.827683829e-01f, -6.883753865e-01f, -6.944824078e-01f, -7.004690228e-01f, -7.057256261e-01f, -7.097453718e-01f, -7.122017397e-01f,
+    -7.129998836e-01f, -7.122937258e-01f, -7.104658094e-01f, -7.080724874e-01f, -7.057622694e-01f, -7.041792791e-01f, -7.038661617e-01f, -7.051810443e-01f,
+    -7.082412192e-01f, -7.129023669e-01f, -7.187768995e-01f, -7.252891732e-01f, -7.317597428e-01f, -7.375063620e-01f, -7.419467543e-01f, -7.446877130e-01f,
+    -7.455869381e-01f, -7.447779341e-01f, -7.426537150e-01f, -7.398112000e-01f, -7.369641195e-01f, -7.348370962e-01f, -7.340565748e-01f, -7.350549697e-01f,
+    -7.380026484e-01f, -7.427783902e-01f, -7.489833318e-01f, -7.559969432e-01f, -7.630672367e-01f, -7.694221461e-01f, -7.743856327e-01f, -7.774811163e-01f,
+    -7.785064657e-01f, -7.775688176e-01f, -7.750733519e-01f, -7.716669811e-01f, -7.681447080e-01f, -7.653321440e-01f, -7.639614837e-01f, -7.645594970e-01f,
+    -7.673646007e-01f, -7.722859802e-01f, -7.789116279e-01f, -7.865649258e-01f, -7.944020917e-01f, -8.015365330e-01f, -8.071718617e-01f, -8.107236989e-01f,
+    -8.119117323e-01f, -8.108076271e-01f, -8.078307673e-01f, -8.036915048e-01f, -7.992894750e-01f, -7.955814403e-01f, -7.934379726e-01f, -7.935103377e-01f,
+    -7.961278196e-01f, -8.012415424e-01f, -8.084241747e-01f, -8.169266870e-01f, -8.257847799e-01f, -8.339599846e-01f, -8.404949173e-01f, -8.446596118e-01f,
+    -8.460667139e-01f, -8.447375232e-01f, -8.411078707e-01f, -8.359716177e-01f, -8.303688895e-01f, -8.254346176e-01f, -8.222292796e-01f, -8.215769021e-01f,
+    -8.239348768e-01f, -8.293159405e-01f, -8.372753143e-01f, -8.469665231e-01f, -8.572591902e-01f, -8.669026293e-01f, -8.747117782e-01f, -8.797480712e-01f,
+    -8.814679066e-01f, -8.798155180e-01f, -8.752447951e-01f, -8.686648439e-01f, -8.613153794e-01f, -8.545887324e-01f, -8.498237278e-01f, -8.481016166e-01f,
+    -8.500748026e-01f, -8.558550799e-01f, -8.649799660e-01f, -8.764645735e-01f, -8.889338763e-01f, -9.008180315e-01f, -9.105834379e-01f, -9.169659941e-01f,
+    -9.191716085e-01f, -9.170127625e-01f, -9.109584455e-01f, -9.020869544e-01f, -8.919451954e-01f, -8.823322116e-01f, -8.750365979e-01f, -8.715654216e-01f,
+    -8.729049233e-01f, -8.793500582e-01f, -8.904311112e-01f, -9.049522851e-01f, -9.211411108e-01f, -9.368910240e-01f, -9.500648975e-01f, -9.588169222e-01f,
+    -9.618856783e-01f, -9.588134258e-01f, -9.500555224e-01f, -9.369584367e-01f, -9.216031689e-01f, -9.065305372e-01f, -8.943829328e-01f, -8.875111144e-01f,
+    -8.876022009e-01f, -8.953848607e-01f, -9.104594470e-01f, -9.312853087e-01f, -9.553365697e-01f, -9.794140387e-01f, -1.000077779e+00f, -1.014145515e+00f,
+    -1.019189364e+00f, -1.013959417e+00f, -9.986684891e-01f, -9.750874786e-01f, -9.464237154e-01f, -9.169826089e-01f, -8.916423201e-01f, -8.751982096e-01f,
+    -8.716547249e-01f, -8.835541564e-01f, -9.114323649e-01f, -9.534806104e-01f, -1.005470944e+00f, -1.060972634e+00f, -1.111852329e+00f, -1.149015344e+00f,
+    -1.163314054e+00f, -1.146525990e+00f, -1.092291921e+00f, -9.969049171e-01f, -8.598552554e-01f, -6.840616715e-01f, -4.757539766e-01f, -2.440113481e-01f,
+    -2.116429214e-16f,  2.440113481e-01f,  4.757539766e-01f,  6.840616715e-01f,  8.598552554e-01f,  9.969049171e-01f,  1.092291921e+00f,  1.146525990e+00f,
+     1.163314054e+00f,  1.149015344e+00f,  1.111852329e+00f,  1.060972634e+00f,  1.005470944e+00f,  9.534806104e-01f,  9.114323649e-01f,  8.835541564e-01f,
+     8.716547249e-01f,  8.751982096e-01f,  8.916423201e-01f,  9.169826089e-01f,  9.464237154e-01f,  9.750874786e-01f,  9.986684891e-01f,  1.013959417e+00f,
+     1.019189364e+00f,  1.014145515e+00f,  1.000077779e+00f,  9.794140387e-01f,  9.553365697e-01f,  9.312853087e-01f,  9.104594470e-01f,  8.953848607e-01f,
+     8.876022009e-01f,  8.875111144e-01f,  8.943829328e-01f,  9.065305372e-01f,  9.216031689e-01f,  9.369584367e-01f,  9.500555224e-01f,  9.588134258e-01f,
+     9.618856783e-01f,  9.588169222e-01f,  9.500648975e-01f,  9.368910240e-01f,  9.211411108e-01f,  9.049522851e-01f,  8.904311112e-01f,  8.793500582e-01f,
+     8.729049233e-01f,  8.715654216e-01f,  8.750365979e-01f,  8.823322116e-01f,  8.919451954e-01f,  9.020869544e-01f,  9.109584455e-01f,  9.170127625e-01f,
+     9.191716085e-01f,  9.169659941e-01f,  9.105834379e-01f,  9.008180315e-01f,  8.889338763e-01f,  8.764645735e-01f,  8.649799660e-01f,  8.558550799e-01f,
+     8.500748026e-01f,  8.481016166e-01f,  8.498237278e-01f,  8.545887324e-01f,  8.613153794e-01f,  8.686648439e-01f,  8.752447951e-01f,  8.798155180e-01f,
+     8.814679066e-01f,  8.797480712e-01f,  8.747117782e-01f,  8.669026293e-01f,  8.572591902e-01f,  8.469665231e-01f,  8.372753143e-01f,  8.293159405e-01f,
+     8.239348768e-01f,  8.215769021e-01f,  8.222292796e-01f,  8.254346176e-01f,  8.303688895e-01f,  8.359716177e-01f,  8.411078707e-01f,  8.447375232e-01f,
+     8.460667139e-01f,  8.446596118e-01f,  8.404949173e-01f,  8.339599846e-01f,  8.257847799e-01f,  8.169266870e-01f,  8.084241747e-01f,  8.012415424e-01f,
+     7.961278196e-01f,  7.935103377e-01f,  7.934379726e-01f,  7.955814403e-01f,  7.992894750e-01f,  8.036915048e-01f,  8.078307673e-01f,  8.108076271e-01f,
+     8.119117323e-01f,  8.107236989e-01f,  8.071718617e-01f,  8.015365330e-01f,  7.944020917e-01f,  7.865649258e-01f,  7.789116279e-01f,  7.722859802e-01f,
+     7.673646007e-01f,  7.645594970e-01f,  7.639614837e-01f,  7.653321440e-01f,  7.681447080e-01f,  7.716669811e-01f,  7.750733519e-01f,  7.775688176e-01f,
+     7.785064657e-01f,  7.774811163e-01f,  7.743856327e-01f,  7.694221461e-01f,  7.630672367e-01f,  7.559969432e-01f,  7.489833318e-01f,  7.427783902e-01f,
+     7.380026484e-01f,  7.350549697e-01f,  7.340565748e-01f,  7.348370962e-01f,  7.369641195e-01f,  7.398112000e-01f,  7.426537150e-01f,  7.447779341e-01f,
+     7.455869381e-01f,  7.446877130e-01f,  7.419467543e-01f,  7.375063620e-01f,  7.317597428e-01f,  7.252891732e-01f,  7.187768995e-01f,  7.129023669e-01f,
+     7.082412192e-01f,  7.051810443e-01f,  7.038661617e-01f,  7.041792791e-01f,  7.057622694e-01f,  7.080724874e-01f,  7.104658094e-01f,  7.122937258e-01f,
+     7.129998836e-01f,  7.122017397e-01f,  7.097453718e-01f,  7.057256261e-01f,  7.004690228e-01f,  6.944824078e-01f,  6.883753865e-01f,  6.827683829e-01f,
+     6.782001599e-01f,  6.750485590e-01f,  6.734760924e-01f,  6.734081962e-01f,  6.745470069e-01f,  6.764182142e-01f,  6.784436500e-01f,  6.800285316e-01f,
+     6.806502185e-01f,  6.799352623e-01f,  6.777134144e-01f,  6.740408021e-01f,  6.691891569e-01f,  6.636030572e-01f,  6.578318866e-01f,  6.524468985e-01f,
+     6.479558860e-01f,  6.447281815e-01f,  6.429410444e-01f,  6.425551983e-01f,  6.433228654e-01f,  6.448267747e-01f,  6.465440269e-01f,  6.479250612e-01f,
+     6.484758180e-01f,  6.478308306e-01f,  6.458064514e-01f,  6.424264779e-01f,  6.379166255e-01f,  6.326689685e-01f,  6.271819290e-01f,  6.219849815e-01f,
+     6.175594312e-01f,  6.142671044e-01f,  6.122974997e-01f,  6.116411038e-01f,  6.120926113e-01f,  6.132832961e-01f,  6.147374528e-01f,  6.159442802e-01f,
+     6.164343630e-01f,  6.158493116e-01f,  6.139942433e-01f,  6.108654336e-01f,  6.066492299e-01f,  6.016926362e-01f,  5.964501948e-01f,  5.914152821e-01f,
+     5.870461902e-01f,  5.836980567e-01f,  5.815707402e-01f,  5.806802814e-01f,  5.808580097e-01f,  5.817772037e-01f,  5.830031084e-01f,  5.840586635e-01f,
+     5.844960173e-01f,  5.839631170e-01f,  5.822554862e-01f,  5.793455835e-01f,  5.753855397e-01f,  5.706830718e-01f,  5.656543718e-01f,  5.607611725e-01f,
+     5.564414960e-01f,  5.530444619e-01f,  5.507788478e-01f,  5.496829716e-01f,  5.496202298e-01f,  5.503007692e-01f,  5.513258667e-01f,  5.522482331e-01f,
+     5.526391280e-01f,  5.521522262e-01f,  5.505747299e-01f,  5.478581914e-01f,  5.441245919e-01f,  5.396469421e-01f,  5.348074766e-01f,  5.300398354e-01f,
+     5.257639702e-01f,  5.223235378e-01f,  5.199351063e-01f,  5.186566743e-01f,  5.183800706e-01f,  5.188482096e-01f,  5.196944632e-01f,  5.204981252e-01f,
+     5.208475876e-01f,  5.204017465e-01f,  5.189404873e-01f,  5.163967808e-01f,  5.128657192e-01f,  5.085892895e-01f,  5.039193096e-01f,  4.992641974e-01f,
+     4.950276208e-01f,  4.915482356e-01f,  4.890495025e-01f,  4.876070127e-01f,  4.871380928e-01f,  4.874151070e-01f,  4.881003281e-01f,  4.887970409e-01f,
+     4.891091525e-01f,  4.887003582e-01f,  4.873440319e-01f,  4.849564444e-01f,  4.816084476e-01f,  4.775140028e-01f,  4.729973998e-01f,  4.684441821e-01f,
+     4.642432002e-01f,  4.607284960e-01f,  4.581296983e-01f,  4.565382902e-01f,  4.558946992e-01f,  4.559980235e-01f,  4.565368173e-01f,  4.571362257e-01f,
+     4.574143375e-01f,  4.570392923e-01f,  4.557786063e-01f,  4.535333913e-01f,  4.503524330e-01f,  4.464241338e-01f,  4.420476355e-01f,  4.375875453e-01f,
+     4.334191116e-01f,  4.298720878e-01f,  4.271816788e-01f,  4.254538607e-01f,  4.246501851e-01f,  4.245942391e-01f,  4.249986913e-01f,  4.255087802e-01f,
+     4.257556676e-01f,  4.254116381e-01f,  4.242388876e-01f,  4.221246415e-01f,  4.190974211e-01f,  4.153221158e-01f,  4.110746970e-01f,  4.067004486e-01f,
+     4.025620301e-01f,  3.989851818e-01f,  3.962101964e-01f,  3.943563822e-01f,  3.934047704e-01f,  3.932015689e-01f,  3.934817535e-01f,  3.939091813e-01f,
+     3.941271595e-01f,  3.938118647e-01f,  3.927206168e-01f,  3.907278159e-01f,  3.878432210e-01f,  3.842099177e-01f,  3.800823607e-01f,  3.757878607e-01f,
+     3.716773384e-01f,  3.680727539e-01f,  3.652190817e-01f,  3.632479923e-01f,  3.621586215e-01f,  3.618182327e-01f,  3.619825939e-01f,  3.623329435e-01f,
+     3.625239542e-01f,  3.622354801e-01f,  3.612203367e-01f,  3.593409865e-01f,  3.565896871e-01f,  3.530891546e-01f,  3.490737164e-01f,  3.448538448e-01f,
+     3.407694380e-01f,  3.371388727e-01f,  3.342114658e-01f,  3.321304355e-01f,  3.309118661e-01f,  3.304427604e-01f,  3.304984036e-01f,  3.307763735e-01f,
+     3.309420511e-01f,  3.306787864e-01f,  3.297352020e-01f,  3.279625699e-01f,  3.253367072e-01f,  3.219611691e-01f,  3.180513259e-01f,  3.139017688e-01f,
+     3.098419766e-01f,  3.061869103e-01f,  3.031899427e-01f,  3.010051541e-01f,  2.996646030e-01f,  2.990739217e-01f,  2.990268382e-01f,  2.992363904e-01f,
+     2.993781130e-01f,  2.991386989e-01f,  2.982628400e-01f,  2.965912480e-01f,  2.940841941e-01f,  2.908270919e-01f,  2.870173415e-01f,  2.829344605e-01f,
+     2.788980173e-01f,  2.752196978e-01f,  2.721566896e-01f,  2.698733565e-01f,  2.684169094e-01f,  2.677106743e-01f,  2.675659155e-01f,  2.677103903e-01f,
+     2.678293199e-01f,  2.676126109e-01f,  2.668012465e-01f,  2.652259094e-01f,  2.628320794e-01f,  2.596878872e-01f,  2.559735948e-01f,  2.519543252e-01f,
+     2.479401652e-01f,  2.442396430e-01f,  2.411135575e-01f,  2.387360681e-01f,  2.371688458e-01f,  2.363521231e-01f,  2.361139377e-01f,  2.361961438e-01f,
+     2.362932572e-01f,  2.360982909e-01f,  2.353487063e-01f,  2.338656049e-01f,  2.315803092e-01f,  2.285443887e-01f,  2.249216648e-01f,  2.209634359e-01f,
+     2.169706652e-01f,  2.132488209e-01f,  2.100621411e-01f,  2.075941706e-01f,  2.059204603e-01f,  2.049974892e-01f,  2.046694312e-01f,  2.046917170e-01f,
+     2.047678305e-01f,  2.045938028e-01f,  2.039037321e-01f,  2.025095129e-01f,  2.003288410e-01f,  1.973973264e-01f,  1.938629315e-01f,  1.899636033e-01f,
+     1.859914784e-01f,  1.822490440e-01f,  1.790038324e-01f,  1.764484320e-01f,  1.746717906e-01f,  1.736460857e-01f,  1.732310991e-01f,  1.731954087e-01f,
+     1.732511975e-01f,  1.730974441e-01f,  1.724650161e-01f,  1.711569126e-01f,  1.690776413e-01f,  1.662473492e-01f,  1.627986179e-01f,  1.589564315e-01f,
+     1.550043416e-01f,  1.512419174e-01f,  1.479398641e-01f,  1.452995311e-01f,  1.434228663e-01f,  1.422972976e-01f,  1.417977837e-01f,  1.417057006e-01f,
+     1.417417143e-01f,  1.416076957e-01f,  1.410313922e-01f,  1.398071629e-01f,  1.378266840e-01f,  1.350950421e-01f,  1.317298242e-01f,  1.279433627e-01f,
+     1.240108165e-01f,  1.202288844e-01f,  1.168713437e-01f,  1.141480761e-01f,  1.121737103e-01f,  1.109505659e-01f,  1.103684355e-01f,  1.102212175e-01f,
+     1.102378916e-01f,  1.101231812e-01f,  1.096018044e-01f,  1.084596842e-01f,  1.065759489e-01f,  1.039409415e-01f,  1.006575558e-01f,  9.692571401e-02f,
+     9.301232932e-02f,  8.921126285e-02f,  8.579928240e-02f,  8.299462119e-02f,  8.092434019e-02f,  7.960537411e-02f,  7.894208739e-02f,  7.874069263e-02f,
+     7.873835808e-02f,  7.864263330e-02f,  7.817528067e-02f,  7.711394478e-02f,  7.532542105e-02f,  7.278554698e-02f,  6.958274663e-02f,  6.590470862e-02f,
+     6.201020429e-02f,  5.819027647e-02f,  5.472461835e-02f,  5.183967894e-02f,  4.967476857e-02f,  4.826123668e-02f,  4.751783319e-02f,  4.726293963e-02f,
+     4.724182918e-02f,  4.716486520e-02f,  4.675091124e-02f,  4.576944814e-02f,  4.407509001e-02f,  4.162933241e-02f,  3.850628010e-02f,  3.488150255e-02f,
+     3.100569298e-02f,  2.716708166e-02f,  2.364823776e-02f,  2.068373227e-02f,  1.842500390e-02f,  1.691768891e-02f,  1.609480802e-02f,  1.578682691e-02f,
+     1.574707992e-02f,  1.568874501e-02f,  1.532782901e-02f,  1.442572248e-02f,  1.282494927e-02f,  1.047275571e-02f,  7.429006941e-03f,  3.857208585e-03f,
+     0.000000000e+00f,
+  },
+  { // level 4: 31 harmonics
+     0.000000000e+00f, -3.894114992e-03f, -7.715961862e-03f, -1.139596052e-02f, -1.486980707e-02f, -1.808086589e-02f, -2.098227681e-02f, -2.353869893e-02f,
+    -2.572762643e-02f, -2.754022730e-02f, -2.898167378e-02f, -3.007095221e-02f, -3.084015923e-02f, -3.133331044e-02f, -3.160470563e-02f, -3.171691125e-02f,
+    -3.173843509e-02f, -3.174117938e-02f, -3.179776700e-02f, -3.197884004e-02f, -3.235043123e-02f, -3.297150578e-02f, -3.389176518e-02f, -3.514979462e-02f,
+    -3.677162301e-02f, -3.876974931e-02f, -4.114267156e-02f, -4.387493624e-02f, -4.693770654e-02f, -5.028982848e-02f, -5.387935568e-02f, -5.764547616e-02f,
+    -6.152076996e-02f, -6.543371372e-02f, -6.931133934e-02f, -7.308194794e-02f, -7.667777831e-02f, -8.003753072e-02f, -8.310865197e-02f, -8.584929685e-02f,
+    -8.822989267e-02f, -9.023424856e-02f, -9.186016789e-02f, -9.311954075e-02f, -9.403791255e-02f, -9.465354453e-02f, -9.501600052e-02f, -9.518431215e-02f,
+    -9.522479051e-02f, -9.520856498e-02f, -9.520894084e-02f, -9.529867344e-02f, -9.554726037e-02f, -9.601835213e-02f, -9.676737790e-02f, -9.783947461e-02f,
+    -9.926779683e-02f, -1.010722706e-01f, -1.032588379e-01f, -1.058192204e-01f, -1.087312124e-01f, -1.119594910e-01f, -1.154569165e-01f, -1.191662727e-01f,
+    -1.230223844e-01f, -1.269545336e-01f, -1.308890847e-01f, -1.347522213e-01f, -1.384726931e-01f, -1.419844709e-01f, -1.452292110e-01f, -1.481584365e-01f,
+    -1.507353546e-01f, -1.529362417e-01f, -1.547513444e-01f, -1.561852620e-01f, -1.572567949e-01f, -1.579982661e-01f, -1.584543368e-01f, -1.586803628e-01f,
+    -1.587403497e-01f, -1.587045838e-01f, -1.586470254e-01f, -1.586425617e-01f, -1.587642208e-01f, -1.590804502e-01f, -1.596525622e-01f, -1.605324394e-01f,
+    -1.617605886e-01f, -1.633646134e-01f, -1.653581656e-01f, -1.677404125e-01f, -1.704960431e-01f, -1.735958131e-01f, -1.769976080e-01f, -1.806479888e-01f,
+    -1.844841601e-01f, -1.884362907e-01f, -1.924301003e-01f, -1.963896162e-01f, -2.002399984e-01f, -2.039103278e-01f, -2.073362540e-01f, -2.104624036e-01f,
+    -2.132444595e-01f, -2.156508329e-01f, -2.176638647e-01f, -2.192805117e-01f, -2.205124898e-01f, -2.213858684e-01f, -2.219401303e-01f, -2.222267299e-01f,
+    -2.223072035e-01f, -2.222508999e-01f, -2.221324155e-01f, -2.220288288e-01f, -2.220168359e-01f, -2.221698943e-01f, -2.225554803e-01f, -2.232325633e-01f,
+    -2.242493902e-01f, -2.256416644e-01f, -2.274311862e-01f, -2.296250085e-01f, -2.322151390e-01f, -2.351788005e-01f, -2.384792437e-01f, -2.420670808e-01f,
+    -2.458820928e-01f, -2.498554448e-01f, -2.539122276e-01f, -2.579742308e-01f, -2.619628473e-01f, -2.658019990e-01f, -2.694209761e-01f, -2.727570851e-01f,
+    -2.757580039e-01f, -2.783837586e-01f, -2.806082452e-01f, -2.824202398e-01f, -2.838238575e-01f, -2.848384419e-01f, -2.854978871e-01f, -2.858494168e-01f,
+    -2.859518638e-01f, -2.858735121e-01f, -2.856895812e-01f, -2.854794455e-01f, -2.853236901e-01f, -2.853011137e-01f, -2.854857882e-01f, -2.859442860e-01f,
+    -2.867331783e-01f, -2.878968972e-01f, -2.894660437e-01f, -2.914562052e-01f, -2.938673280e-01f, -2.966836699e-01f, -2.998743367e-01f, -3.033943844e-01f,
+    -3.071864480e-01f, -3.111828376e-01f, -3.153080257e-01f, -3.194814346e-01f, -3.236204208e-01f, -3.276433460e-01f, -3.314726217e-01f, -3.350376124e-01f,
+    -3.382772908e-01f, -3.411425434e-01f, -3.435980417e-01f, -3.456236061e-01f, -3.472150108e-01f, -3.483841975e-01f, -3.491588888e-01f, -3.495816117e-01f,
+    -3.497081674e-01f, -3.496056010e-01f, -3.493497453e-01f, -3.490224284e-01f, -3.487084480e-01f, -3.484924238e-01f, -3.484556442e-01f, -3.486730262e-01f,
+    -3.492102997e-01f, -3.501215236e-01f, -3.514470270e-01f, -3.532118533e-01f, -3.554247665e-01f, -3.580778613e-01f, -3.611467902e-01f, -3.645916053e-01f,
+    -3.683581833e-01f, -3.723801841e-01f, -3.765814726e-01f, -3.808789142e-01f, -3.851854438e-01f, -3.894132922e-01f, -3.934772537e-01f, -3.972978709e-01f,
+    -4.008044198e-01f, -4.039375821e-01f, -4.066517043e-01f, -4.089165580e-01f, -4.107185337e-01f, -4.120612205e-01f, -4.129653493e-01f, -4.134680960e-01f,
+    -4.136217705e-01f, -4.134919362e-01f, -4.131550269e-01f, -4.126955488e-01f, -4.122029694e-01f, -4.117684060e-01f, -4.114812394e-01f, -4.114257744e-01f,
+    -4.116780753e-01f, -4.123030920e-01f, -4.133521872e-01f, -4.148611566e-01f, -4.168488202e-01f, -4.193162381e-01f, -4.222465838e-01f, -4.256056833e-01f,
+    -4.293432019e-01f, -4.333944395e-01f, -4.376826691e-01f, -4.421219353e-01f, -4.466202099e-01f, -4.510827907e-01f, -4.554158167e-01f, -4.595297697e-01f,
+    -4.633428334e-01f, -4.667839829e-01f, -4.697956877e-01f, -4.723361284e-01f, -4.743808388e-01f, -4.759237110e-01f, -4.769773227e-01f, -4.775725704e-01f,
+    -4.777576182e-01f, -4.775961986e-01f, -4.771653232e-01f, -4.765524875e-01f, -4.758524685e-01f, -4.751638340e-01f, -4.745852906e-01f, -4.742120056e-01f,
+    -4.741320401e-01f, -4.744230253e-01f, -4.751492090e-01f, -4.763589817e-01f, -4.780829800e-01f, -4.803328389e-01f, -4.831006445e-01f, -4.863591117e-01f,
+    -4.900624832e-01f, -4.941481230e-01f, -4.985387473e-01f, -5.031452144e-01f, -5.078697742e-01f, -5.126096575e-01f, -5.172608750e-01f, -5.217220857e-01f,
+    -5.258983909e-01f, -5.297049129e-01f, -5.330700230e-01f, -5.359380974e-01f, -5.382716950e-01f, -5.400530717e-01f, -5.412849725e-01f, -5.419906648e-01f,
+    -5.422132085e-01f, -5.420139836e-01f, -5.414705268e-01f, -5.406737503e-01f, -5.397246456e-01f, -5.387305875e-01f, -5.378013762e-01f, -5.370451614e-01f,
+    -5.365643987e-01f, -5.364519907e-01f, -5.367877553e-01f, -5.376353574e-01f, -5.390398189e-01f, -5.410257053e-01f, -5.435960611e-01f, -5.467321386e-01f,
+    -5.503939355e-01f, -5.545215287e-01f, -5.590371593e-01f, -5.638479969e-01f, -5.688494868e-01f, -5.739291579e-01f, -5.789707552e-01f, -5.838585446e-01f,
+    -5.884816313e-01f, -5.927381320e-01f, -5.965390438e-01f, -5.998116640e-01f, -6.025024306e-01f, -6.045790719e-01f, -6.060319818e-01f, -6.068747615e-01f,
+    -6.071439018e-01f, -6.068976110e-01f, -6.062138243e-01f, -6.051874624e-01f, -6.039270352e-01f, -6.025507108e-01f, -6.011819919e-01f, -5.999451571e-01f,
+    -5.989606340e-01f, -5.983404765e-01f, -5.981841139e-01f, -5.985745334e-01f, -5.995750411e-01f, -6.012267270e-01f, -6.035467344e-01f, -6.065274053e-01f,
+    -6.101363412e-01f, -6.143173854e-01f, -6.189924984e-01f, -6.240644655e-01f, -6.294203423e-01f, -6.349355189e-01f, -6.404782550e-01f, -6.459145243e-01f,
+    -6.511129893e-01f, -6.559499236e-01f, -6.603138989e-01f, -6.641100587e-01f, -6.672638182e-01f, -6.697238446e-01f, -6.714642031e-01f, -6.724855781e-01f,
+    -6.728155164e-01f, -6.725076732e-01f, -6.716400791e-01f, -6.703124822e-01f, -6.686428546e-01f, -6.667631850e-01f, -6.648147051e-01f, -6.629427228e-01f,
+    -6.612912482e-01f, -6.599976110e-01f, -6.591872684e-01f, -6.589689985e-01f, -6.594306618e-01f, -6.606356943e-01f, -6.626204706e-01f, -6.653926438e-01f,
+    -6.689305352e-01f, -6.731836086e-01f, -6.780740230e-01f, -6.834992182e-01f, -6.893354502e-01f, -6.954421556e-01f, -7.016669921e-01f, -7.078513771e-01f,
+    -7.138363240e-01f, -7.194683635e-01f, -7.246053317e-01f, -7.291218073e-01f, -7.329139945e-01f, -7.359038610e-01f, -7.380423706e-01f, -7.393116780e-01f,
+    -7.397261923e-01f, -7.393324550e-01f, -7.382078223e-01f, -7.364579850e-01f, -7.342134029e-01f, -7.316247723e-01f, -7.288576811e-01f, -7.260866388e-01f,
+    -7.234886954e-01f, -7.212368785e-01f, -7.194936902e-01f, -7.184049052e-01f, -7.180939036e-01f, -7.186567561e-01f, -7.201582539e-01f, -7.226290432e-01f,
+    -7.260639861e-01f, -7.304218273e-01f, -7.356261955e-01f, -7.415679238e-01f, -7.481086223e-01f, -7.550853881e-01f, -7.623164974e-01f, -7.696078823e-01f,
+    -7.767601660e-01f, -7.835760039e-01f, -7.898674656e-01f, -7.954631835e-01f, -8.002150024e-01f, -8.040038756e-01f, -8.067447766e-01f, -8.083904323e-01f,
+    -8.089337169e-01f, -8.084085989e-01f, -8.068895813e-01f, -8.044896299e-01f, -8.013566411e-01f, -7.976685552e-01f, -7.936272702e-01f, -7.894515608e-01f,
+    -7.853692465e-01f, -7.816088822e-01f, -7.783912701e-01f, -7.759211021e-01f, -7.743790421e-01f, -7.739145473e-01f, -7.746397076e-01f, -7.766243472e-01f,
+    -7.798925940e-01f, -7.844210689e-01f, -7.901387954e-01f, -7.969288643e-01f, -8.046318288e-01f, -8.130507388e-01f, -8.219576639e-01f, -8.311014957e-01f,
+    -8.402167706e-01f, -8.490332108e-01f, -8.572856499e-01f, -8.647239875e-01f, -8.711228102e-01f, -8.762903202e-01f, -8.800762295e-01f, -8.823783084e-01f,
+    -8.831473202e-01f, -8.823901243e-01f, -8.801707925e-01f, -8.766096523e-01f, -8.718802417e-01f, -8.662042377e-01f, -8.598444919e-01f, -8.530963819e-01f,
+    -8.462777479e-01f, -8.397177456e-01f, -8.337449902e-01f, -8.286754021e-01f, -8.248001862e-01f, -8.223743807e-01f, -8.216064057e-01f, -8.226490121e-01f,
+    -8.255919966e-01f, -8.304569929e-01f, -8.371945842e-01f, -8.456839064e-01f, -8.557348286e-01f, -8.670927087e-01f, -8.794456297e-01f, -8.924339364e-01f,
+    -9.056618012e-01f, -9.187104744e-01f, -9.311528020e-01f, -9.425685391e-01f, -9.525599456e-01f, -9.607671276e-01f, -9.668825756e-01f, -9.706643682e-01f,
+    -9.719475346e-01f, -9.706531188e-01f, -9.667945516e-01f, -9.604810152e-01f, -9.519175779e-01f, -9.414019762e-01f, -9.293180305e-01f, -9.161257913e-01f,
+    -9.023486254e-01f, -8.885575568e-01f, -8.753532765e-01f, -8.633463276e-01f, -8.531360400e-01f, -8.452888544e-01f, -8.403167070e-01f, -8.386561694e-01f,
+    -8.406490319e-01f, -8.465249934e-01f, -8.563870747e-01f, -8.702003025e-01f, -8.877841271e-01f, -9.088089319e-01f, -9.327968782e-01f, -9.591272008e-01f,
+    -9.870459398e-01f, -1.015679955e+00f, -1.044054945e+00f, -1.071117048e+00f, -1.095757521e+00f, -1.116839838e+00f, -1.133228517e+00f, -1.143818888e+00f,
+    -1.147566974e+00f, -1.143518650e+00f, -1.130837245e+00f, -1.108828779e+00f, -1.076964092e+00f, -1.034897180e+00f, -9.824791946e-01f, -9.197676159e-01f,
+    -8.470303061e-01f, -7.647442439e-01f, -6.735889157e-01f, -5.744344798e-01f, -4.683249697e-01f, -3.564569467e-01f, -2.401541395e-01f, -1.208387248e-01f,
+    -1.846276077e-16f,  1.208387248e-01f,  2.401541395e-01f,  3.564569467e-01f,  4.683249697e-01f,  5.744344798e-01f,  6.735889157e-01f,  7.647442439e-01f,
+     8.470303061e-01f,  9.197676159e-01f,  9.824791946e-01f,  1.034897180e+00f,  1.076964092e+00f,  1.108828779e+00f,  1.130837245e+00f,  1.143518650e+00f,
+     1.147566974e+00f,  1.143818888e+00f,  1.133228517e+00f,  1.116839838e+00f,  1.095757521e+00f,  1.071117048e+00f,  1.044054945e+00f,  1.015679955e+00f,
+     9.870459398e-01f,  9.591272008e-01f,  9.327968782e-01f,  9.088089319e-01f,  8.877841271e-01f,  8.702003025e-01f,  8.563870747e-01f,  8.465249934e-01f,
+     8.406490319e-01f,  8.386561694e-01f,  8.403167070e-01f,  8.452888544e-01f,  8.531360400e-01f,  8.633463276e-01f,  8.753532765e-01f,  8.885575568e-01f,
+     9.023486254e-01f,  9.161257913e-01f,  9.293180305e-01f,  9.414019762e-01f,  9.519175779e-01f,  9.604810152e-01f,  9.667945516e-01f,  9.706531188e-01f,
+     9.719475346e-01f,  9.706643682e-01f,  9.668825756e-01f,  9.607671276e-01f,  9.525599456e-01f,  9.425685391e-01f,  9.311528020e-01f,  9.187104744e-01f,
+     9.056618012e-01f,  8.924339364e-01f,  8.794456297e-01f,  8.670927087e-01f,  8.557348286e-01f,  8.456839064e-01f,  8.371945842e-01f,  8.304569929e-01f,
+     8.255919966e-01f,  8.226490121e-01f,  8.216064057e-01f,  8.223743807e-01f,  8.248001862e-01f,  8.286754021e-01f,  8.337449902e-01f,  8.397177456e-01f,
+     8.462777479e-01f,  8.530963819e-01f,  8.598444919e-01f,  8.662042377e-01f,  8.718802417e-01f,  8.766096523e-01f,  8.801707925e-01f,  8.823901243e-01f,
+     8.831473202e-01f,  8.823783084e-01f,  8.800762295e-01f,  8.762903202e-01f,  8.711228102e-01f,  8.647239875e-01f,  8.572856499e-01f,  8.490332108e-01f,
+     8.402167706e-01f,  8.311014957e-01f,  8.219576639e-01f,  8.130507388e-01f,  8.046318288e-01f,  7.969288643e-01f,  7.901387954e-01f,  7.844210689e-01f,
+     7.798925940e-01f,  7.766243472e-01f,  7.746397076e-01f,  7.739145473e-01f,  7.743790421e-01f,  7.759211021e-01f,  7.783912701e-01f,  7.816088822e-01f,
+     7.853692465e-01f,  7.894515608e-01f,  7.936272702e-01f,  7.976685552e-01f,  8.013566411e-01f,  8.044896299e-01f,  8.068895813e-01f,  8.084085989e-01f,
+     8.089337169e-01f,  8.083904323e-01f,  8.067447766e-01f,  8.040038756e-01f,  8.002150024e-01f,  7.954631835e-01f,  7.898674656e-01f,  7.835760039e-01f,
+     7.767601660e-01f,  7.696078823e-01f,  7.623164974e-01f,  7.550853881e-01f,  7.481086223e-01f,  7.415679238e-01f,  7.356261955e-01f,  7.304218273e-01f,
+     7.260639861e-01f,  7.226290432e-01f,  7.201582539e-01f,  7.186567561e-01f,  7.180939036e-01f,  7.184049052e-01f,  7.194936902e-01f,  7.212368785e-01f,
+     7.234886954e-01f,  7.260866388e-01f,  7.288576811e-01f,  7.316247723e-01f,  7.342134029e-01f,  7.364579850e-01f,  7.382078223e-01f,  7.393324550e-01f,
+     7.397261923e-01f,  7.393116780e-01f,  7.380423706e-01f,  7.359038610e-01f,  7.329139945e-01f,  7.291218073e-01f,  7.246053317e-01f,  7.194683635e-01f,
+     7.138363240e-01f,  7.078513771e-01f,  7.016669921e-01f,  6.954421556e-01f,  6.893354502e-01f,  6.834992182e-01f,  6.780740230e-01f,  6.731836086e-01f,
+     6.689305352e-01f,  6.653926438e-01f,  6.626204706e-01f,  6.606356943e-01f,  6.594306618e-01f,  6.589689985e-01f,  6.591872684e-01f,  6.599976110e-01f,
+     6.612912482e-01f,  6.629427228e-01f,  6.648147051e-01f,  6.667631850e-01f,  6.686428546e-01f,  6.703124822e-01f,  6.716400791e-01f,  6.725076732e-01f,
+     6.728155164e-01f,  6.724855781e-01f,  6.714642031e-01f,  6.697238446e-01f,  6.672638182e-01f,  6.641100587e-01f,  6.603138989e-01f,  6.559499236e-01f,
+     6.511129893e-01f,  6.459145243e-01f,  6.404782550e-01f,  6.349355189e-01f,  6.294203423e-01f,  6.240644655e-01f,  6.189924984e-01f,  6.143173854e-01f,
+     6.101363412e-01f,  6.065274053e-01f,  6.035467344e-01f,  6.012267270e-01f,  5.995750411e-01f,  5.985745334e-01f,  5.981841139e-01f,  5.983404765e-01f,
+     5.989606340e-01f,  5.999451571e-01f,  6.011819919e-01f,  6.025507108e-01f,  6.039270352e-01f,  6.051874624e-01f,  6.062138243e-01f,  6.068976110e-01f,
+     6.071439018e-01f,  6.068747615e-01f,  6.060319818e-01f,  6.045790719e-01f,  6.025024306e-01f,  5.998116640e-01f,  5.965390438e-01f,  5.927381320e-01f,
+     5.884816313e-01f,  5.838585446e-01f,  5.789707552e-01f,  5.739291579e-01f,  5.688494868e-01f,  5.638479969e-01f,  5.590371593e-01f,  5.545215287e-01f,
+     5.503939355e-01f,  5.467321386e-01f,  5.435960611e-01f,  5.410257053e-01f,  5.390398189e-01f,  5.376353574e-01f,  5.367877553e-01f,  5.364519907e-01f,
+     5.365643987e-01f,  5.370451614e-01f,  5.378013762e-01f,  5.387305875e-01f,  5.397246456e-01f,  5.406737503e-01f,  5.414705268e-01f,  5.420139836e-01f,
+     5.422132085e-01f,  5.419906648e-01f,  5.412849725e-01f,  5.400530717e-01f,  5.382716950e-01f,  5.359380974e-01f,  5.330700230e-01f,  5.297049129e-01f,
+     5.258983909e-01f,  5.217220857e-01f,  5.172608750e-01f,  5.126096575e-01f,  5.078697742e-01f,  5.031452144e-01f,  4.985387473e-01f,  4.941481230e-01f,
+     4.900624832e-01f,  4.863591117e-01f,  4.831006445e-01f,  4.803328389e-01f,  4.780829800e-01f,  4.763589817e-01f,  4.751492090e-01f,  4.744230253e-01f,
+     4.741320401e-01f,  4.742120056e-01f,  4.745852906e-01f,  4.751638340e-01f,  4.758524685e-01f,  4.765524875e-01f,  4.771653232e-01f,  4.775961986e-01f,
+     4.777576182e-01f,  4.775725704e-01f,  4.769773227e-01f,  4.759237110e-01f,  4.743808388e-01f,  4.723361284e-01f,  4.697956877e-01f,  4.667839829e-01f,
+     4.633428334e-01f,  4.595297697e-01f,  4.554158167e-01f,  4.510827907e-01f,  4.466202099e-01f,  4.421219353e-01f,  4.376826691e-01f,  4.333944395e-01f,
+     4.293432019e-01f,  4.256056833e-01f,  4.222465838e-01f,  4.193162381e-01f,  4.168488202e-01f,  4.148611566e-01f,  4.133521872e-01f,  4.123030920e-01f,
+     4.116780753e-01f,  4.114257744e-01f,  4.114812394e-01f,  4.117684060e-01f,  4.122029694e-01f,  4.126955488e-01f,  4.131550269e-01f,  4.134919362e-01f,
+     4.136217705e-01f,  4.134680960e-01f,  4.129653493e-01f,  4.120612205e-01f,  4.107185337e-01f,  4.089165580e-01f,  4.066517043e-01f,  4.039375821e-01f,
+     4.008044198e-01f,  3.972978709e-01f,  3.934772537e-01f,  3.894132922e-01f,  3.851854438e-01f,  3.808789142e-01f,  3.765814726e-01f,  3.723801841e-01f,
+     3.683581833e-01f,  3.645916053e-01f,  3.611467902e-01f,  3.580778613e-01f,  3.554247665e-01f,  3.532118533e-01f,  3.514470270e-01f,  3.501215236e-01f,
+     3.492102997e-01f,  3.486730262e-01f,  3.484556442e-01f,  3.484924238e-01f,  3.487084480e-01f,  3.490224284e-01f,  3.493497453e-01f,  3.496056010e-01f,
+     3.497081674e-01f,  3.495816117e-01f,  3.491588888e-01f,  3.483841975e-01f,  3.472150108e-01f,  3.456236061e-01f,  3.435980417e-01f,  3.411425434e-01f,
+     3.382772908e-01f,  3.350376124e-01f,  3.314726217e-01f,  3.276433460e-01f,  3.236204208e-01f,  3.194814346e-01f,  3.153080257e-01f,  3.111828376e-01f,
+     3.071864480e-01f,  3.033943844e-01f,  2.998743367e-01f,  2.966836699e-01f,  2.938673280e-01f,  2.914562052e-01f,  2.894660437e-01f,  2.878968972e-01f,
+     2.867331783e-01f,  2.859442860e-01f,  2.854857882e-01f,  2.853011137e-01f,  2.853236901e-01f,  2.854794455e-01f,  2.856895812e-01f,  2.858735121e-01f,
+     2.859518638e-01f,  2.858494168e-01f,  2.854978871e-01f,  2.848384419e-01f,  2.838238575e-01f,  2.824202398e-01f,  2.806082452e-01f,  2.783837586e-01f,
+     2.757580039e-01f,  2.727570851e-01f,  2.694209761e-01f,  2.658019990e-01f,  2.619628473e-01f,  2.579742308e-01f,  2.539122276e-01f,  2.498554448e-01f,
+     2.458820928e-01f,  2.420670808e-01f,  2.384792437e-01f,  2.351788005e-01f,  2.322151390e-01f,  2.296250085e-01f,  2.274311862e-01f,  2.256416644e-01f,
+     2.242493902e-01f,  2.232325633e-01f,  2.225554803e-01f,  2.221698943e-01f,  2.220168359e-01f,  2.220288288e-01f,  2.221324155e-01f,  2.222508999e-01f,
+     2.223072035e-01f,  2.222267299e-01f,  2.219401303e-01f,  2.213858684e-01f,  2.205124898e-01f,  2.192805117e-01f,  2.176638647e-01f,  2.156508329e-01f,
+     2.132444595e-01f,  2.104624036e-01f,  2.073362540e-01f,  2.039103278e-01f,  2.002399984e-01f,  1.963896162e-01f,  1.924301003e-01f,  1.884362907e-01f,
+     1.844841601e-01f,  1.806479888e-01f,  1.769976080e-01f,  1.735958131e-01f,  1.704960431e-01f,  1.677404125e-01f,  1.653581656e-01f,  1.633646134e-01f,
+     1.617605886e-01f,  1.605324394e-01f,  1.596525622e-01f,  1.590804502e-01f,  1.587642208e-01f,  1.586425617e-01f,  1.586470254e-01f,  1.587045838e-01f,
+     1.587403497e-01f,  1.586803628e-01f,  1.584543368e-01f,  1.579982661e-01f,  1.572567949e-01f,  1.561852620e-01f,  1.547513444e-01f,  1.529362417e-01f,
+     1.507353546e-01f,  1.481584365e-01f,  1.452292110e-01f,  1.419844709e-01f,  1.384726931e-01f,  1.347522213e-01f,  1.308890847e-01f,  1.269545336e-01f,
+     1.230223844e-01f,  1.191662727e-01f,  1.154569165e-01f,  1.119594910e-01f,  1.087312124e-01f,  1.058192204e-01f,  1.032588379e-01f,  1.010722706e-01f,
+     9.926779683e-02f,  9.783947461e-02f,  9.676737790e-02f,  9.601835213e-02f,  9.554726037e-02f,  9.529867344e-02f,  9.520894084e-02f,  9.520856498e-02f,
+     9.522479051e-02f,  9.518431215e-02f,  9.501600052e-02f,  9.465354453e-02f,  9.403791255e-02f,  9.311954075e-02f,  9.186016789e-02f,  9.023424856e-02f,
+     8.822989267e-02f,  8.584929685e-02f,  8.310865197e-02f,  8.003753072e-02f,  7.667777831e-02f,  7.308194794e-02f,  6.931133934e-02f,  6.543371372e-02f,
+     6.152076996e-02f,  5.764547616e-02f,  5.387935568e-02f,  5.028982848e-02f,  4.693770654e-02f,  4.387493624e-02f,  4.114267156e-02f,  3.876974931e-02f,
+     3.677162301e-02f,  3.514979462e-02f,  3.389176518e-02f,  3.297150578e-02f,  3.235043123e-02f,  3.197884004e-02f,  3.179776700e-02f,  3.174117938e-02f,
+     3.173843509e-02f,  3.171691125e-02f,  3.160470563e-02f,  3.133331044e-02f,  3.084015923e-02f,  3.007095221e-02f,  2.898167378e-02f,  2.754022730e-02f,
+     2.572762643e-02f,  2.353869893e-02f,  2.098227681e-02f,  1.808086589e-02f,  1.486980707e-02f,  1.139596052e-02f,  7.715961862e-03f,  3.894114992e-03f,
+     0.000000000e+00f,
+  },
+  { // level 5: 15 harmonics
+     0.000000000e+00f, -3.903309952e-03f, -7.789011341e-03f, -1.163965393e-02f, -1.543810274e-02f, -1.916769209e-02f, -2.281237555e-02f, -2.635687021e-02f,
+    -2.978679426e-02f, -3.308879636e-02f, -3.625067586e-02f, -3.926149272e-02f, -4.211166607e-02f, -4.479306067e-02f, -4.729906038e-02f, -4.962462796e-02f,
+    -5.176635084e-02f, -5.372247220e-02f, -5.549290728e-02f, -5.707924463e-02f, -5.848473241e-02f, -5.971424975e-02f, -6.077426344e-02f, -6.167277043e-02f,
+    -6.241922648e-02f, -6.302446179e-02f, -6.350058419e-02f, -6.386087080e-02f, -6.411964926e-02f, -6.429216932e-02f, -6.439446621e-02f, -6.444321686e-02f,
+    -6.445559021e-02f, -6.444909315e-02f, -6.444141321e-02f, -6.445025961e-02f, -6.449320401e-02f, -6.458752235e-02f, -6.475003929e-02f, -6.499697660e-02f,
+    -6.534380676e-02f, -6.580511332e-02f, -6.639445904e-02f, -6.712426311e-02f, -6.800568856e-02f, -6.904854085e-02f, -7.026117856e-02f, -7.165043697e-02f,
+    -7.322156529e-02f, -7.497817802e-02f, -7.692222101e-02f, -7.905395238e-02f, -8.137193866e-02f, -8.387306604e-02f, -8.655256673e-02f, -8.940406022e-02f,
+    -9.241960904e-02f, -9.558978852e-02f, -9.890377003e-02f, -1.023494169e-01f, -1.059133920e-01f, -1.095812767e-01f, -1.133376991e-01f, -1.171664712e-01f,
+    -1.210507336e-01f, -1.249731066e-01f, -1.289158455e-01f, -1.328610000e-01f, -1.367905755e-01f, -1.406866947e-01f, -1.445317589e-01f, -1.483086061e-01f,
+    -1.520006666e-01f, -1.555921126e-01f, -1.590680013e-01f, -1.624144112e-01f, -1.656185680e-01f, -1.686689620e-01f, -1.715554526e-01f, -1.742693622e-01f,
+    -1.768035560e-01f, -1.791525091e-01f, -1.813123577e-01f, -1.832809373e-01f, -1.850578044e-01f, -1.866442436e-01f, -1.880432580e-01f, -1.892595460e-01f,
+    -1.902994612e-01f, -1.911709580e-01f, -1.918835231e-01f, -1.924480922e-01f, -1.928769550e-01f, -1.931836459e-01f, -1.933828253e-01f, -1.934901495e-01f,
+    -1.935221313e-01f, -1.934959935e-01f, -1.934295150e-01f, -1.933408720e-01f, -1.932484750e-01f, -1.931708039e-01f, -1.931262419e-01f, -1.931329095e-01f,
+    -1.932085015e-01f, -1.933701267e-01f, -1.936341528e-01f, -1.940160574e-01f, -1.945302876e-01f, -1.951901271e-01f, -1.960075749e-01f, -1.969932342e-01f,
+    -1.981562142e-01f, -1.995040448e-01f, -2.010426057e-01f, -2.027760693e-01f, -2.047068602e-01f, -2.068356287e-01f, -2.091612412e-01f, -2.116807864e-01f,
+    -2.143895973e-01f, -2.172812891e-01f, -2.203478127e-01f, -2.235795230e-01f, -2.269652618e-01f, -2.304924549e-01f, -2.341472212e-01f, -2.379144949e-01f,
+    -2.417781579e-01f, -2.457211820e-01f, -2.497257801e-01f, -2.537735639e-01f, -2.578457083e-01f, -2.619231190e-01f, -2.659866042e-01f, -2.700170466e-01f,
+    -2.739955758e-01f, -2.779037384e-01f, -2.817236656e-01f, -2.854382353e-01f, -2.890312280e-01f, -2.924874757e-01f, -2.957930008e-01f, -2.989351456e-01f,
+    -3.019026896e-01f, -3.046859549e-01f, -3.072768974e-01f, -3.096691839e-01f, -3.118582546e-01f, -3.138413687e-01f, -3.156176350e-01f, -3.171880249e-01f,
+    -3.185553702e-01f, -3.197243422e-01f, -3.207014162e-01f, -3.214948186e-01f, -3.221144579e-01f, -3.225718416e-01f, -3.228799771e-01f, -3.230532601e-01f,
+    -3.231073490e-01f, -3.230590283e-01f, -3.229260615e-01f, -3.227270343e-01f, -3.224811903e-01f, -3.222082599e-01f, -3.219282847e-01f, -3.216614379e-01f,
+    -3.214278438e-01f, -3.212473962e-01f, -3.211395788e-01f, -3.211232885e-01f, -3.212166634e-01f, -3.214369168e-01f, -3.218001794e-01f, -3.223213501e-01f,
+    -3.230139574e-01f, -3.238900332e-01f, -3.249599986e-01f, -3.262325644e-01f, -3.277146467e-01f, -3.294112975e-01f, -3.313256525e-01f, -3.334588956e-01f,
+    -3.358102410e-01f, -3.383769322e-01f, -3.411542597e-01f, -3.441355954e-01f, -3.473124449e-01f, -3.506745164e-01f, -3.542098061e-01f, -3.579046995e-01f,
+    -3.617440871e-01f, -3.657114944e-01f, -3.697892242e-01f, -3.739585114e-01f, -3.781996864e-01f, -3.824923489e-01f, -3.868155483e-01f, -3.911479692e-01f,
+    -3.954681222e-01f, -3.997545359e-01f, -4.039859504e-01f, -4.081415091e-01f, -4.122009484e-01f, -4.161447820e-01f, -4.199544799e-01f, -4.236126392e-01f,
+    -4.271031457e-01f, -4.304113242e-01f, -4.335240775e-01f, -4.364300111e-01f, -4.391195435e-01f, -4.415850005e-01f, -4.438206935e-01f, -4.458229797e-01f,
+    -4.475903043e-01f, -4.491232248e-01f, -4.504244155e-01f, -4.514986544e-01f, -4.523527894e-01f, -4.529956879e-01f, -4.534381659e-01f, -4.536929013e-01f,
+    -4.537743285e-01f, -4.536985175e-01f, -4.534830382e-01f, -4.531468092e-01f, -4.527099352e-01f, -4.521935323e-01f, -4.516195430e-01f, -4.510105439e-01f,
+    -4.503895453e-01f, -4.497797875e-01f, -4.492045325e-01f, -4.486868554e-01f, -4.482494359e-01f, -4.479143523e-01f, -4.477028802e-01f, -4.476352963e-01f,
+    -4.477306915e-01f, -4.480067920e-01f, -4.484797934e-01f, -4.491642057e-01f, -4.500727141e-01f, -4.512160546e-01f, -4.526029063e-01f, -4.542398018e-01f,
+    -4.561310563e-01f, -4.582787157e-01f, -4.606825253e-01f, -4.633399185e-01f, -4.662460263e-01f, -4.693937073e-01f, -4.727735983e-01f, -4.763741852e-01f,
+    -4.801818934e-01f, -4.841811969e-01f, -4.883547465e-01f, -4.926835138e-01f, -4.971469518e-01f, -5.017231701e-01f, -5.063891233e-01f, -5.111208101e-01f,
+    -5.158934833e-01f, -5.206818668e-01f, -5.254603795e-01f, -5.302033630e-01f, -5.348853112e-01f, -5.394811006e-01f, -5.439662179e-01f, -5.483169849e-01f,
+    -5.525107757e-01f, -5.565262275e-01f, -5.603434406e-01f, -5.639441670e-01f, -5.673119853e-01f, -5.704324609e-01f, -5.732932892e-01f, -5.758844205e-01f,
+    -5.781981665e-01f, -5.802292855e-01f, -5.819750467e-01f, -5.834352732e-01f, -5.846123611e-01f, -5.855112771e-01f, -5.861395324e-01f, -5.865071340e-01f,
+    -5.866265133e-01f, -5.865124324e-01f, -5.861818690e-01f, -5.856538810e-01f, -5.849494510e-01f, -5.840913130e-01f, -5.831037614e-01f, -5.820124459e-01f,
+    -5.808441513e-01f, -5.796265665e-01f, -5.783880435e-01f, -5.771573481e-01f, -5.759634055e-01f, -5.748350425e-01f, -5.738007280e-01f, -5.728883152e-01f,
+    -5.721247870e-01f, -5.715360070e-01f, -5.711464786e-01f, -5.709791140e-01f, -5.710550160e-01f, -5.713932737e-01f, -5.720107743e-01f, -5.729220331e-01f,
+    -5.741390437e-01f, -5.756711482e-01f, -5.775249311e-01f, -5.797041360e-01f, -5.822096072e-01f, -5.850392567e-01f, -5.881880565e-01f, -5.916480574e-01f,
+    -5.954084339e-01f, -5.994555549e-01f, -6.037730801e-01f, -6.083420812e-01f, -6.131411874e-01f, -6.181467537e-01f, -6.233330513e-01f, -6.286724776e-01f,
+    -6.341357857e-01f, -6.396923299e-01f, -6.453103263e-01f, -6.509571260e-01f, -6.565994982e-01f, -6.622039219e-01f, -6.677368822e-01f, -6.731651701e-01f,
+    -6.784561820e-01f, -6.835782176e-01f, -6.885007715e-01f, -6.931948185e-01f, -6.976330878e-01f, -7.017903247e-01f, -7.056435372e-01f, -7.091722252e-01f,
+    -7.123585894e-01f, -7.151877196e-01f, -7.176477585e-01f, -7.197300406e-01f, -7.214292041e-01f, -7.227432757e-01f, -7.236737247e-01f, -7.242254892e-01f,
+    -7.244069706e-01f, -7.242299979e-01f, -7.237097615e-01f, -7.228647164e-01f, -7.217164557e-01f, -7.202895544e-01f, -7.186113862e-01f, -7.167119125e-01f,
+    -7.146234468e-01f, -7.123803952e-01f, -7.100189757e-01f, -7.075769183e-01f, -7.050931475e-01f, -7.026074518e-01f, -7.001601402e-01f, -6.977916908e-01f,
+    -6.955423933e-01f, -6.934519886e-01f, -6.915593090e-01f, -6.899019219e-01f, -6.885157792e-01f, -6.874348776e-01f, -6.866909312e-01f, -6.863130592e-01f,
+    -6.863274931e-01f, -6.867573049e-01f, -6.876221594e-01f, -6.889380930e-01f, -6.907173210e-01f, -6.929680760e-01f, -6.956944785e-01f, -6.988964418e-01f,
+    -7.025696122e-01f, -7.067053454e-01f, -7.112907202e-01f, -7.163085893e-01f, -7.217376677e-01f, -7.275526585e-01f, -7.337244154e-01f, -7.402201402e-01f,
+    -7.470036163e-01f, -7.540354741e-01f, -7.612734883e-01f, -7.686729044e-01f, -7.761867919e-01f, -7.837664218e-01f, -7.913616658e-01f, -7.989214133e-01f,
+    -8.063940043e-01f, -8.137276729e-01f, -8.208709998e-01f, -8.277733689e-01f, -8.343854241e-01f, -8.406595238e-01f, -8.465501869e-01f, -8.520145295e-01f,
+    -8.570126853e-01f, -8.615082085e-01f, -8.654684542e-01f, -8.688649326e-01f, -8.716736348e-01f, -8.738753259e-01f, -8.754558032e-01f, -8.764061157e-01f,
+    -8.767227441e-01f, -8.764077376e-01f, -8.754688067e-01f, -8.739193694e-01f, -8.717785511e-01f, -8.690711361e-01f, -8.658274707e-01f, -8.620833181e-01f,
+    -8.578796654e-01f, -8.532624824e-01f, -8.482824355e-01f, -8.429945553e-01f, -8.374578626e-01f, -8.317349528e-01f, -8.258915427e-01f, -8.199959820e-01f,
+    -8.141187328e-01f, -8.083318203e-01f, -8.027082599e-01f, -7.973214626e-01f, -7.922446246e-01f, -7.875501051e-01f, -7.833087969e-01f, -7.795894939e-01f,
+    -7.764582617e-01f, -7.739778149e-01f, -7.722069065e-01f, -7.711997340e-01f, -7.710053677e-01f, -7.716672050e-01f, -7.732224557e-01f, -7.757016627e-01f,
+    -7.791282619e-01f, -7.835181866e-01f, -7.888795173e-01f, -7.952121836e-01f, -8.025077190e-01f, -8.107490717e-01f, -8.199104740e-01f, -8.299573728e-01f,
+    -8.408464206e-01f, -8.525255308e-01f, -8.649339957e-01f, -8.780026681e-01f, -8.916542066e-01f, -9.058033831e-01f, -9.203574515e-01f, -9.352165761e-01f,
+    -9.502743168e-01f, -9.654181702e-01f, -9.805301608e-01f, -9.954874818e-01f, -1.010163180e+00f, -1.024426879e+00f, -1.038145543e+00f, -1.051184266e+00f,
+    -1.063407090e+00f, -1.074677845e+00f, -1.084860998e+00f, -1.093822520e+00f, -1.101430750e+00f, -1.107557260e+00f, -1.112077709e+00f, -1.114872687e+00f,
+    -1.115828539e+00f, -1.114838154e+00f, -1.111801738e+00f, -1.106627541e+00f, -1.099232539e+00f, -1.089543080e+00f, -1.077495469e+00f, -1.063036501e+00f,
+    -1.046123932e+00f, -1.026726894e+00f, -1.004826228e+00f, -9.804147646e-01f, -9.534975208e-01f, -9.240918290e-01f, -8.922273886e-01f, -8.579462430e-01f,
+    -8.213026797e-01f, -7.823630553e-01f, -7.412055449e-01f, -6.979198174e-01f, -6.526066389e-01f, -6.053774065e-01f, -5.563536139e-01f, -5.056662545e-01f,
+    -4.534551626e-01f, -3.998682993e-01f, -3.450609862e-01f, -2.891950920e-01f, -2.324381776e-01f, -1.749626040e-01f, -1.169446098e-01f, -5.856336406e-02f,
+    -1.576265091e-16f,  5.856336406e-02f,  1.169446098e-01f,  1.749626040e-01f,  2.324381776e-01f,  2.891950920e-01f,  3.450609862e-01f,  3.998682993e-01f,
+     4.534551626e-01f,  5.056662545e-01f,  5.563536139e-01f,  6.053774065e-01f,  6.526066389e-01f,  6.979198174e-01f,  7.412055449e-01f,  7.823630553e-01f,
+     8.213026797e-01f,  8.579462430e-01f,  8.922273886e-01f,  9.240918290e-01f,  9.534975208e-01f,  9.804147646e-01f,  1.004826228e+00f,  1.026726894e+00f,
+     1.046123932e+00f,  1.063036501e+00f,  1.077495469e+00f,  1.089543080e+00f,  1.099232539e+00f,  1.106627541e+00f,  1.111801738e+00f,  1.114838154e+00f,
+     1.115828539e+00f,  1.114872687e+00f,  1.112077709e+00f,  1.107557260e+00f,  1.101430750e+00f,  1.093822520e+00f,  1.084860998e+00f,  1.074677845e+00f,
+     1.063407090e+00f,  1.051184266e+00f,  1.038145543e+00f,  1.024426879e+00f,  1.010163180e+00f,  9.954874818e-01f,  9.805301608e-01f,  9.654181702e-01f,
+     9.502743168e-01f,  9.352165761e-01f,  9.203574515e-01f,  9.058033831e-01f,  8.916542066e-01f,  8.780026681e-01f,  8.649339957e-01f,  8.525255308e-01f,
+     8.408464206e-01f,  8.299573728e-01f,  8.199104740e-01f,  8.107490717e-01f,  8.025077190e-01f,  7.952121836e-01f,  7.888795173e-01f,  7.835181866e-01f,
+     7.791282619e-01f,  7.757016627e-01f,  7.732224557e-01f,  7.716672050e-01f,  7.710053677e-01f,  7.711997340e-01f,  7.722069065e-01f,  7.739778149e-01f,
+     7.764582617e-01f,  7.795894939e-01f,  7.833087969e-01f,  7.875501051e-01f,  7.922446246e-01f,  7.973214626e-01f,  8.027082599e-01f,  8.083318203e-01f,
+     8.141187328e-01f,  8.199959820e-01f,  8.258915427e-01f,  8.317349528e-01f,  8.374578626e-01f,  8.429945553e-01f,  8.482824355e-01f,  8.532624824e-01f,
+     8.578796654e-01f,  8.620833181e-01f,  8.658274707e-01f,  8.690711361e-01f,  8.717785511e-01f,  8.739193694e-01f,  8.754688067e-01f,  8.764077376e-01f,
+     8.767227441e-01f,  8.764061157e-01f,  8.754558032e-01f,  8.738753259e-01f,  8.716736348e-01f,  8.688649326e-01f,  8.654684542e-01f,  8.615082085e-01f,
+     8.570126853e-01f,  8.520145295e-01f,  8.465501869e-01f,  8.406595238e-01f,  8.343854241e-01f,  8.277733689e-01f,  8.208709998e-01f,  8.137276729e-01f,
+     8.063940043e-01f,  7.989214133e-01f,  7.913616658e-01f,  7.837664218e-01f,  7.761867919e-01f,  7.686729044e-01f,  7.612734883e-01f,  7.540354741e-01f,
+     7.470036163e-01f,  7.402201402e-01f,  7.337244154e-01f,  7.275526585e-01f,  7.217376677e-01f,  7.163085893e-01f,  7.112907202e-01f,  7.067053454e-01f,
+     7.025696122e-01f,  6.988964418e-01f,  6.956944785e-01f,  6.929680760e-01f,  6.907173210e-01f,  6.889380930e-01f,  6.876221594e-01f,  6.867573049e-01f,
+     6.863274931e-01f,  6.863130592e-01f,  6.866909312e-01f,  6.874348776e-01f,  6.885157792e-01f,  6.899019219e-01f,  6.915593090e-01f,  6.934519886e-01f,
+     6.955423933e-01f,  6.977916908e-01f,  7.001601402e-01f,  7.026074518e-01f,  7.050931475e-01f,  7.075769183e-01f,  7.100189757e-01f,  7.123803952e-01f,
+     7.146234468e-01f,  7.167119125e-01f,  7.186113862e-01f,  7.202895544e-01f,  7.217164557e-01f,  7.228647164e-01f,  7.237097615e-01f,  7.242299979e-01f,
+     7.244069706e-01f,  7.242254892e-01f,  7.236737247e-01f,  7.227432757e-01f,  7.214292041e-01f,  7.197300406e-01f,  7.176477585e-01f,  7.151877196e-01f,
+     7.123585894e-01f,  7.091722252e-01f,  7.056435372e-01f,  7.017903247e-01f,  6.976330878e-01f,  6.931948185e-01f,  6.885007715e-01f,  6.835782176e-01f,
+     6.784561820e-01f,  6.731651701e-01f,  6.677368822e-01f,  6.622039219e-01f,  6.565994982e-01f,  6.509571260e-01f,  6.453103263e-01f,  6.396923299e-01f,
+     6.341357857e-01f,  6.286724776e-01f,  6.233330513e-01f,  6.181467537e-01f,  6.131411874e-01f,  6.083420812e-01f,  6.037730801e-01f,  5.994555549e-01f,
+     5.954084339e-01f,  5.916480574e-01f,  5.881880565e-01f,  5.850392567e-01f,  5.822096072e-01f,  5.797041360e-01f,  5.775249311e-01f,  5.756711482e-01f,
+     5.741390437e-01f,  5.729220331e-01f,  5.720107743e-01f,  5.713932737e-01f,  5.710550160e-01f,  5.709791140e-01f,  5.711464786e-01f,  5.715360070e-01f,
+     5.721247870e-01f,  5.728883152e-01f,  5.738007280e-01f,  5.748350425e-01f,  5.759634055e-01f,  5.771573481e-01f,  5.783880435e-01f,  5.796265665e-01f,
+     5.808441513e-01f,  5.820124459e-01f,  5.831037614e-01f,  5.840913130e-01f,  5.849494510e-01f,  5.856538810e-01f,  5.861818690e-01f,  5.865124324e-01f,
+     5.866265133e-01f,  5.865071340e-01f,  5.861395324e-01f,  5.855112771e-01f,  5.846123611e-01f,  5.834352732e-01f,  5.819750467e-01f,  5.802292855e-01f,
+     5.781981665e-01f,  5.758844205e-01f,  5.732932892e-01f,  5.704324609e-01f,  5.673119853e-01f,  5.639441670e-01f,  5.603434406e-01f,  5.565262275e-01f,
+     5.525107757e-01f,  5.483169849e-01f,  5.439662179e-01f,  5.394811006e-01f,  5.348853112e-01f,  5.302033630e-01f,  5.254603795e-01f,  5.206818668e-01f,
+     5.158934833e-01f,  5.111208101e-01f,  5.063891233e-01f,  5.017231701e-01f,  4.971469518e-01f,  4.926835138e-01f,  4.883547465e-01f,  4.841811969e-01f,
+     4.801818934e-01f,  4.763741852e-01f,  4.727735983e-01f,  4.693937073e-01f,  4.662460263e-01f,  4.633399185e-01f,  4.606825253e-01f,  4.582787157e-01f,
+     4.561310563e-01f,  4.542398018e-01f,  4.526029063e-01f,  4.512160546e-01f,  4.500727141e-01f,  4.491642057e-01f,  4.484797934e-01f,  4.480067920e-01f,
+     4.477306915e-01f,  4.476352963e-01f,  4.477028802e-01f,  4.479143523e-01f,  4.482494359e-01f,  4.486868554e-01f,  4.492045325e-01f,  4.497797875e-01f,
+     4.503895453e-01f,  4.510105439e-01f,  4.516195430e-01f,  4.521935323e-01f,  4.527099352e-01f,  4.531468092e-01f,  4.534830382e-01f,  4.536985175e-01f,
+     4.537743285e-01f,  4.536929013e-01f,  4.534381659e-01f,  4.529956879e-01f,  4.523527894e-01f,  4.514986544e-01f,  4.504244155e-01f,  4.491232248e-01f,
+     4.475903043e-01f,  4.458229797e-01f,  4.438206935e-01f,  4.415850005e-01f,  4.391195435e-01f,  4.364300111e-01f,  4.335240775e-01f,  4.304113242e-01f,
+     4.271031457e-01f,  4.236126392e-01f,  4.199544799e-01f,  4.161447820e-01f,  4.122009484e-01f,  4.081415091e-01f,  4.039859504e-01f,  3.997545359e-01f,
+     3.954681222e-01f,  3.911479692e-01f,  3.868155483e-01f,  3.824923489e-01f,  3.781996864e-01f,  3.739585114e-01f,  3.697892242e-01f,  3.657114944e-01f,
+     3.617440871e-01f,  3.579046995e-01f,  3.542098061e-01f,  3.506745164e-01f,  3.473124449e-01f,  3.441355954e-01f,  3.411542597e-01f,  3.383769322e-01f,
+     3.358102410e-01f,  3.334588956e-01f,  3.313256525e-01f,  3.294112975e-01f,  3.277146467e-01f,  3.262325644e-01f,  3.249599986e-01f,  3.238900332e-01f,
+     3.230139574e-01f,  3.223213501e-01f,  3.218001794e-01f,  3.214369168e-01f,  3.212166634e-01f,  3.211232885e-01f,  3.211395788e-01f,  3.212473962e-01f,
+     3.214278438e-01f,  3.216614379e-01f,  3.219282847e-01f,  3.222082599e-01f,  3.224811903e-01f,  3.227270343e-01f,  3.229260615e-01f,  3.230590283e-01f,
+     3.231073490e-01f,  3.230532601e-01f,  3.228799771e-01f,  3.225718416e-01f,  3.221144579e-01f,  3.214948186e-01f,  3.207014162e-01f,  3.197243422e-01f,
+     3.185553702e-01f,  3.171880249e-01f,  3.156176350e-01f,  3.138413687e-01f,  3.118582546e-01f,  3.096691839e-01f,  3.072768974e-01f,  3.046859549e-01f,
+     3.019026896e-01f,  2.989351456e-01f,  2.957930008e-01f,  2.924874757e-01f,  2.890312280e-01f,  2.854382353e-01f,  2.817236656e-01f,  2.779037384e-01f,
+     2.739955758e-01f,  2.700170466e-01f,  2.659866042e-01f,  2.619231190e-01f,  2.578457083e-01f,  2.537735639e-01f,  2.497257801e-01f,  2.457211820e-01f,
+     2.417781579e-01f,  2.379144949e-01f,  2.341472212e-01f,  2.304924549e-01f,  2.269652618e-01f,  2.235795230e-01f,  2.203478127e-01f,  2.172812891e-01f,
+     2.143895973e-01f,  2.116807864e-01f,  2.091612412e-01f,  2.068356287e-01f,  2.047068602e-01f,  2.027760693e-01f,  2.010426057e-01f,  1.995040448e-01f,
+     1.981562142e-01f,  1.969932342e-01f,  1.960075749e-01f,  1.951901271e-01f,  1.945302876e-01f,  1.940160574e-01f,  1.936341528e-01f,  1.933701267e-01f,
+     1.932085015e-01f,  1.931329095e-01f,  1.931262419e-01f,  1.931708039e-01f,  1.932484750e-01f,  1.933408720e-01f,  1.934295150e-01f,  1.934959935e-01f,
+     1.935221313e-01f,  1.934901495e-01f,  1.933828253e-01f,  1.931836459e-01f,  1.928769550e-01f,  1.924480922e-01f,  1.918835231e-01f,  1.911709580e-01f,
+     1.902994612e-01f,  1.892595460e-01f,  1.880432580e-01f,  1.866442436e-01f,  1.850578044e-01f,  1.832809373e-01f,  1.813123577e-01f,  1.791525091e-01f,
+     1.768035560e-01f,  1.742693622e-01f,  1.715554526e-01f,  1.686689620e-01f,  1.656185680e-01f,  1.624144112e-01f,  1.590680013e-01f,  1.555921126e-01f,
+     1.520006666e-01f,  1.483086061e-01f,  1.445317589e-01f,  1.406866947e-01f,  1.367905755e-01f,  1.328610000e-01f,  1.289158455e-01f,  1.249731066e-01f,
+     1.210507336e-01f,  1.171664712e-01f,  1.133376991e-01f,  1.095812767e-01f,  1.059133920e-01f,  1.023494169e-01f,  9.890377003e-02f,  9.558978852e-02f,
+     9.241960904e-02f,  8.940406022e-02f,  8.655256673e-02f,  8.387306604e-02f,  8.137193866e-02f,  7.905395238e-02f,  7.692222101e-02f,  7.497817802e-02f,
+     7.322156529e-02f,  7.165043697e-02f,  7.026117856e-02f,  6.904854085e-02f,  6.800568856e-02f,  6.712426311e-02f,  6.639445904e-02f,  6.580511332e-02f,
+     6.534380676e-02f,  6.499697660e-02f,  6.475003929e-02f,  6.458752235e-02f,  6.449320401e-02f,  6.445025961e-02f,  6.444141321e-02f,  6.444909315e-02f,
+     6.445559021e-02f,  6.444321686e-02f,  6.439446621e-02f,  6.429216932e-02f,  6.411964926e-02f,  6.386087080e-02f,  6.350058419e-02f,  6.302446179e-02f,
+     6.241922648e-02f,  6.167277043e-02f,  6.077426344e-02f,  5.971424975e-02f,  5.848473241e-02f,  5.707924463e-02f,  5.549290728e-02f,  5.372247220e-02f,
+     5.176635084e-02f,  4.962462796e-02f,  4.729906038e-02f,  4.479306067e-02f,  4.211166607e-02f,  3.926149272e-02f,  3.625067586e-02f,  3.308879636e-02f,
+     2.978679426e-02f,  2.635687021e-02f,  2.281237555e-02f,  1.916769209e-02f,  1.543810274e-02f,  1.163965393e-02f,  7.789011341e-03f,  3.903309952e-03f,
+     0.000000000e+00f,
+  },
+  { // level 6: 7 harmonics
+     0.000000000e+00f, -3.905563751e-03f, -7.807011714e-03f, -1.170023662e-02f, -1.558114823e-02f, -1.944568179e-02f, -2.328980648e-02f, -2.710953371e-02f,
+    -3.090092543e-02f, -3.466010228e-02f, -3.838325161e-02f, -4.206663541e-02f, -4.570659804e-02f, -4.929957383e-02f, -5.284209448e-02f, -5.633079627e-02f,
+    -5.976242704e-02f, -6.313385294e-02f, -6.644206500e-02f, -6.968418536e-02f, -7.285747327e-02f, -7.595933083e-02f, -7.898730844e-02f, -8.193910987e-02f,
+    -8.481259713e-02f, -8.760579493e-02f, -9.031689488e-02f, -9.294425927e-02f, -9.548642455e-02f, -9.794210449e-02f, -1.003101929e-01f, -1.025897659e-01f,
+    -1.047800843e-01f, -1.068805947e-01f, -1.088909312e-01f, -1.108109162e-01f, -1.126405605e-01f, -1.143800639e-01f, -1.160298147e-01f, -1.175903889e-01f,
+    -1.190625494e-01f, -1.204472444e-01f, -1.217456055e-01f, -1.229589457e-01f, -1.240887567e-01f, -1.251367058e-01f, -1.261046330e-01f, -1.269945470e-01f,
+    -1.278086212e-01f, -1.285491895e-01f, -1.292187416e-01f, -1.298199177e-01f, -1.303555037e-01f, -1.308284250e-01f, -1.312417409e-01f, -1.315986385e-01f,
+    -1.319024259e-01f, -1.321565256e-01f, -1.323644679e-01f, -1.325298830e-01f, -1.326564942e-01f, -1.327481100e-01f, -1.328086165e-01f, -1.328419691e-01f,
+    -1.328521849e-01f, -1.328433339e-01f, -1.328195311e-01f, -1.327849278e-01f, -1.327437031e-01f, -1.327000552e-01f, -1.326581931e-01f, -1.326223273e-01f,
+    -1.325966616e-01f, -1.325853841e-01f, -1.325926586e-01f, -1.326226161e-01f, -1.326793459e-01f, -1.327668873e-01f, -1.328892211e-01f, -1.330502614e-01f,
+    -1.332538470e-01f, -1.335037338e-01f, -1.338035868e-01f, -1.341569722e-01f, -1.345673500e-01f, -1.350380665e-01f, -1.355723476e-01f, -1.361732914e-01f,
+    -1.368438620e-01f, -1.375868830e-01f, -1.384050313e-01f, -1.393008316e-01f, -1.402766504e-01f, -1.413346917e-01f, -1.424769910e-01f, -1.437054120e-01f,
+    -1.450216414e-01f, -1.464271857e-01f, -1.479233678e-01f, -1.495113234e-01f, -1.511919987e-01f, -1.529661480e-01f, -1.548343320e-01f, -1.567969156e-01f,
+    -1.588540676e-01f, -1.610057594e-01f, -1.632517646e-01f, -1.655916597e-01f, -1.680248239e-01f, -1.705504404e-01f, -1.731674973e-01f, -1.758747897e-01f,
+    -1.786709215e-01f, -1.815543081e-01f, -1.845231790e-01f, -1.875755812e-01f, -1.907093828e-01f, -1.939222772e-01f, -1.972117871e-01f, -2.005752695e-01f,
+    -2.040099209e-01f, -2.075127823e-01f, -2.110807454e-01f, -2.147105583e-01f, -2.183988323e-01f, -2.221420480e-01f, -2.259365630e-01f, -2.297786184e-01f,
+    -2.336643467e-01f, -2.375897795e-01f, -2.415508553e-01f, -2.455434278e-01f, -2.495632739e-01f, -2.536061030e-01f, -2.576675648e-01f, -2.617432587e-01f,
+    -2.658287425e-01f, -2.699195417e-01f, -2.740111583e-01f, -2.780990805e-01f, -2.821787916e-01f, -2.862457793e-01f, -2.902955454e-01f, -2.943236147e-01f,
+    -2.983255447e-01f, -3.022969345e-01f, -3.062334343e-01f, -3.101307543e-01f, -3.139846739e-01f, -3.177910505e-01f, -3.215458285e-01f, -3.252450476e-01f,
+    -3.288848515e-01f, -3.324614961e-01f, -3.359713575e-01f, -3.394109400e-01f, -3.427768836e-01f, -3.460659715e-01f, -3.492751369e-01f, -3.524014700e-01f,
+    -3.554422246e-01f, -3.583948241e-01f, -3.612568675e-01f, -3.640261347e-01f, -3.667005921e-01f, -3.692783968e-01f, -3.717579017e-01f, -3.741376591e-01f,
+    -3.764164244e-01f, -3.785931597e-01f, -3.806670362e-01f, -3.826374369e-01f, -3.845039584e-01f, -3.862664129e-01f, -3.879248289e-01f, -3.894794521e-01f,
+    -3.909307455e-01f, -3.922793897e-01f, -3.935262817e-01f, -3.946725341e-01f, -3.957194738e-01f, -3.966686398e-01f, -3.975217806e-01f, -3.982808522e-01f,
+    -3.989480138e-01f, -3.995256251e-01f, -4.000162413e-01f, -4.004226096e-01f, -4.007476632e-01f, -4.009945169e-01f, -4.011664609e-01f, -4.012669549e-01f,
+    -4.012996216e-01f, -4.012682398e-01f, -4.011767377e-01f, -4.010291848e-01f, -4.008297843e-01f, -4.005828656e-01f, -4.002928749e-01f, -3.999643673e-01f,
+    -3.996019978e-01f, -3.992105117e-01f, -3.987947358e-01f, -3.983595684e-01f, -3.979099699e-01f, -3.974509525e-01f, -3.969875703e-01f, -3.965249093e-01f,
+    -3.960680766e-01f, -3.956221907e-01f, -3.951923703e-01f, -3.947837242e-01f, -3.944013408e-01f, -3.940502773e-01f, -3.937355495e-01f, -3.934621210e-01f,
+    -3.932348929e-01f, -3.930586935e-01f, -3.929382679e-01f, -3.928782681e-01f, -3.928832429e-01f, -3.929576278e-01f, -3.931057359e-01f, -3.933317480e-01f,
+    -3.936397037e-01f, -3.940334920e-01f, -3.945168430e-01f, -3.950933195e-01f, -3.957663083e-01f, -3.965390130e-01f, -3.974144462e-01f, -3.983954224e-01f,
+    -3.994845512e-01f, -4.006842308e-01f, -4.019966424e-01f, -4.034237439e-01f, -4.049672656e-01f, -4.066287045e-01f, -4.084093208e-01f, -4.103101335e-01f,
+    -4.123319173e-01f, -4.144751997e-01f, -4.167402583e-01f, -4.191271191e-01f, -4.216355552e-01f, -4.242650854e-01f, -4.270149740e-01f, -4.298842311e-01f,
+    -4.328716128e-01f, -4.359756223e-01f, -4.391945121e-01f, -4.425262852e-01f, -4.459686984e-01f, -4.495192653e-01f, -4.531752598e-01f, -4.569337202e-01f,
+    -4.607914543e-01f, -4.647450438e-01f, -4.687908505e-01f, -4.729250222e-01f, -4.771434990e-01f, -4.814420209e-01f, -4.858161344e-01f, -4.902612012e-01f,
+    -4.947724058e-01f, -4.993447649e-01f, -5.039731355e-01f, -5.086522255e-01f, -5.133766026e-01f, -5.181407049e-01f, -5.229388510e-01f, -5.277652515e-01f,
+    -5.326140190e-01f, -5.374791803e-01f, -5.423546877e-01f, -5.472344304e-01f, -5.521122471e-01f, -5.569819376e-01f, -5.618372757e-01f, -5.666720209e-01f,
+    -5.714799316e-01f, -5.762547776e-01f, -5.809903524e-01f, -5.856804867e-01f, -5.903190601e-01f, -5.949000150e-01f, -5.994173685e-01f, -6.038652253e-01f,
+    -6.082377901e-01f, -6.125293805e-01f, -6.167344387e-01f, -6.208475440e-01f, -6.248634249e-01f, -6.287769703e-01f, -6.325832418e-01f, -6.362774840e-01f,
+    -6.398551366e-01f, -6.433118440e-01f, -6.466434664e-01f, -6.498460895e-01f, -6.529160342e-01f, -6.558498657e-01f, -6.586444027e-01f, -6.612967254e-01f,
+    -6.638041837e-01f, -6.661644046e-01f, -6.683752990e-01f, -6.704350688e-01f, -6.723422123e-01f, -6.740955298e-01f, -6.756941287e-01f, -6.771374274e-01f,
+    -6.784251598e-01f, -6.795573777e-01f, -6.805344540e-01f, -6.813570842e-01f, -6.820262882e-01f, -6.825434109e-01f, -6.829101222e-01f, -6.831284168e-01f,
+    -6.832006128e-01f, -6.831293502e-01f, -6.829175882e-01f, -6.825686025e-01f, -6.820859814e-01f, -6.814736217e-01f, -6.807357235e-01f, -6.798767851e-01f,
+    -6.789015961e-01f, -6.778152316e-01f, -6.766230438e-01f, -6.753306548e-01f, -6.739439476e-01f, -6.724690570e-01f, -6.709123601e-01f, -6.692804658e-01f,
+    -6.675802041e-01f, -6.658186151e-01f, -6.640029364e-01f, -6.621405917e-01f, -6.602391775e-01f, -6.583064500e-01f, -6.563503118e-01f, -6.543787971e-01f,
+    -6.524000581e-01f, -6.504223500e-01f, -6.484540155e-01f, -6.465034699e-01f, -6.445791851e-01f, -6.426896737e-01f, -6.408434730e-01f, -6.390491283e-01f,
+    -6.373151767e-01f, -6.356501300e-01f, -6.340624582e-01f, -6.325605722e-01f, -6.311528074e-01f, -6.298474060e-01f, -6.286525006e-01f, -6.275760969e-01f,
+    -6.266260565e-01f, -6.258100809e-01f, -6.251356939e-01f, -6.246102256e-01f, -6.242407956e-01f, -6.240342972e-01f, -6.239973813e-01f, -6.241364408e-01f,
+    -6.244575951e-01f, -6.249666752e-01f, -6.256692089e-01f, -6.265704066e-01f, -6.276751476e-01f, -6.289879663e-01f, -6.305130392e-01f, -6.322541731e-01f,
+    -6.342147922e-01f, -6.363979274e-01f, -6.388062050e-01f, -6.414418369e-01f, -6.443066103e-01f, -6.474018792e-01f, -6.507285561e-01f, -6.542871036e-01f,
+    -6.580775283e-01f, -6.620993738e-01f, -6.663517154e-01f, -6.708331552e-01f, -6.755418181e-01f, -6.804753483e-01f, -6.856309069e-01f, -6.910051697e-01f,
+    -6.965943270e-01f, -7.023940826e-01f, -7.083996548e-01f, -7.146057778e-01f, -7.210067040e-01f, -7.275962067e-01f, -7.343675842e-01f, -7.413136648e-01f,
+    -7.484268115e-01f, -7.556989290e-01f, -7.631214706e-01f, -7.706854456e-01f, -7.783814289e-01f, -7.861995697e-01f, -7.941296020e-01f, -8.021608557e-01f,
+    -8.102822679e-01f, -8.184823961e-01f, -8.267494307e-01f, -8.350712092e-01f, -8.434352305e-01f, -8.518286706e-01f, -8.602383980e-01f, -8.686509904e-01f,
+    -8.770527515e-01f, -8.854297292e-01f, -8.937677332e-01f, -9.020523541e-01f, -9.102689823e-01f, -9.184028279e-01f, -9.264389410e-01f, -9.343622316e-01f,
+    -9.421574910e-01f, -9.498094131e-01f, -9.573026156e-01f, -9.646216619e-01f, -9.717510836e-01f, -9.786754022e-01f, -9.853791523e-01f, -9.918469033e-01f,
+    -9.980632832e-01f, -1.004013001e+00f, -1.009680868e+00f, -1.015051824e+00f, -1.020110958e+00f, -1.024843531e+00f, -1.029234997e+00f, -1.033271031e+00f,
+    -1.036937546e+00f, -1.040220716e+00f, -1.043107000e+00f, -1.045583163e+00f, -1.047636295e+00f, -1.049253837e+00f, -1.050423594e+00f, -1.051133764e+00f,
+    -1.051372948e+00f, -1.051130180e+00f, -1.050394937e+00f, -1.049157160e+00f, -1.047407272e+00f, -1.045136197e+00f, -1.042335372e+00f, -1.038996764e+00f,
+    -1.035112890e+00f, -1.030676822e+00f, -1.025682209e+00f, -1.020123286e+00f, -1.013994885e+00f, -1.007292448e+00f, -1.000012039e+00f, -9.921503480e-01f,
+    -9.837047060e-01f, -9.746730883e-01f, -9.650541235e-01f, -9.548470986e-01f, -9.440519646e-01f, -9.326693401e-01f, -9.207005148e-01f, -9.081474518e-01f,
+    -8.950127884e-01f, -8.812998371e-01f, -8.670125844e-01f, -8.521556894e-01f, -8.367344813e-01f, -8.207549559e-01f, -8.042237707e-01f, -7.871482402e-01f,
+    -7.695363288e-01f, -7.513966439e-01f, -7.327384274e-01f, -7.135715467e-01f, -6.939064846e-01f, -6.737543281e-01f, -6.531267567e-01f, -6.320360299e-01f,
+    -6.104949729e-01f, -5.885169629e-01f, -5.661159137e-01f, -5.433062595e-01f, -5.201029381e-01f, -4.965213736e-01f, -4.725774581e-01f, -4.482875329e-01f,
+    -4.236683683e-01f, -3.987371443e-01f, -3.735114291e-01f, -3.480091577e-01f, -3.222486106e-01f, -2.962483905e-01f, -2.700273999e-01f, -2.436048177e-01f,
+    -2.170000749e-01f, -1.902328312e-01f, -1.633229500e-01f, -1.362904737e-01f, -1.091555984e-01f, -8.193864922e-02f, -5.466005410e-02f, -2.734031862e-02f,
+    -1.306815700e-16f,  2.734031862e-02f,  5.466005410e-02f,  8.193864922e-02f,  1.091555984e-01f,  1.362904737e-01f,  1.633229500e-01f,  1.902328312e-01f,
+     2.170000749e-01f,  2.436048177e-01f,  2.700273999e-01f,  2.962483905e-01f,  3.222486106e-01f,  3.480091577e-01f,  3.735114291e-01f,  3.987371443e-01f,
+     4.236683683e-01f,  4.482875329e-01f,  4.725774581e-01f,  4.965213736e-01f,  5.201029381e-01f,  5.433062595e-01f,  5.661159137e-01f,  5.885169629e-01f,
+     6.104949729e-01f,  6.320360299e-01f,  6.531267567e-01f,  6.737543281e-01f,  6.939064846e-01f,  7.135715467e-01f,  7.327384274e-01f,  7.513966439e-01f,
+     7.695363288e-01f,  7.871482402e-01f,  8.042237707e-01f,  8.207549559e-01f,  8.367344813e-01f,  8.521556894e-01f,  8.670125844e-01f,  8.812998371e-01f,
+     8.950127884e-01f,  9.081474518e-01f,  9.207005148e-01f,  9.326693401e-01f,  9.440519646e-01f,  9.548470986e-01f,  9.650541235e-01f,  9.746730883e-01f,
+     9.837047060e-01f,  9.921503480e-01f,  1.000012039e+00f,  1.007292448e+00f,  1.013994885e+00f,  1.020123286e+00f,  1.025682209e+00f,  1.030676822e+00f,
+     1.035112890e+00f,  1.038996764e+00f,  1.042335372e+00f,  1.045136197e+00f,  1.047407272e+00f,  1.049157160e+00f,  1.050394937e+00f,  1.051130180e+00f,
+     1.051372948e+00f,  1.051133764e+00f,  1.050423594e+00f,  1.049253837e+00f,  1.047636295e+00f,  1.045583163e+00f,  1.043107000e+00f,  1.040220716e+00f,
+     1.036937546e+00f,  1.033271031e+00f,  1.029234997e+00f,  1.024843531e+00f,  1.020110958e+00f,  1.015051824e+00f,  1.009680868e+00f,  1.004013001e+00f,
+     9.980632832e-01f,  9.918469033e-01f,  9.853791523e-01f,  9.786754022e-01f,  9.717510836e-01f,  9.646216619e-01f,  9.573026156e-01f,  9.498094131e-01f,
+     9.421574910e-01f,  9.343622316e-01f,  9.264389410e-01f,  9.184028279e-01f,  9.102689823e-01f,  9.020523541e-01f,  8.937677332e-01f,  8.854297292e-01f,
+     8.770527515e-01f,  8.686509904e-01f,  8.602383980e-01f,  8.518286706e-01f,  8.434352305e-01f,  8.350712092e-01f,  8.267494307e-01f,  8.184823961e-01f,
+     8.102822679e-01f,  8.021608557e-01f,  7.941296020e-01f,  7.861995697e-01f,  7.783814289e-01f,  7.706854456e-01f,  7.631214706e-01f,  7.556989290e-01f,
+     7.484268115e-01f,  7.413136648e-01f,  7.343675842e-01f,  7.275962067e-01f,  7.210067040e-01f,  7.146057778e-01f,  7.083996548e-01f,  7.023940826e-01f,
+     6.965943270e-01f,  6.910051697e-01f,  6.856309069e-01f,  6.804753483e-01f,  6.755418181e-01f,  6.708331552e-01f,  6.663517154e-01f,  6.620993738e-01f,
+     6.580775283e-01f,  6.542871036e-01f,  6.507285561e-01f,  6.474018792e-01f,  6.443066103e-01f,  6.414418369e-01f,  6.388062050e-01f,  6.363979274e-01f,
+     6.342147922e-01f,  6.322541731e-01f,  6.305130392e-01f,  6.289879663e-01f,  6.276751476e-01f,  6.265704066e-01f,  6.256692089e-01f,  6.249666752e-01f,
+     6.244575951e-01f,  6.241364408e-01f,  6.239973813e-01f,  6.240342972e-01f,  6.242407956e-01f,  6.246102256e-01f,  6.251356939e-01f,  6.258100809e-01f,
+     6.266260565e-01f,  6.275760969e-01f,  6.286525006e-01f,  6.298474060e-01f,  6.311528074e-01f,  6.325605722e-01f,  6.340624582e-01f,  6.356501300e-01f,
+     6.373151767e-01f,  6.390491283e-01f,  6.408434730e-01f,  6.426896737e-01f,  6.445791851e-01f,  6.465034699e-01f,  6.484540155e-01f,  6.504223500e-01f,
+     6.524000581e-01f,  6.543787971e-01f,  6.563503118e-01f,  6.583064500e-01f,  6.602391775e-01f,  6.621405917e-01f,  6.640029364e-01f,  6.658186151e-01f,
+     6.675802041e-01f,  6.692804658e-01f,  6.709123601e-01f,  6.724690570e-01f,  6.739439476e-01f,  6.753306548e-01f,  6.766230438e-01f,  6.778152316e-01f,
+     6.789015961e-01f,  6.798767851e-01f,  6.807357235e-01f,  6.814736217e-01f,  6.820859814e-01f,  6.825686025e-01f,  6.829175882e-01f,  6.831293502e-01f,
+     6.832006128e-01f,  6.831284168e-01f,  6.829101222e-01f,  6.825434109e-01f,  6.820262882e-01f,  6.813570842e-01f,  6.805344540e-01f,  6.795573777e-01f,
+     6.784251598e-01f,  6.771374274e-01f,  6.756941287e-01f,  6.740955298e-01f,  6.723422123e-01f,  6.704350688e-01f,  6.683752990e-01f,  6.661644046e-01f,
+     6.638041837e-01f,  6.612967254e-01f,  6.586444027e-01f,  6.558498657e-01f,  6.529160342e-01f,  6.498460895e-01f,  6.466434664e-01f,  6.433118440e-01f,
+     6.398551366e-01f,  6.362774840e-01f,  6.325832418e-01f,  6.287769703e-01f,  6.248634249e-01f,  6.208475440e-01f,  6.167344387e-01f,  6.125293805e-01f,
+     6.082377901e-01f,  6.038652253e-01f,  5.994173685e-01f,  5.949000150e-01f,  5.903190601e-01f,  5.856804867e-01f,  5.809903524e-01f,  5.762547776e-01f,
+     5.714799316e-01f,  5.666720209e-01f,  5.618372757e-01f,  5.569819376e-01f,  5.521122471e-01f,  5.472344304e-01f,  5.423546877e-01f,  5.374791803e-01f,
+     5.326140190e-01f,  5.277652515e-01f,  5.229388510e-01f,  5.181407049e-01f,  5.133766026e-01f,  5.086522255e-01f,  5.039731355e-01f,  4.993447649e-01f,
+     4.947724058e-01f,  4.902612012e-01f,  4.858161344e-01f,  4.814420209e-01f,  4.771434990e-01f,  4.729250222e-01f,  4.687908505e-01f,  4.647450438e-01f,
+     4.607914543e-01f,  4.569337202e-01f,  4.531752598e-01f,  4.495192653e-01f,  4.459686984e-01f,  4.425262852e-01f,  4.391945121e-01f,  4.359756223e-01f,
+     4.328716128e-01f,  4.298842311e-01f,  4.270149740e-01f,  4.242650854e-01f,  4.216355552e-01f,  4.191271191e-01f,  4.167402583e-01f,  4.144751997e-01f,
+     4.123319173e-01f,  4.103101335e-01f,  4.084093208e-01f,  4.066287045e-01f,  4.049672656e-01f,  4.034237439e-01f,  4.019966424e-01f,  4.006842308e-01f,
+     3.994845512e-01f,  3.983954224e-01f,  3.974144462e-01f,  3.965390130e-01f,  3.957663083e-01f,  3.950933195e-01f,  3.945168430e-01f,  3.940334920e-01f,
+     3.936397037e-01f,  3.933317480e-01f,  3.931057359e-01f,  3.929576278e-01f,  3.928832429e-01f,  3.928782681e-01f,  3.929382679e-01f,  3.930586935e-01f,
+     3.932348929e-01f,  3.934621210e-01f,  3.937355495e-01f,  3.940502773e-01f,  3.944013408e-01f,  3.947837242e-01f,  3.951923703e-01f,  3.956221907e-01f,
+     3.960680766e-01f,  3.965249093e-01f,  3.969875703e-01f,  3.974509525e-01f,  3.979099699e-01f,  3.983595684e-01f,  3.987947358e-01f,  3.992105117e-01f,
+     3.996019978e-01f,  3.999643673e-01f,  4.002928749e-01f,  4.005828656e-01f,  4.008297843e-01f,  4.010291848e-01f,  4.011767377e-01f,  4.012682398e-01f,
+     4.012996216e-01f,  4.012669549e-01f,  4.011664609e-01f,  4.009945169e-01f,  4.007476632e-01f,  4.004226096e-01f,  4.000162413e-01f,  3.995256251e-01f,
+     3.989480138e-01f,  3.982808522e-01f,  3.975217806e-01f,  3.966686398e-01f,  3.957194738e-01f,  3.946725341e-01f,  3.935262817e-01f,  3.922793897e-01f,
+     3.909307455e-01f,  3.894794521e-01f,  3.879248289e-01f,  3.862664129e-01f,  3.845039584e-01f,  3.826374369e-01f,  3.806670362e-01f,  3.785931597e-01f,
+     3.764164244e-01f,  3.741376591e-01f,  3.717579017e-01f,  3.692783968e-01f,  3.667005921e-01f,  3.640261347e-01f,  3.612568675e-01f,  3.583948241e-01f,
+     3.554422246e-01f,  3.524014700e-01f,  3.492751369e-01f,  3.460659715e-01f,  3.427768836e-01f,  3.394109400e-01f,  3.359713575e-01f,  3.324614961e-01f,
+     3.288848515e-01f,  3.252450476e-01f,  3.215458285e-01f,  3.177910505e-01f,  3.139846739e-01f,  3.101307543e-01f,  3.062334343e-01f,  3.022969345e-01f,
+     2.983255447e-01f,  2.943236147e-01f,  2.902955454e-01f,  2.862457793e-01f,  2.821787916e-01f,  2.780990805e-01f,  2.740111583e-01f,  2.699195417e-01f,
+     2.658287425e-01f,  2.617432587e-01f,  2.576675648e-01f,  2.536061030e-01f,  2.495632739e-01f,  2.455434278e-01f,  2.415508553e-01f,  2.375897795e-01f,
+     2.336643467e-01f,  2.297786184e-01f,  2.259365630e-01f,  2.221420480e-01f,  2.183988323e-01f,  2.147105583e-01f,  2.110807454e-01f,  2.075127823e-01f,
+     2.040099209e-01f,  2.005752695e-01f,  1.972117871e-01f,  1.939222772e-01f,  1.907093828e-01f,  1.875755812e-01f,  1.845231790e-01f,  1.815543081e-01f,
+     1.786709215e-01f,  1.758747897e-01f,  1.731674973e-01f,  1.705504404e-01f,  1.680248239e-01f,  1.655916597e-01f,  1.632517646e-01f,  1.610057594e-01f,
+     1.588540676e-01f,  1.567969156e-01f,  1.548343320e-01f,  1.529661480e-01f,  1.511919987e-01f,  1.495113234e-01f,  1.479233678e-01f,  1.464271857e-01f,
+     1.450216414e-01f,  1.437054120e-01f,  1.424769910e-01f,  1.413346917e-01f,  1.402766504e-01f,  1.393008316e-01f,  1.384050313e-01f,  1.375868830e-01f,
+     1.368438620e-01f,  1.361732914e-01f,  1.355723476e-01f,  1.350380665e-01f,  1.345673500e-01f,  1.341569722e-01f,  1.338035868e-01f,  1.335037338e-01f,
+     1.332538470e-01f,  1.330502614e-01f,  1.328892211e-01f,  1.327668873e-01f,  1.326793459e-01f,  1.326226161e-01f,  1.325926586e-01f,  1.325853841e-01f,
+     1.325966616e-01f,  1.326223273e-01f,  1.326581931e-01f,  1.327000552e-01f,  1.327437031e-01f,  1.327849278e-01f,  1.328195311e-01f,  1.328433339e-01f,
+     1.328521849e-01f,  1.328419691e-01f,  1.328086165e-01f,  1.327481100e-01f,  1.326564942e-01f,  1.325298830e-01f,  1.323644679e-01f,  1.321565256e-01f,
+     1.319024259e-01f,  1.315986385e-01f,  1.312417409e-01f,  1.308284250e-01f,  1.303555037e-01f,  1.298199177e-01f,  1.292187416e-01f,  1.285491895e-01f,
+     1.278086212e-01f,  1.269945470e-01f,  1.261046330e-01f,  1.251367058e-01f,  1.240887567e-01f,  1.229589457e-01f,  1.217456055e-01f,  1.204472444e-01f,
+     1.190625494e-01f,  1.175903889e-01f,  1.160298147e-01f,  1.143800639e-01f,  1.126405605e-01f,  1.108109162e-01f,  1.088909312e-01f,  1.068805947e-01f,
+     1.047800843e-01f,  1.025897659e-01f,  1.003101929e-01f,  9.794210449e-02f,  9.548642455e-02f,  9.294425927e-02f,  9.031689488e-02f,  8.760579493e-02f,
+     8.481259713e-02f,  8.193910987e-02f,  7.898730844e-02f,  7.595933083e-02f,  7.285747327e-02f,  6.968418536e-02f,  6.644206500e-02f,  6.313385294e-02f,
+     5.976242704e-02f,  5.633079627e-02f,  5.284209448e-02f,  4.929957383e-02f,  4.570659804e-02f,  4.206663541e-02f,  3.838325161e-02f,  3.466010228e-02f,
+     3.090092543e-02f,  2.710953371e-02f,  2.328980648e-02f,  1.944568179e-02f,  1.558114823e-02f,  1.170023662e-02f,  7.807011714e-03f,  3.905563751e-03f,
+     0.000000000e+00f,
+  },
+  { // level 7: 3 harmonics
+     0.000000000e+00f, -3.906102934e-03f, -7.811323549e-03f, -1.171477989e-02f, -1.561559073e-02f, -1.951287594e-02f, -2.340575686e-02f, -2.729335664e-02f,
+    -3.117480063e-02f, -3.504921671e-02f, -3.891573570e-02f, -4.277349166e-02f, -4.662162232e-02f, -5.045926936e-02f, -5.428557884e-02f, -5.809970148e-02f,
+    -6.190079309e-02f, -6.568801486e-02f, -6.946053375e-02f, -7.321752280e-02f, -7.695816152e-02f, -8.068163617e-02f, -8.438714016e-02f, -8.807387436e-02f,
+    -9.174104742e-02f, -9.538787614e-02f, -9.901358574e-02f, -1.026174103e-01f, -1.061985928e-01f, -1.097563859e-01f, -1.132900518e-01f, -1.167988629e-01f,
+    -1.202821017e-01f, -1.237390616e-01f, -1.271690469e-01f, -1.305713729e-01f, -1.339453669e-01f, -1.372903676e-01f, -1.406057259e-01f, -1.438908052e-01f,
+    -1.471449815e-01f, -1.503676436e-01f, -1.535581937e-01f, -1.567160472e-01f, -1.598406333e-01f, -1.629313952e-01f, -1.659877901e-01f, -1.690092897e-01f,
+    -1.719953805e-01f, -1.749455635e-01f, -1.778593552e-01f, -1.807362871e-01f, -1.835759062e-01f, -1.863777755e-01f, -1.891414737e-01f, -1.918665954e-01f,
+    -1.945527519e-01f, -1.971995705e-01f, -1.998066956e-01f, -2.023737880e-01f, -2.049005255e-01f, -2.073866032e-01f, -2.098317333e-01f, -2.122356454e-01f,
+    -2.145980865e-01f, -2.169188213e-01f, -2.191976324e-01f, -2.214343202e-01f, -2.236287028e-01f, -2.257806166e-01f, -2.278899162e-01f, -2.299564743e-01f,
+    -2.319801820e-01f, -2.339609487e-01f, -2.358987022e-01f, -2.377933890e-01f, -2.396449739e-01f, -2.414534404e-01f, -2.432187906e-01f, -2.449410452e-01f,
+    -2.466202437e-01f, -2.482564440e-01f, -2.498497230e-01f, -2.514001759e-01f, -2.529079168e-01f, -2.543730785e-01f, -2.557958121e-01f, -2.571762876e-01f,
+    -2.585146934e-01f, -2.598112362e-01f, -2.610661415e-01f, -2.622796529e-01f, -2.634520324e-01f, -2.645835603e-01f, -2.656745347e-01f, -2.667252722e-01f,
+    -2.677361071e-01f, -2.687073915e-01f, -2.696394953e-01f, -2.705328061e-01f, -2.713877287e-01f, -2.722046857e-01f, -2.729841164e-01f, -2.737264775e-01f,
+    -2.744322424e-01f, -2.751019015e-01f, -2.757359614e-01f, -2.763349454e-01f, -2.768993929e-01f, -2.774298592e-01f, -2.779269157e-01f, -2.783911492e-01f,
+    -2.788231620e-01f, -2.792235716e-01f, -2.795930104e-01f, -2.799321257e-01f, -2.802415791e-01f, -2.805220467e-01f, -2.807742186e-01f, -2.809987985e-01f,
+    -2.811965038e-01f, -2.813680652e-01f, -2.815142261e-01f, -2.816357430e-01f, -2.817333845e-01f, -2.818079316e-01f, -2.818601769e-01f, -2.818909250e-01f,
+    -2.819009913e-01f, -2.818912023e-01f, -2.818623953e-01f, -2.818154178e-01f, -2.817511273e-01f, -2.816703910e-01f, -2.815740856e-01f, -2.814630966e-01f,
+    -2.813383182e-01f, -2.812006532e-01f, -2.810510121e-01f, -2.808903133e-01f, -2.807194822e-01f, -2.805394514e-01f, -2.803511600e-01f, -2.801555533e-01f,
+    -2.799535823e-01f, -2.797462038e-01f, -2.795343794e-01f, -2.793190756e-01f, -2.791012632e-01f, -2.788819169e-01f, -2.786620151e-01f, -2.784425392e-01f,
+    -2.782244738e-01f, -2.780088054e-01f, -2.777965229e-01f, -2.775886167e-01f, -2.773860784e-01f, -2.771899006e-01f, -2.770010761e-01f, -2.768205979e-01f,
+    -2.766494586e-01f, -2.764886501e-01f, -2.763391630e-01f, -2.762019864e-01f, -2.760781074e-01f, -2.759685109e-01f, -2.758741787e-01f, -2.757960897e-01f,
+    -2.757352191e-01f, -2.756925379e-01f, -2.756690132e-01f, -2.756656068e-01f, -2.756832756e-01f, -2.757229707e-01f, -2.757856374e-01f, -2.758722144e-01f,
+    -2.759836337e-01f, -2.761208202e-01f, -2.762846909e-01f, -2.764761552e-01f, -2.766961138e-01f, -2.769454588e-01f, -2.772250731e-01f, -2.775358300e-01f,
+    -2.778785930e-01f, -2.782542151e-01f, -2.786635389e-01f, -2.791073957e-01f, -2.795866055e-01f, -2.801019763e-01f, -2.806543042e-01f, -2.812443726e-01f,
+    -2.818729521e-01f, -2.825408000e-01f, -2.832486600e-01f, -2.839972620e-01f, -2.847873213e-01f, -2.856195389e-01f, -2.864946007e-01f, -2.874131773e-01f,
+    -2.883759237e-01f, -2.893834790e-01f, -2.904364660e-01f, -2.915354909e-01f, -2.926811431e-01f, -2.938739948e-01f, -2.951146008e-01f, -2.964034978e-01f,
+    -2.977412050e-01f, -2.991282228e-01f, -3.005650333e-01f, -3.020520995e-01f, -3.035898654e-01f, -3.051787556e-01f, -3.068191751e-01f, -3.085115088e-01f,
+    -3.102561217e-01f, -3.120533584e-01f, -3.139035429e-01f, -3.158069784e-01f, -3.177639470e-01f, -3.197747098e-01f, -3.218395063e-01f, -3.239585544e-01f,
+    -3.261320504e-01f, -3.283601684e-01f, -3.306430604e-01f, -3.329808564e-01f, -3.353736635e-01f, -3.378215664e-01f, -3.403246273e-01f, -3.428828851e-01f,
+    -3.454963560e-01f, -3.481650330e-01f, -3.508888857e-01f, -3.536678607e-01f, -3.565018809e-01f, -3.593908459e-01f, -3.623346314e-01f, -3.653330899e-01f,
+    -3.683860497e-01f, -3.714933157e-01f, -3.746546687e-01f, -3.778698659e-01f, -3.811386403e-01f, -3.844607011e-01f, -3.878357339e-01f, -3.912633998e-01f,
+    -3.947433363e-01f, -3.982751570e-01f, -4.018584515e-01f, -4.054927854e-01f, -4.091777007e-01f, -4.129127155e-01f, -4.166973241e-01f, -4.205309971e-01f,
+    -4.244131816e-01f, -4.283433010e-01f, -4.323207554e-01f, -4.363449214e-01f, -4.404151524e-01f, -4.445307786e-01f, -4.486911072e-01f, -4.528954225e-01f,
+    -4.571429859e-01f, -4.614330363e-01f, -4.657647900e-01f, -4.701374412e-01f, -4.745501615e-01f, -4.790021009e-01f, -4.834923874e-01f, -4.880201275e-01f,
+    -4.925844061e-01f, -4.971842871e-01f, -5.018188131e-01f, -5.064870062e-01f, -5.111878677e-01f, -5.159203789e-01f, -5.206835007e-01f, -5.254761742e-01f,
+    -5.302973212e-01f, -5.351458438e-01f, -5.400206255e-01f, -5.449205306e-01f, -5.498444052e-01f, -5.547910773e-01f, -5.597593567e-01f, -5.647480358e-01f,
+    -5.697558900e-01f, -5.747816773e-01f, -5.798241394e-01f, -5.848820016e-01f, -5.899539733e-01f, -5.950387483e-01f, -6.001350052e-01f, -6.052414077e-01f,
+    -6.103566050e-01f, -6.154792320e-01f, -6.206079100e-01f, -6.257412468e-01f, -6.308778374e-01f, -6.360162639e-01f, -6.411550963e-01f, -6.462928928e-01f,
+    -6.514282003e-01f, -6.565595544e-01f, -6.616854805e-01f, -6.668044935e-01f, -6.719150987e-01f, -6.770157923e-01f, -6.821050611e-01f, -6.871813841e-01f,
+    -6.922432319e-01f, -6.972890676e-01f, -7.023173473e-01f, -7.073265204e-01f, -7.123150303e-01f, -7.172813142e-01f, -7.222238047e-01f, -7.271409289e-01f,
+    -7.320311102e-01f, -7.368927677e-01f, -7.417243173e-01f, -7.465241720e-01f, -7.512907422e-01f, -7.560224367e-01f, -7.607176624e-01f, -7.653748256e-01f,
+    -7.699923318e-01f, -7.745685867e-01f, -7.791019964e-01f, -7.835909679e-01f, -7.880339097e-01f, -7.924292323e-01f, -7.967753486e-01f, -8.010706744e-01f,
+    -8.053136290e-01f, -8.095026356e-01f, -8.136361217e-01f, -8.177125199e-01f, -8.217302680e-01f, -8.256878098e-01f, -8.295835954e-01f, -8.334160819e-01f,
+    -8.371837336e-01f, -8.408850228e-01f, -8.445184300e-01f, -8.480824447e-01f, -8.515755655e-01f, -8.549963008e-01f, -8.583431695e-01f, -8.616147011e-01f,
+    -8.648094363e-01f, -8.679259275e-01f, -8.709627393e-01f, -8.739184490e-01f, -8.767916468e-01f, -8.795809369e-01f, -8.822849371e-01f, -8.849022798e-01f,
+    -8.874316125e-01f, -8.898715979e-01f, -8.922209147e-01f, -8.944782578e-01f, -8.966423388e-01f, -8.987118865e-01f, -9.006856473e-01f, -9.025623856e-01f,
+    -9.043408843e-01f, -9.060199449e-01f, -9.075983884e-01f, -9.090750555e-01f, -9.104488068e-01f, -9.117185235e-01f, -9.128831075e-01f, -9.139414822e-01f,
+    -9.148925924e-01f, -9.157354049e-01f, -9.164689091e-01f, -9.170921169e-01f, -9.176040633e-01f, -9.180038068e-01f, -9.182904297e-01f, -9.184630384e-01f,
+    -9.185207636e-01f, -9.184627611e-01f, -9.182882113e-01f, -9.179963205e-01f, -9.175863204e-01f, -9.170574688e-01f, -9.164090496e-01f, -9.156403735e-01f,
+    -9.147507780e-01f, -9.137396275e-01f, -9.126063140e-01f, -9.113502569e-01f, -9.099709037e-01f, -9.084677297e-01f, -9.068402388e-01f, -9.050879632e-01f,
+    -9.032104640e-01f, -9.012073311e-01f, -8.990781837e-01f, -8.968226701e-01f, -8.944404685e-01f, -8.919312863e-01f, -8.892948610e-01f, -8.865309601e-01f,
+    -8.836393811e-01f, -8.806199519e-01f, -8.774725306e-01f, -8.741970059e-01f, -8.707932972e-01f, -8.672613544e-01f, -8.636011585e-01f, -8.598127211e-01f,
+    -8.558960848e-01f, -8.518513233e-01f, -8.476785413e-01f, -8.433778747e-01f, -8.389494905e-01f, -8.343935867e-01f, -8.297103928e-01f, -8.249001693e-01f,
+    -8.199632079e-01f, -8.148998316e-01f, -8.097103944e-01f, -8.043952815e-01f, -7.989549093e-01f, -7.933897251e-01f, -7.877002074e-01f, -7.818868653e-01f,
+    -7.759502390e-01f, -7.698908995e-01f, -7.637094482e-01f, -7.574065174e-01f, -7.509827697e-01f, -7.444388980e-01f, -7.377756255e-01f, -7.309937054e-01f,
+    -7.240939209e-01f, -7.170770848e-01f, -7.099440397e-01f, -7.026956576e-01f, -6.953328395e-01f, -6.878565158e-01f, -6.802676455e-01f, -6.725672164e-01f,
+    -6.647562445e-01f, -6.568357743e-01f, -6.488068780e-01f, -6.406706555e-01f, -6.324282345e-01f, -6.240807695e-01f, -6.156294422e-01f, -6.070754608e-01f,
+    -5.984200600e-01f, -5.896645005e-01f, -5.808100688e-01f, -5.718580769e-01f, -5.628098619e-01f, -5.536667857e-01f, -5.444302349e-01f, -5.351016201e-01f,
+    -5.256823757e-01f, -5.161739597e-01f, -5.065778531e-01f, -4.968955596e-01f, -4.871286053e-01f, -4.772785384e-01f, -4.673469286e-01f, -4.573353669e-01f,
+    -4.472454648e-01f, -4.370788545e-01f, -4.268371882e-01f, -4.165221375e-01f, -4.061353931e-01f, -3.956786647e-01f, -3.851536799e-01f, -3.745621845e-01f,
+    -3.639059413e-01f, -3.531867303e-01f, -3.424063480e-01f, -3.315666068e-01f, -3.206693346e-01f, -3.097163744e-01f, -2.987095839e-01f, -2.876508348e-01f,
+    -2.765420126e-01f, -2.653850156e-01f, -2.541817551e-01f, -2.429341544e-01f, -2.316441483e-01f, -2.203136831e-01f, -2.089447154e-01f, -1.975392120e-01f,
+    -1.860991495e-01f, -1.746265133e-01f, -1.631232975e-01f, -1.515915044e-01f, -1.400331436e-01f, -1.284502317e-01f, -1.168447919e-01f, -1.052188532e-01f,
+    -9.357445019e-02f, -8.191362210e-02f, -7.023841260e-02f, -5.855086913e-02f, -4.685304239e-02f, -3.514698578e-02f, -2.343475486e-02f, -1.171840684e-02f,
+    -1.039512489e-16f,  1.171840684e-02f,  2.343475486e-02f,  3.514698578e-02f,  4.685304239e-02f,  5.855086913e-02f,  7.023841260e-02f,  8.191362210e-02f,
+     9.357445019e-02f,  1.052188532e-01f,  1.168447919e-01f,  1.284502317e-01f,  1.400331436e-01f,  1.515915044e-01f,  1.631232975e-01f,  1.746265133e-01f,
+     1.860991495e-01f,  1.975392120e-01f,  2.089447154e-01f,  2.203136831e-01f,  2.316441483e-01f,  2.429341544e-01f,  2.541817551e-01f,  2.653850156e-01f,
+     2.765420126e-01f,  2.876508348e-01f,  2.987095839e-01f,  3.097163744e-01f,  3.206693346e-01f,  3.315666068e-01f,  3.424063480e-01f,  3.531867303e-01f,
+     3.639059413e-01f,  3.745621845e-01f,  3.851536799e-01f,  3.956786647e-01f,  4.061353931e-01f,  4.165221375e-01f,  4.268371882e-01f,  4.370788545e-01f,
+     4.472454648e-01f,  4.573353669e-01f,  4.673469286e-01f,  4.772785384e-01f,  4.871286053e-01f,  4.968955596e-01f,  5.065778531e-01f,  5.161739597e-01f,
+     5.256823757e-01f,  5.351016201e-01f,  5.444302349e-01f,  5.536667857e-01f,  5.628098619e-01f,  5.718580769e-01f,  5.808100688e-01f,  5.896645005e-01f,
+     5.984200600e-01f,  6.070754608e-01f,  6.156294422e-01f,  6.240807695e-01f,  6.324282345e-01f,  6.406706555e-01f,  6.488068780e-01f,  6.568357743e-01f,
+     6.647562445e-01f,  6.725672164e-01f,  6.802676455e-01f,  6.878565158e-01f,  6.953328395e-01f,  7.026956576e-01f,  7.099440397e-01f,  7.170770848e-01f,
+     7.240939209e-01f,  7.309937054e-01f,  7.377756255e-01f,  7.444388980e-01f,  7.509827697e-01f,  7.574065174e-01f,  7.637094482e-01f,  7.698908995e-01f,
+     7.759502390e-01f,  7.818868653e-01f,  7.877002074e-01f,  7.933897251e-01f,  7.989549093e-01f,  8.043952815e-01f,  8.097103944e-01f,  8.148998316e-01f,
+     8.199632079e-01f,  8.249001693e-01f,  8.297103928e-01f,  8.343935867e-01f,  8.389494905e-01f,  8.433778747e-01f,  8.476785413e-01f,  8.518513233e-01f,
+     8.558960848e-01f,  8.598127211e-01f,  8.636011585e-01f,  8.672613544e-01f,  8.707932972e-01f,  8.741970059e-01f,  8.774725306e-01f,  8.806199519e-01f,
+     8.836393811e-01f,  8.865309601e-01f,  8.892948610e-01f,  8.919312863e-01f,  8.944404685e-01f,  8.968226701e-01f,  8.990781837e-01f,  9.012073311e-01f,
+     9.032104640e-01f,  9.050879632e-01f,  9.068402388e-01f,  9.084677297e-01f,  9.099709037e-01f,  9.113502569e-01f,  9.126063140e-01f,  9.137396275e-01f,
+     9.147507780e-01f,  9.156403735e-01f,  9.164090496e-01f,  9.170574688e-01f,  9.175863204e-01f,  9.179963205e-01f,  9.182882113e-01f,  9.184627611e-01f,
+     9.185207636e-01f,  9.184630384e-01f,  9.182904297e-01f,  9.180038068e-01f,  9.176040633e-01f,  9.170921169e-01f,  9.164689091e-01f,  9.157354049e-01f,
+     9.148925924e-01f,  9.139414822e-01f,  9.128831075e-01f,  9.117185235e-01f,  9.104488068e-01f,  9.090750555e-01f,  9.075983884e-01f,  9.060199449e-01f,
+     9.043408843e-01f,  9.025623856e-01f,  9.006856473e-01f,  8.987118865e-01f,  8.966423388e-01f,  8.944782578e-01f,  8.922209147e-01f,  8.898715979e-01f,
+     8.874316125e-01f,  8.849022798e-01f,  8.822849371e-01f,  8.795809369e-01f,  8.767916468e-01f,  8.739184490e-01f,  8.709627393e-01f,  8.679259275e-01f,
+     8.648094363e-01f,  8.616147011e-01f,  8.583431695e-01f,  8.549963008e-01f,  8.515755655e-01f,  8.480824447e-01f,  8.445184300e-01f,  8.408850228e-01f,
+     8.371837336e-01f,  8.334160819e-01f,  8.295835954e-01f,  8.256878098e-01f,  8.217302680e-01f,  8.177125199e-01f,  8.136361217e-01f,  8.095026356e-01f,
+     8.053136290e-01f,  8.010706744e-01f,  7.967753486e-01f,  7.924292323e-01f,  7.880339097e-01f,  7.835909679e-01f,  7.791019964e-01f,  7.745685867e-01f,
+     7.699923318e-01f,  7.653748256e-01f,  7.607176624e-01f,  7.560224367e-01f,  7.512907422e-01f,  7.465241720e-01f,  7.417243173e-01f,  7.368927677e-01f,
+     7.320311102e-01f,  7.271409289e-01f,  7.222238047e-01f,  7.172813142e-01f,  7.123150303e-01f,  7.073265204e-01f,  7.023173473e-01f,  6.972890676e-01f,
+     6.922432319e-01f,  6.871813841e-01f,  6.821050611e-01f,  6.770157923e-01f,  6.719150987e-01f,  6.668044935e-01f,  6.616854805e-01f,  6.565595544e-01f,
+     6.514282003e-01f,  6.462928928e-01f,  6.411550963e-01f,  6.360162639e-01f,  6.308778374e-01f,  6.257412468e-01f,  6.206079100e-01f,  6.154792320e-01f,
+     6.103566050e-01f,  6.052414077e-01f,  6.001350052e-01f,  5.950387483e-01f,  5.899539733e-01f,  5.848820016e-01f,  5.798241394e-01f,  5.747816773e-01f,
+     5.697558900e-01f,  5.647480358e-01f,  5.597593567e-01f,  5.547910773e-01f,  5.498444052e-01f,  5.449205306e-01f,  5.400206255e-01f,  5.351458438e-01f,
+     5.302973212e-01f,  5.254761742e-01f,  5.206835007e-01f,  5.159203789e-01f,  5.111878677e-01f,  5.064870062e-01f,  5.018188131e-01f,  4.971842871e-01f,
+     4.925844061e-01f,  4.880201275e-01f,  4.834923874e-01f,  4.790021009e-01f,  4.745501615e-01f,  4.701374412e-01f,  4.657647900e-01f,  4.614330363e-01f,
+     4.571429859e-01f,  4.528954225e-01f,  4.486911072e-01f,  4.445307786e-01f,  4.404151524e-01f,  4.363449214e-01f,  4.323207554e-01f,  4.283433010e-01f,
+     4.244131816e-01f,  4.205309971e-01f,  4.166973241e-01f,  4.129127155e-01f,  4.091777007e-01f,  4.054927854e-01f,  4.018584515e-01f,  3.982751570e-01f,
+     3.947433363e-01f,  3.912633998e-01f,  3.878357339e-01f,  3.844607011e-01f,  3.811386403e-01f,  3.778698659e-01f,  3.746546687e-01f,  3.714933157e-01f,
+     3.683860497e-01f,  3.653330899e-01f,  3.623346314e-01f,  3.593908459e-01f,  3.565018809e-01f,  3.536678607e-01f,  3.508888857e-01f,  3.481650330e-01f,
+     3.454963560e-01f,  3.428828851e-01f,  3.403246273e-01f,  3.378215664e-01f,  3.353736635e-01f,  3.329808564e-01f,  3.306430604e-01f,  3.283601684e-01f,
+     3.261320504e-01f,  3.239585544e-01f,  3.218395063e-01f,  3.197747098e-01f,  3.177639470e-01f,  3.158069784e-01f,  3.139035429e-01f,  3.120533584e-01f,
+     3.102561217e-01f,  3.085115088e-01f,  3.068191751e-01f,  3.051787556e-01f,  3.035898654e-01f,  3.020520995e-01f,  3.005650333e-01f,  2.991282228e-01f,
+     2.977412050e-01f,  2.964034978e-01f,  2.951146008e-01f,  2.938739948e-01f,  2.926811431e-01f,  2.915354909e-01f,  2.904364660e-01f,  2.893834790e-01f,
+     2.883759237e-01f,  2.874131773e-01f,  2.864946007e-01f,  2.856195389e-01f,  2.847873213e-01f,  2.839972620e-01f,  2.832486600e-01f,  2.825408000e-01f,
+     2.818729521e-01f,  2.812443726e-01f,  2.806543042e-01f,  2.801019763e-01f,  2.795866055e-01f,  2.791073957e-01f,  2.786635389e-01f,  2.782542151e-01f,
+     2.778785930e-01f,  2.775358300e-01f,  2.772250731e-01f,  2.769454588e-01f,  2.766961138e-01f,  2.764761552e-01f,  2.762846909e-01f,  2.761208202e-01f,
+     2.759836337e-01f,  2.758722144e-01f,  2.757856374e-01f,  2.757229707e-01f,  2.756832756e-01f,  2.756656068e-01f,  2.756690132e-01f,  2.756925379e-01f,
+     2.757352191e-01f,  2.757960897e-01f,  2.758741787e-01f,  2.759685109e-01f,  2.760781074e-01f,  2.762019864e-01f,  2.763391630e-01f,  2.764886501e-01f,
+     2.766494586e-01f,  2.768205979e-01f,  2.770010761e-01f,  2.771899006e-01f,  2.773860784e-01f,  2.775886167e-01f,  2.777965229e-01f,  2.780088054e-01f,
+     2.782244738e-01f,  2.784425392e-01f,  2.786620151e-01f,  2.788819169e-01f,  2.791012632e-01f,  2.793190756e-01f,  2.795343794e-01f,  2.797462038e-01f,
+     2.799535823e-01f,  2.801555533e-01f,  2.803511600e-01f,  2.805394514e-01f,  2.807194822e-01f,  2.808903133e-01f,  2.810510121e-01f,  2.812006532e-01f,
+     2.813383182e-01f,  2.814630966e-01f,  2.815740856e-01f,  2.816703910e-01f,  2.817511273e-01f,  2.818154178e-01f,  2.818623953e-01f,  2.818912023e-01f,
+     2.819009913e-01f,  2.818909250e-01f,  2.818601769e-01f,  2.818079316e-01f,  2.817333845e-01f,  2.816357430e-01f,  2.815142261e-01f,  2.813680652e-01f,
+     2.811965038e-01f,  2.809987985e-01f,  2.807742186e-01f,  2.805220467e-01f,  2.802415791e-01f,  2.799321257e-01f,  2.795930104e-01f,  2.792235716e-01f,
+     2.788231620e-01f,  2.783911492e-01f,  2.779269157e-01f,  2.774298592e-01f,  2.768993929e-01f,  2.763349454e-01f,  2.757359614e-01f,  2.751019015e-01f,
+     2.744322424e-01f,  2.737264775e-01f,  2.729841164e-01f,  2.722046857e-01f,  2.713877287e-01f,  2.705328061e-01f,  2.696394953e-01f,  2.687073915e-01f,
+     2.677361071e-01f,  2.667252722e-01f,  2.656745347e-01f,  2.645835603e-01f,  2.634520324e-01f,  2.622796529e-01f,  2.610661415e-01f,  2.598112362e-01f,
+     2.585146934e-01f,  2.571762876e-01f,  2.557958121e-01f,  2.543730785e-01f,  2.529079168e-01f,  2.514001759e-01f,  2.498497230e-01f,  2.482564440e-01f,
+     2.466202437e-01f,  2.449410452e-01f,  2.432187906e-01f,  2.414534404e-01f,  2.396449739e-01f,  2.377933890e-01f,  2.358987022e-01f,  2.339609487e-01f,
+     2.319801820e-01f,  2.299564743e-01f,  2.278899162e-01f,  2.257806166e-01f,  2.236287028e-01f,  2.214343202e-01f,  2.191976324e-01f,  2.169188213e-01f,
+     2.145980865e-01f,  2.122356454e-01f,  2.098317333e-01f,  2.073866032e-01f,  2.049005255e-01f,  2.023737880e-01f,  1.998066956e-01f,  1.971995705e-01f,
+     1.945527519e-01f,  1.918665954e-01f,  1.891414737e-01f,  1.863777755e-01f,  1.835759062e-01f,  1.807362871e-01f,  1.778593552e-01f,  1.749455635e-01f,
+     1.719953805e-01f,  1.690092897e-01f,  1.659877901e-01f,  1.629313952e-01f,  1.598406333e-01f,  1.567160472e-01f,  1.535581937e-01f,  1.503676436e-01f,
+     1.471449815e-01f,  1.438908052e-01f,  1.406057259e-01f,  1.372903676e-01f,  1.339453669e-01f,  1.305713729e-01f,  1.271690469e-01f,  1.237390616e-01f,
+     1.202821017e-01f,  1.167988629e-01f,  1.132900518e-01f,  1.097563859e-01f,  1.061985928e-01f,  1.026174103e-01f,  9.901358574e-02f,  9.538787614e-02f,
+     9.174104742e-02f,  8.807387436e-02f,  8.438714016e-02f,  8.068163617e-02f,  7.695816152e-02f,  7.321752280e-02f,  6.946053375e-02f,  6.568801486e-02f,
+     6.190079309e-02f,  5.809970148e-02f,  5.428557884e-02f,  5.045926936e-02f,  4.662162232e-02f,  4.277349166e-02f,  3.891573570e-02f,  3.504921671e-02f,
+     3.117480063e-02f,  2.729335664e-02f,  2.340575686e-02f,  1.951287594e-02f,  1.561559073e-02f,  1.171477989e-02f,  7.811323549e-03f,  3.906102934e-03f,
+     0.000000000e+00f,
+  },
+  { // level 8: 1 harmonics
+     0.000000000e+00f, -3.906225489e-03f, -7.812303910e-03f, -1.171808820e-02f, -1.562343132e-02f, -1.952818622e-02f, -2.343220589e-02f, -2.733534336e-02f,
+    -3.123745166e-02f, -3.513838389e-02f, -3.903799319e-02f, -4.293613272e-02f, -4.683265573e-02f, -5.072741552e-02f, -5.462026545e-02f, -5.851105896e-02f,
+    -6.239964956e-02f, -6.628589085e-02f, -7.016963652e-02f, -7.405074033e-02f, -7.792905618e-02f, -8.180443804e-02f, -8.567674001e-02f, -8.954581631e-02f,
+    -9.341152125e-02f, -9.727370930e-02f, -1.011322350e-01f, -1.049869532e-01f, -1.088377187e-01f, -1.126843865e-01f, -1.165268118e-01f, -1.203648499e-01f,
+    -1.241983564e-01f, -1.280271869e-01f, -1.318511972e-01f, -1.356702434e-01f, -1.394841816e-01f, -1.432928684e-01f, -1.470961603e-01f, -1.508939141e-01f,
+    -1.546859868e-01f, -1.584722357e-01f, -1.622525182e-01f, -1.660266920e-01f, -1.697946150e-01f, -1.735561452e-01f, -1.773111413e-01f, -1.810594616e-01f,
+    -1.848009652e-01f, -1.885355111e-01f, -1.922629587e-01f, -1.959831678e-01f, -1.996959982e-01f, -2.034013101e-01f, -2.070989641e-01f, -2.107888210e-01f,
+    -2.144707418e-01f, -2.181445879e-01f, -2.218102209e-01f, -2.254675029e-01f, -2.291162962e-01f, -2.327564634e-01f, -2.363878675e-01f, -2.400103717e-01f,
+    -2.436238396e-01f, -2.472281352e-01f, -2.508231229e-01f, -2.544086671e-01f, -2.579846331e-01f, -2.615508860e-01f, -2.651072918e-01f, -2.686537163e-01f,
+    -2.721900263e-01f, -2.757160884e-01f, -2.792317699e-01f, -2.827369386e-01f, -2.862314623e-01f, -2.897152096e-01f, -2.931880493e-01f, -2.966498507e-01f,
+    -3.001004833e-01f, -3.035398173e-01f, -3.069677232e-01f, -3.103840720e-01f, -3.137887349e-01f, -3.171815839e-01f, -3.205624912e-01f, -3.239313295e-01f,
+    -3.272879720e-01f, -3.306322922e-01f, -3.339641644e-01f, -3.372834629e-01f, -3.405900630e-01f, -3.438838400e-01f, -3.471646700e-01f, -3.504324294e-01f,
+    -3.536869953e-01f, -3.569282450e-01f, -3.601560566e-01f, -3.633703085e-01f, -3.665708797e-01f, -3.697576498e-01f, -3.729304987e-01f, -3.760893069e-01f,
+    -3.792339556e-01f, -3.823643264e-01f, -3.854803013e-01f, -3.885817632e-01f, -3.916685951e-01f, -3.947406810e-01f, -3.977979051e-01f, -4.008401523e-01f,
+    -4.038673082e-01f, -4.068792586e-01f, -4.098758903e-01f, -4.128570904e-01f, -4.158227466e-01f, -4.187727473e-01f, -4.217069815e-01f, -4.246253387e-01f,
+    -4.275277090e-01f, -4.304139830e-01f, -4.332840523e-01f, -4.361378086e-01f, -4.389751446e-01f, -4.417959535e-01f, -4.446001289e-01f, -4.473875654e-01f,
+    -4.501581581e-01f, -4.529118025e-01f, -4.556483951e-01f, -4.583678327e-01f, -4.610700131e-01f, -4.637548344e-01f, -4.664221957e-01f, -4.690719964e-01f,
+    -4.717041368e-01f, -4.743185178e-01f, -4.769150410e-01f, -4.794936086e-01f, -4.820541235e-01f, -4.845964894e-01f, -4.871206105e-01f, -4.896263917e-01f,
+    -4.921137389e-01f, -4.945825582e-01f, -4.970327567e-01f, -4.994642423e-01f, -5.018769233e-01f, -5.042707089e-01f, -5.066455091e-01f, -5.090012343e-01f,
+    -5.113377959e-01f, -5.136551059e-01f, -5.159530771e-01f, -5.182316229e-01f, -5.204906576e-01f, -5.227300962e-01f, -5.249498542e-01f, -5.271498482e-01f,
+    -5.293299953e-01f, -5.314902134e-01f, -5.336304212e-01f, -5.357505382e-01f, -5.378504844e-01f, -5.399301808e-01f, -5.419895492e-01f, -5.440285120e-01f,
+    -5.460469925e-01f, -5.480449145e-01f, -5.500222030e-01f, -5.519787835e-01f, -5.539145822e-01f, -5.558295264e-01f, -5.577235439e-01f, -5.595965635e-01f,
+    -5.614485146e-01f, -5.632793274e-01f, -5.650889331e-01f, -5.668772635e-01f, -5.686442513e-01f, -5.703898300e-01f, -5.721139338e-01f, -5.738164978e-01f,
+    -5.754974580e-01f, -5.771567510e-01f, -5.787943144e-01f, -5.804100866e-01f, -5.820040066e-01f, -5.835760145e-01f, -5.851260510e-01f, -5.866540580e-01f,
+    -5.881599777e-01f, -5.896437535e-01f, -5.911053296e-01f, -5.925446509e-01f, -5.939616632e-01f, -5.953563132e-01f, -5.967285484e-01f, -5.980783171e-01f,
+    -5.994055685e-01f, -6.007102525e-01f, -6.019923202e-01f, -6.032517233e-01f, -6.044884142e-01f, -6.057023465e-01f, -6.068934744e-01f, -6.080617531e-01f,
+    -6.092071387e-01f, -6.103295880e-01f, -6.114290586e-01f, -6.125055094e-01f, -6.135588996e-01f, -6.145891897e-01f, -6.155963409e-01f, -6.165803152e-01f,
+    -6.175410756e-01f, -6.184785859e-01f, -6.193928109e-01f, -6.202837161e-01f, -6.211512679e-01f, -6.219954338e-01f, -6.228161819e-01f, -6.236134812e-01f,
+    -6.243873020e-01f, -6.251376148e-01f, -6.258643916e-01f, -6.265676050e-01f, -6.272472284e-01f, -6.279032364e-01f, -6.285356041e-01f, -6.291443078e-01f,
+    -6.297293246e-01f, -6.302906324e-01f, -6.308282102e-01f, -6.313420376e-01f, -6.318320954e-01f, -6.322983650e-01f, -6.327408290e-01f, -6.331594706e-01f,
+    -6.335542742e-01f, -6.339252247e-01f, -6.342723084e-01f, -6.345955120e-01f, -6.348948235e-01f, -6.351702316e-01f, -6.354217258e-01f, -6.356492968e-01f,
+    -6.358529360e-01f, -6.360326356e-01f, -6.361883890e-01f, -6.363201902e-01f, -6.364280344e-01f, -6.365119174e-01f, -6.365718361e-01f, -6.366077882e-01f,
+    -6.366197724e-01f, -6.366077882e-01f, -6.365718361e-01f, -6.365119174e-01f, -6.364280344e-01f, -6.363201902e-01f, -6.361883890e-01f, -6.360326356e-01f,
+    -6.358529360e-01f, -6.356492968e-01f, -6.354217258e-01f, -6.351702316e-01f, -6.348948235e-01f, -6.345955120e-01f, -6.342723084e-01f, -6.339252247e-01f,
+    -6.335542742e-01f, -6.331594706e-01f, -6.327408290e-01f, -6.322983650e-01f, -6.318320954e-01f, -6.313420376e-01f, -6.308282102e-01f, -6.302906324e-01f,
+    -6.297293246e-01f, -6.291443078e-01f, -6.285356041e-01f, -6.279032364e-01f, -6.272472284e-01f, -6.265676050e-01f, -6.258643916e-01f, -6.251376148e-01f,
+    -6.243873020e-01f, -6.236134812e-01f, -6.228161819e-01f, -6.219954338e-01f, -6.211512679e-01f, -6.202837161e-01f, -6.193928109e-01f, -6.184785859e-01f,
+    -6.175410756e-01f, -6.165803152e-01f, -6.155963409e-01f, -6.145891897e-01f, -6.135588996e-01f, -6.125055094e-01f, -6.114290586e-01f, -6.103295880e-01f,
+    -6.092071387e-01f, -6.080617531e-01f, -6.068934744e-01f, -6.057023465e-01f, -6.044884142e-01f, -6.032517233e-01f, -6.019923202e-01f, -6.007102525e-01f,
+    -5.994055685e-01f, -5.980783171e-01f, -5.967285484e-01f, -5.953563132e-01f, -5.939616632e-01f, -5.925446509e-01f, -5.911053296e-01f, -5.896437535e-01f,
+    -5.881599777e-01f, -5.866540580e-01f, -5.851260510e-01f, -5.835760145e-01f, -5.820040066e-01f, -5.804100866e-01f, -5.787943144e-01f, -5.771567510e-01f,
+    -5.754974580e-01f, -5.738164978e-01f, -5.721139338e-01f, -5.703898300e-01f, -5.686442513e-01f, -5.668772635e-01f, -5.650889331e-01f, -5.632793274e-01f,
+    -5.614485146e-01f, -5.595965635e-01f, -5.577235439e-01f, -5.558295264e-01f, -5.539145822e-01f, -5.519787835e-01f, -5.500222030e-01f, -5.480449145e-01f,
+    -5.460469925e-01f, -5.440285120e-01f, -5.419895492e-01f, -5.399301808e-01f, -5.378504844e-01f, -5.357505382e-01f, -5.336304212e-01f, -5.314902134e-01f,
+    -5.293299953e-01f, -5.271498482e-01f, -5.249498542e-01f, -5.227300962e-01f, -5.204906576e-01f, -5.182316229e-01f, -5.159530771e-01f, -5.136551059e-01f,
+    -5.113377959e-01f, -5.090012343e-01f, -5.066455091e-01f, -5.042707089e-01f, -5.018769233e-01f, -4.994642423e-01f, -4.970327567e-01f, -4.945825582e-01f,
+    -4.921137389e-01f, -4.896263917e-01f, -4.871206105e-01f, -4.845964894e-01f, -4.820541235e-01f, -4.794936086e-01f, -4.769150410e-01f, -4.743185178e-01f,
+    -4.717041368e-01f, -4.690719964e-01f, -4.664221957e-01f, -4.637548344e-01f, -4.610700131e-01f, -4.583678327e-01f, -4.556483951e-01f, -4.529118025e-01f,
+    -4.501581581e-01f, -4.473875654e-01f, -4.446001289e-01f, -4.417959535e-01f, -4.389751446e-01f, -4.361378086e-01f, -4.332840523e-01f, -4.304139830e-01f,
+    -4.275277090e-01f, -4.246253387e-01f, -4.217069815e-01f, -4.187727473e-01f, -4.158227466e-01f, -4.128570904e-01f, -4.098758903e-01f, -4.068792586e-01f,
+    -4.038673082e-01f, -4.008401523e-01f, -3.977979051e-01f, -3.947406810e-01f, -3.916685951e-01f, -3.885817632e-01f, -3.854803013e-01f, -3.823643264e-01f,
+    -3.792339556e-01f, -3.760893069e-01f, -3.729304987e-01f, -3.697576498e-01f, -3.665708797e-01f, -3.633703085e-01f, -3.601560566e-01f, -3.569282450e-01f,
+    -3.536869953e-01f, -3.504324294e-01f, -3.471646700e-01f, -3.438838400e-01f, -3.405900630e-01f, -3.372834629e-01f, -3.339641644e-01f, -3.306322922e-01f,
+    -3.272879720e-01f, -3.239313295e-01f, -3.205624912e-01f, -3.171815839e-01f, -3.137887349e-01f, -3.103840720e-01f, -3.069677232e-01f, -3.035398173e-01f,
+    -3.001004833e-01f, -2.966498507e-01f, -2.931880493e-01f, -2.897152096e-01f, -2.862314623e-01f, -2.827369386e-01f, -2.792317699e-01f, -2.757160884e-01f,
+    -2.721900263e-01f, -2.686537163e-01f, -2.651072918e-01f, -2.615508860e-01f, -2.579846331e-01f, -2.544086671e-01f, -2.508231229e-01f, -2.472281352e-01f,
+    -2.436238396e-01f, -2.400103717e-01f, -2.363878675e-01f, -2.327564634e-01f, -2.291162962e-01f, -2.254675029e-01f, -2.218102209e-01f, -2.181445879e-01f,
+    -2.144707418e-01f, -2.107888210e-01f, -2.070989641e-01f, -2.034013101e-01f, -1.996959982e-01f, -1.959831678e-01f, -1.922629587e-01f, -1.885355111e-01f,
+    -1.848009652e-01f, -1.810594616e-01f, -1.773111413e-01f, -1.735561452e-01f, -1.697946150e-01f, -1.660266920e-01f, -1.622525182e-01f, -1.584722357e-01f,
+    -1.546859868e-01f, -1.508939141e-01f, -1.470961603e-01f, -1.432928684e-01f, -1.394841816e-01f, -1.356702434e-01f, -1.318511972e-01f, -1.280271869e-01f,
+    -1.241983564e-01f, -1.203648499e-01f, -1.165268118e-01f, -1.126843865e-01f, -1.088377187e-01f, -1.049869532e-01f, -1.011322350e-01f, -9.727370930e-02f,
+    -9.341152125e-02f, -8.954581631e-02f, -8.567674001e-02f, -8.180443804e-02f, -7.792905618e-02f, -7.405074033e-02f, -7.016963652e-02f, -6.628589085e-02f,
+    -6.239964956e-02f, -5.851105896e-02f, -5.462026545e-02f, -5.072741552e-02f, -4.683265573e-02f, -4.293613272e-02f, -3.903799319e-02f, -3.513838389e-02f,
+    -3.123745166e-02f, -2.733534336e-02f, -2.343220589e-02f, -1.952818622e-02f, -1.562343132e-02f, -1.171808820e-02f, -7.812303910e-03f, -3.906225489e-03f,
+    -7.796343665e-17f,  3.906225489e-03f,  7.812303910e-03f,  1.171808820e-02f,  1.562343132e-02f,  1.952818622e-02f,  2.343220589e-02f,  2.733534336e-02f,
+     3.123745166e-02f,  3.513838389e-02f,  3.903799319e-02f,  4.293613272e-02f,  4.683265573e-02f,  5.072741552e-02f,  5.462026545e-02f,  5.851105896e-02f,
+     6.239964956e-02f,  6.628589085e-02f,  7.016963652e-02f,  7.405074033e-02f,  7.792905618e-02f,  8.180443804e-02f,  8.567674001e-02f,  8.954581631e-02f,
+     9.341152125e-02f,  9.727370930e-02f,  1.011322350e-01f,  1.049869532e-01f,  1.088377187e-01f,  1.126843865e-01f,  1.165268118e-01f,  1.203648499e-01f,
+     1.241983564e-01f,  1.280271869e-01f,  1.318511972e-01f,  1.356702434e-01f,  1.394841816e-01f,  1.432928684e-01f,  1.470961603e-01f,  1.508939141e-01f,
+     1.546859868e-01f,  1.584722357e-01f,  1.622525182e-01f,  1.660266920e-01f,  1.697946150e-01f,  1.735561452e-01f,  1.773111413e-01f,  1.810594616e-01f,
+     1.848009652e-01f,  1.885355111e-01f,  1.922629587e-01f,  1.959831678e-01f,  1.996959982e-01f,  2.034013101e-01f,  2.070989641e-01f,  2.107888210e-01f,
+     2.144707418e-01f,  2.181445879e-01f,  2.218102209e-01f,  2.254675029e-01f,  2.291162962e-01f,  2.327564634e-01f,  2.363878675e-01f,  2.400103717e-01f,
+     2.436238396e-01f,  2.472281352e-01f,  2.508231229e-01f,  2.544086671e-01f,  2.579846331e-01f,  2.615508860e-01f,  2.651072918e-01f,  2.686537163e-01f,
+     2.721900263e-01f,  2.757160884e-01f,  2.792317699e-01f,  2.827369386e-01f,  2.862314623e-01f,  2.897152096e-01f,  2.931880493e-01f,  2.966498507e-01f,
+     3.001004833e-01f,  3.035398173e-01f,  3.069677232e-01f,  3.103840720e-01f,  3.137887349e-01f,  3.171815839e-01f,  3.205624912e-01f,  3.239313295e-01f,
+     3.272879720e-01f,  3.306322922e-01f,  3.339641644e-01f,  3.372834629e-01f,  3.405900630e-01f,  3.438838400e-01f,  3.471646700e-01f,  3.504324294e-01f,
+     3.536869953e-01f,  3.569282450e-01f,  3.601560566e-01f,  3.633703085e-01f,  3.665708797e-01f,  3.697576498e-01f,  3.729304987e-01f,  3.760893069e-01f,
+     3.792339556e-01f,  3.823643264e-01f,  3.854803013e-01f,  3.885817632e-01f,  3.916685951e-01f,  3.947406810e-01f,  3.977979051e-01f,  4.008401523e-01f,
+     4.038673082e-01f,  4.068792586e-01f,  4.098758903e-01f,  4.128570904e-01f,  4.158227466e-01f,  4.187727473e-01f,  4.217069815e-01f,  4.246253387e-01f,
+     4.275277090e-01f,  4.304139830e-01f,  4.332840523e-01f,  4.361378086e-01f,  4.389751446e-01f,  4.417959535e-01f,  4.446001289e-01f,  4.473875654e-01f,
+     4.501581581e-01f,  4.529118025e-01f,  4.556483951e-01f,  4.583678327e-01f,  4.610700131e-01f,  4.637548344e-01f,  4.664221957e-01f,  4.690719964e-01f,
+     4.717041368e-01f,  4.743185178e-01f,  4.769150410e-01f,  4.794936086e-01f,  4.820541235e-01f,  4.845964894e-01f,  4.871206105e-01f,  4.896263917e-01f,
+     4.921137389e-01f,  4.945825582e-01f,  4.970327567e-01f,  4.994642423e-01f,  5.018769233e-01f,  5.042707089e-01f,  5.066455091e-01f,  5.090012343e-01f,
+     5.113377959e-01f,  5.136551059e-01f,  5.159530771e-01f,  5.182316229e-01f,  5.204906576e-01f,  5.227300962e-01f,  5.249498542e-01f,  5.271498482e-01f,
+     5.293299953e-01f,  5.314902134e-01f,  5.336304212e-01f,  5.357505382e-01f,  5.378504844e-01f,  5.399301808e-01f,  5.419895492e-01f,  5.440285120e-01f,
+     5.460469925e-01f,  5.480449145e-01f,  5.500222030e-01f,  5.519787835e-01f,  5.539145822e-01f,  5.558295264e-01f,  5.577235439e-01f,  5.595965635e-01f,
+     5.614485146e-01f,  5.632793274e-01f,  5.650889331e-01f,  5.668772635e-01f,  5.686442513e-01f,  5.703898300e-01f,  5.721139338e-01f,  5.738164978e-01f,
+     5.754974580e-01f,  5.771567510e-01f,  5.787943144e-01f,  5.804100866e-01f,  5.820040066e-01f,  5.835760145e-01f,  5.851260510e-01f,  5.866540580e-01f,
+     5.881599777e-01f,  5.896437535e-01f,  5.911053296e-01f,  5.925446509e-01f,  5.939616632e-01f,  5.953563132e-01f,  5.967285484e-01f,  5.980783171e-01f,
+     5.994055685e-01f,  6.007102525e-01f,  6.019923202e-01f,  6.032517233e-01f,  6.044884142e-01f,  6.057023465e-01f,  6.068934744e-01f,  6.080617531e-01f,
+     6.092071387e-01f,  6.103295880e-01f,  6.114290586e-01f,  6.125055094e-01f,  6.135588996e-01f,  6.145891897e-01f,  6.155963409e-01f,  6.165803152e-01f,
+     6.175410756e-01f,  6.184785859e-01f,  6.193928109e-01f,  6.202837161e-01f,  6.211512679e-01f,  6.219954338e-01f,  6.228161819e-01f,  6.236134812e-01f,
+     6.243873020e-01f,  6.251376148e-01f,  6.258643916e-01f,  6.265676050e-01f,  6.272472284e-01f,  6.279032364e-01f,  6.285356041e-01f,  6.291443078e-01f,
+     6.297293246e-01f,  6.302906324e-01f,  6.308282102e-01f,  6.313420376e-01f,  6.318320954e-01f,  6.322983650e-01f,  6.327408290e-01f,  6.331594706e-01f,
+     6.335542742e-01f,  6.339252247e-01f,  6.342723084e-01f,  6.345955120e-01f,  6.348948235e-01f,  6.351702316e-01f,  6.354217258e-01f,  6.356492968e-01f,
+     6.358529360e-01f,  6.360326356e-01f,  6.361883890e-01f,  6.363201902e-01f,  6.364280344e-01f,  6.365119174e-01f,  6.365718361e-01f,  6.366077882e-01f,
+     6.366197724e-01f,  6.366077882e-01f,  6.365718361e-01f,  6.365119174e-01f,  6.364280344e-01f,  6.363201902e-01f,  6.361883890e-01f,  6.360326356e-01f,
+     6.358529360e-01f,  6.356492968e-01f,  6.354217258e-01f,  6.351702316e-01f,  6.348948235e-01f,  6.345955120e-01f,  6.342723084e-01f,  6.339252247e-01f,
+     6.335542742e-01f,  6.331594706e-01f,  6.327408290e-01f,  6.322983650e-01f,  6.318320954e-01f,  6.313420376e-01f,  6.308282102e-01f,  6.302906324e-01f,
+     6.297293246e-01f,  6.291443078e-01f,  6.285356041e-01f,  6.279032364e-01f,  6.272472284e-01f,  6.265676050e-01f,  6.258643916e-01f,  6.251376148e-01f,
+     6.243873020e-01f,  6.236134812e-01f,  6.228161819e-01f,  6.219954338e-01f,  6.211512679e-01f,  6.202837161e-01f,  6.193928109e-01f,  6.184785859e-01f,
+     6.175410756e-01f,  6.165803152e-01f,  6.155963409e-01f,  6.145891897e-01f,  6.135588996e-01f,  6.125055094e-01f,  6.114290586e-01f,  6.103295880e-01f,
+     6.092071387e-01f,  6.080617531e-01f,  6.068934744e-01f,  6.057023465e-01f,  6.044884142e-01f,  6.032517233e-01f,  6.019923202e-01f,  6.007102525e-01f,
+     5.994055685e-01f,  5.980783171e-01f,  5.967285484e-01f,  5.953563132e-01f,  5.939616632e-01f,  5.925446509e-01f,  5.911053296e-01f,  5.896437535e-01f,
+     5.881599777e-01f,  5.866540580e-01f,  5.851260510e-01f,  5.835760145e-01f,  5.820040066e-01f,  5.804100866e-01f,  5.787943144e-01f,  5.771567510e-01f,
+     5.754974580e-01f,  5.738164978e-01f,  5.721139338e-01f,  5.703898300e-01f,  5.686442513e-01f,  5.668772635e-01f,  5.650889331e-01f,  5.632793274e-01f,
+     5.614485146e-01f,  5.595965635e-01f,  5.577235439e-01f,  5.558295264e-01f,  5.539145822e-01f,  5.519787835e-01f,  5.500222030e-01f,  5.480449145e-01f,
+     5.460469925e-01f,  5.440285120e-01f,  5.419895492e-01f,  5.399301808e-01f,  5.378504844e-01f,  5.357505382e-01f,  5.336304212e-01f,  5.314902134e-01f,
+     5.293299953e-01f,  5.271498482e-01f,  5.249498542e-01f,  5.227300962e-01f,  5.204906576e-01f,  5.182316229e-01f,  5.159530771e-01f,  5.136551059e-01f,
+     5.113377959e-01f,  5.090012343e-01f,  5.066455091e-01f,  5.042707089e-01f,  5.018769233e-01f,  4.994642423e-01f,  4.970327567e-01f,  4.945825582e-01f,
+     4.921137389e-01f,  4.896263917e-01f,  4.871206105e-01f,  4.845964894e-01f,  4.820541235e-01f,  4.794936086e-01f,  4.769150410e-01f,  4.743185178e-01f,
+     4.717041368e-01f,  4.690719964e-01f,  4.664221957e-01f,  4.637548344e-01f,  4.610700131e-01f,  4.583678327e-01f,  4.556483951e-01f,  4.529118025e-01f,
+     4.501581581e-01f,  4.473875654e-01f,  4.446001289e-01f,  4.417959535e-01f,  4.389751446e-01f,  4.361378086e-01f,  4.332840523e-01f,  4.304139830e-01f,
+     4.275277090e-01f,  4.246253387e-01f,  4.217069815e-01f,  4.187727473e-01f,  4.158227466e-01f,  4.128570904e-01f,  4.098758903e-01f,  4.068792586e-01f,
+     4.038673082e-01f,  4.008401523e-01f,  3.977979051e-01f,  3.947406810e-01f,  3.916685951e-01f,  3.885817632e-01f,  3.854803013e-01f,  3.823643264e-01f,
+     3.792339556e-01f,  3.760893069e-01f,  3.729304987e-01f,  3.697576498e-01f,  3.665708797e-01f,  3.633703085e-01f,  3.601560566e-01f,  3.569282450e-01f,
+     3.536869953e-01f,  3.504324294e-01f,  3.471646700e-01f,  3.438838400e-01f,  3.405900630e-01f,  3.372834629e-01f,  3.339641644e-01f,  3.306322922e-01f,
+     3.272879720e-01f,  3.239313295e-01f,  3.205624912e-01f,  3.171815839e-01f,  3.137887349e-01f,  3.103840720e-01f,  3.069677232e-01f,  3.035398173e-01f,
+     3.001004833e-01f,  2.966498507e-01f,  2.931880493e-01f,  2.897152096e-01f,  2.862314623e-01f,  2.827369386e-01f,  2.792317699e-01f,  2.757160884e-01f,
+     2.721900263e-01f,  2.686537163e-01f,  2.651072918e-01f,  2.615508860e-01f,  2.579846331e-01f,  2.544086671e-01f,  2.508231229e-01f,  2.472281352e-01f,
+     2.436238396e-01f,  2.400103717e-01f,  2.363878675e-01f,  2.327564634e-01f,  2.291162962e-01f,  2.254675029e-01f,  2.218102209e-01f,  2.181445879e-01f,
+     2.144707418e-01f,  2.107888210e-01f,  2.070989641e-01f,  2.034013101e-01f,  1.996959982e-01f,  1.959831678e-01f,  1.922629587e-01f,  1.885355111e-01f,
+     1.848009652e-01f,  1.810594616e-01f,  1.773111413e-01f,  1.735561452e-01f,  1.697946150e-01f,  1.660266920e-01f,  1.622525182e-01f,  1.584722357e-01f,
+     1.546859868e-01f,  1.508939141e-01f,  1.470961603e-01f,  1.432928684e-01f,  1.394841816e-01f,  1.356702434e-01f,  1.318511972e-01f,  1.280271869e-01f,
+     1.241983564e-01f,  1.203648499e-01f,  1.165268118e-01f,  1.126843865e-01f,  1.088377187e-01f,  1.049869532e-01f,  1.011322350e-01f,  9.727370930e-02f,
+     9.341152125e-02f,  8.954581631e-02f,  8.567674001e-02f,  8.180443804e-02f,  7.792905618e-02f,  7.405074033e-02f,  7.016963652e-02f,  6.628589085e-02f,
+     6.239964956e-02f,  5.851105896e-02f,  5.462026545e-02f,  5.072741552e-02f,  4.683265573e-02f,  4.293613272e-02f,  3.903799319e-02f,  3.513838389e-02f,
+     3.123745166e-02f,  2.733534336e-02f,  2.343220589e-02f,  1.952818622e-02f,  1.562343132e-02f,  1.171808820e-02f,  7.812303910e-03f,  3.906225489e-03f,
+     0.000000000e+00f,
+  },
+};
@@ -0,0 +1,50 @@
+#!/usr/bin/env python3
+# generate the const sf_lowpass_fast tables in Core/Src/biquad_tables.c
+#
+# usage: ./biquad_gen.py > Core/Src/biquad_tables.c
+#
+# FAST_SIN_BITS & FAST_EXP2_BITS must match Core/Inc/biquad.h.  The
+# generated file checks this at compile time.
+import math
+import sys
+
+FAST_SIN_BITS = 10
+FAST_SIN_SIZE = 1 << FAST_SIN_BITS
+FAST_EXP2_BITS = 6
+FAST_EXP2_SIZE = 1 << FAST_EXP2_BITS
+
+# name, size expression in biquad.h, values
+def tables():
+    # one cycle of sin plus a quarter more, so cos can read it too
+    sin = [math.sin(2.0 * math.pi * i / FAST_SIN_SIZE)
+           for i in range(FAST_SIN_SIZE + FAST_SIN_SIZE // 4 + 1)]
+    # 2^(k/N) for k = 0..N, the fraction of a power of two
+    exp2 = [2.0 ** (i / FAST_EXP2_SIZE) for i in range(FAST_EXP2_SIZE + 1)]
+    return [
+        ("sf_fast_sin",  "FAST_SIN_SIZE + FAST_SIN_SIZE / 4 + 1", sin),
+        ("sf_fast_exp2", "FAST_EXP2_SIZE + 1",                    exp2),
+    ]
+
+def write_table(out, table, indent):
+    for i in range(0, len(table), 8):
+        row = ", ".join(f"{v: .9e}f" for v in table[i:i+8])
+        out.write(f"{indent}{row},\n")
+
+def main(out):
+    out.write("/*\n")
+    out.write(" * biquad_tables.c\n")
+    out.write(" *\n")
+    out.write(" * GENERATED by biquad_gen.py -- do not edit.\n")
+    out.write(" */\n\n")
+    out.write('#include "biquad.h"\n\n')
+    out.write(f"#if FAST_SIN_BITS != {FAST_SIN_BITS} || FAST_EXP2_BITS != {FAST_EXP2_BITS}\n")
+    out.write("#error biquad_tables.c is out of date, rerun biquad_gen.py\n")
+    out.write("#endif\n")
+    for name, size, table in tables():
+        out.write("\n")
+        out.write(f"const float {name}[{size}] = {{\n")
+        write_table(out, table, "  ")
+        out.write("};\n")
+
+if __name__ == "__main__":
+    main(sys.stdout)
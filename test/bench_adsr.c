@@ -0,0 +1,80 @@
+/*
+ * bench_adsr.c
+ *
+ *  Created on: Oct 17, 2026
+ *      Author: agent
+ *
+ * the incremental envelope against the old one that works out every
+ * frame from the time since note on or off.  each run plays a whole
+ * note (attack, decay, sustain & release) in 128 frame blocks.
+ */
+
+#include "test.h"
+#include "adsr.h"
+#include "ref/ref_adsr.h"
+
+#define BLOCK_FRAMES 128
+#define NOTE_BLOCKS  150
+#define TOTAL_BLOCKS 200
+#define NOTES        50
+#define FRAMES       ((double)NOTES * TOTAL_BLOCKS * BLOCK_FRAMES)
+
+static float buf[BLOCK_FRAMES];
+
+// ======================================================================
+void play_ref(void)
+{
+  ref_adsr_state_t env;
+  ref_adsr_init(&env, 0.1f, 0.2f, 0.8f, 0.3f, 0.3f);
+  for(int note = 0; note < NOTES; note++) {
+    int64_t frame = 0;
+    ref_adsr_note_on(&env, 100, frame);
+    for(int block = 0; block < TOTAL_BLOCKS; block++) {
+      if(block == NOTE_BLOCKS) {
+        ref_adsr_note_off(&env, frame);
+      }
+      ref_adsr_get_samples(&env, buf, BLOCK_FRAMES, frame);
+      frame += BLOCK_FRAMES;
+    }
+  }
+}
+
+// ======================================================================
+void play(uint8_t curve)
+{
+  adsr_state_t env;
+  adsr_init(&env, 0.1f, 0.2f, 0.8f, 0.3f, 0.3f);
+  env.curve = curve;
+  for(int note = 0; note < NOTES; note++) {
+    int64_t frame = 0;
+    adsr_note_on(&env, 100, frame);
+    for(int block = 0; block < TOTAL_BLOCKS; block++) {
+      if(block == NOTE_BLOCKS) {
+        adsr_note_off(&env, frame);
+      }
+      adsr_get_samples(&env, buf, BLOCK_FRAMES);
+      frame += BLOCK_FRAMES;
+    }
+  }
+}
+
+// ======================================================================
+int main(void)
+{
+  double ns_ref, ns_linear, ns_exp;
+  for(int i = 0; i < BLOCK_FRAMES; i++) {
+    buf[i] = 1.0f;
+  }
+  BENCH(ns_ref, FRAMES, play_ref());
+  BENCH(ns_linear, FRAMES, play(ADSR_CURVE_LINEAR));
+  BENCH(ns_exp, FRAMES, play(ADSR_CURVE_EXP));
+
+  printf("adsr_get_samples, one voice\n");
+  bench_report("old, from time since note on/off", ns_ref);
+  bench_report("incremental, linear", ns_linear);
+  bench_report("incremental, exponential", ns_exp);
+  printf("  %-40s %8.1fM frames/s\n", "old", 1e3 / ns_ref);
+  printf("  %-40s %8.1fM frames/s\n", "incremental, linear", 1e3 / ns_linear);
+  printf("  %-40s %8.1fM frames/s\n", "incremental, exponential", 1e3 / ns_exp);
+  return 0;
+}
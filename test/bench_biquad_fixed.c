@@ -0,0 +1,113 @@
+/*
+ * bench_biquad_fixed.c
+ *
+ *  Created on: Oct 17, 2026
+ *      Author: agent
+ *
+ * the fixed point biquad (SYNTH_RLPF_FIXED) against the float one, for
+ * speed & for accuracy.  both are compared with the same design run in
+ * double precision, so the error is what each one adds, reported as a
+ * signal to error ratio.  low cutoffs are the hard case: the poles sit
+ * close to 1 & the coefficients lose the most bits.
+ */
+
+#include "test.h"
+#include "biquad.h"
+#include "synthutil.h"
+#include <math.h>
+
+#define BLOCK_FRAMES 128
+#define BLOCKS       4000
+
+static sf_sample_st input[BLOCKS][BLOCK_FRAMES];
+static sf_sample_st output[BLOCKS][BLOCK_FRAMES];
+static double reference[BLOCKS][BLOCK_FRAMES];
+
+// ======================================================================
+void run_float(const sf_biquad_state_st *design)
+{
+  sf_biquad_state_st biquad = *design;
+  for(int block = 0; block < BLOCKS; block++) {
+    sf_biquad_process(&biquad, BLOCK_FRAMES, input[block], output[block]);
+  }
+}
+
+// ======================================================================
+void run_fixed(const sf_biquad_state_st *design)
+{
+  sf_biquad_fixed_st biquad;
+  sf_biquad_fixed_init(&biquad, design);
+  for(int block = 0; block < BLOCKS; block++) {
+    sf_biquad_fixed_process(&biquad, BLOCK_FRAMES, input[block], output[block]);
+  }
+}
+
+// ======================================================================
+// the left channel in double precision, with the design's coefficients
+void run_reference(const sf_biquad_state_st *design)
+{
+  double x1 = 0.0, x2 = 0.0, y1 = 0.0, y2 = 0.0;
+  for(int block = 0; block < BLOCKS; block++) {
+    for(int i = 0; i < BLOCK_FRAMES; i++) {
+      double x = input[block][i].L;
+      double y = design->b0*x + design->b1*x1 + design->b2*x2 - design->a1*y1 - design->a2*y2;
+      x2 = x1; x1 = x;
+      y2 = y1; y1 = y;
+      reference[block][i] = y;
+    }
+  }
+}
+
+// ======================================================================
+// signal to error ratio in dB of output's left channel against reference
+double snr_db(void)
+{
+  double signal = 0.0, noise = 0.0;
+  for(int block = 0; block < BLOCKS; block++) {
+    for(int i = 0; i < BLOCK_FRAMES; i++) {
+      double e = output[block][i].L - reference[block][i];
+      signal += reference[block][i] * reference[block][i];
+      noise += e * e;
+    }
+  }
+  return 10.0 * log10(signal / noise);
+}
+
+// ======================================================================
+int main(void)
+{
+  // a mix of a low & a high sine & some noise, about -6 dBFS
+  uint32_t rng = 1;
+  for(int block = 0; block < BLOCKS; block++) {
+    for(int i = 0; i < BLOCK_FRAMES; i++) {
+      int n = block * BLOCK_FRAMES + i;
+      rng = rng * 1664525u + 1013904223u;
+      float x = 0.25f * sinf(2.0f * (float)M_PI * 110.0f * n / FRAME_RATE)
+          + 0.15f * sinf(2.0f * (float)M_PI * 3000.0f * n / FRAME_RATE)
+          + 0.05f * (float)(int32_t)rng / 2147483648.0f;
+      input[block][i] = (sf_sample_st){ x, -x };
+    }
+  }
+
+  const double frames = (double)BLOCKS * BLOCK_FRAMES;
+  const float cutoffs[] = { 50.0f, 600.0f, 5000.0f };
+  printf("stereo lowpass, resonance 5 dB, %d frame blocks\n", BLOCK_FRAMES);
+  for(int c = 0; c < 3; c++) {
+    sf_biquad_state_st design;
+    sf_lowpass(&design, FRAME_RATE, cutoffs[c], 5.0f);
+    run_reference(&design);
+    double ns_float, ns_fixed;
+    BENCH(ns_float, frames, run_float(&design));
+    double snr_float = snr_db();
+    BENCH(ns_fixed, frames, run_fixed(&design));
+    double snr_fixed = snr_db();
+    char label[64];
+    snprintf(label, sizeof(label), "float, cutoff %.0f Hz", cutoffs[c]);
+    bench_report(label, ns_float);
+    printf("    signal to error %.1f dB\n", snr_float);
+    snprintf(label, sizeof(label), "fixed, cutoff %.0f Hz", cutoffs[c]);
+    bench_report(label, ns_fixed);
+    printf("    signal to error %.1f dB\n", snr_fixed);
+  }
+  return 0;
+}
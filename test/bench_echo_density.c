@@ -0,0 +1,112 @@
+/*
+ * bench_echo_density.c
+ *
+ *  Created on: Oct 17, 2026
+ *      Author: agent
+ *
+ * how fast each reverb's tail builds up to a dense, noise-like wash
+ * against what it costs.  the density is Abel & Huang's normalized echo
+ * density of the impulse response: in each window, the fraction of
+ * frames further than one standard deviation from zero, over the
+ * fraction a gaussian has (erfc(1/sqrt(2))).  a few separate echoes
+ * give near 0, a diffuse tail 1.
+ */
+
+#include "test.h"
+#include "reverb.h"
+#include "fdn.h"
+#include "synthutil.h"
+#include <math.h>
+#include <string.h>
+
+#define BLOCK_FRAMES 128
+#define BLOCKS       1000
+// 20 ms windows, every 10 ms
+#define WINDOW_FRAMES (FRAME_RATE / 50)
+#define STEP_FRAMES   (FRAME_RATE / 100)
+#define DENSE         0.9
+
+static float input[BLOCKS][2*BLOCK_FRAMES];
+static float output[BLOCKS][2*BLOCK_FRAMES];
+static reverb_ring_t ring;
+static reverb_state_t reverb;
+static fdn_state_t fdn;
+
+// ======================================================================
+// run algorithm (a verb number) over input[] into output[], all wet
+void run(int algorithm)
+{
+  if(algorithm == REVERB_FDN) {
+    fdn_init(&fdn, &ring, 1.0f);
+    fdn_clear(&fdn);
+  } else {
+    reverb_init(&reverb, &ring, algorithm, 1.0f, 1.0f);
+  }
+  for(int block = 0; block < BLOCKS; block++) {
+    if(algorithm == REVERB_FDN) {
+      fdn_get_samples(&fdn, input[block], output[block], BLOCK_FRAMES);
+    } else {
+      reverb_get_samples(&reverb, input[block], output[block], BLOCK_FRAMES);
+    }
+  }
+}
+
+// ======================================================================
+// normalized echo density of the left output in the window starting at
+// frame start
+double echo_density(int start)
+{
+  const float *left = &(output[0][0]);
+  double sum = 0.0;
+  for(int i = start; i < start + WINDOW_FRAMES; i++) {
+    sum += (double)left[2*i] * left[2*i];
+  }
+  double sd = sqrt(sum / WINDOW_FRAMES);
+  int outside = 0;
+  for(int i = start; i < start + WINDOW_FRAMES; i++) {
+    outside += (fabs(left[2*i]) > sd);
+  }
+  return ((double)outside / WINDOW_FRAMES) / erfc(1.0 / sqrt(2.0));
+}
+
+// ======================================================================
+int main(void)
+{
+  const char *names[] = { "schroeder", "freeverb", "fdn" };
+  const double ms[] = { 25, 50, 100, 200, 400 };
+  const double frames = (double)BLOCKS * BLOCK_FRAMES;
+  printf("echo density of the impulse response, %d ms windows, & cost on noise\n", 1000 * WINDOW_FRAMES / FRAME_RATE);
+  printf("  %-10s %8s  %6s %6s %6s %6s %6s  %s\n", "", "ns/frame", "25ms", "50ms", "100ms", "200ms", "400ms", "dense after");
+  for(int algorithm = REVERB_SCHROEDER; algorithm <= REVERB_FDN; algorithm++) {
+    uint32_t rng = 1;
+    for(int block = 0; block < BLOCKS; block++) {
+      for(int i = 0; i < 2*BLOCK_FRAMES; i++) {
+        rng = rng * 1664525u + 1013904223u;
+        input[block][i] = 0.5f * (float)(int32_t)rng / 2147483648.0f;
+      }
+    }
+    double ns;
+    BENCH(ns, frames, run(algorithm));
+
+    memset(input, 0, sizeof(input));
+    input[0][0] = input[0][1] = 1.0f;
+    run(algorithm);
+    printf("  %-10s %8.2f ", names[algorithm], ns);
+    for(int i = 0; i < (int)(sizeof(ms) / sizeof(ms[0])); i++) {
+      printf(" %6.2f", echo_density((int)(ms[i] * FRAME_RATE / 1000) - WINDOW_FRAMES / 2));
+    }
+    int dense = -1;
+    for(int start = 0; start + WINDOW_FRAMES <= BLOCKS * BLOCK_FRAMES; start += STEP_FRAMES) {
+      if(echo_density(start) >= DENSE) {
+        dense = start + WINDOW_FRAMES / 2;
+        break;
+      }
+    }
+    if(dense < 0) {
+      printf("  never\n");
+    } else {
+      printf("  %.0f ms\n", 1000.0 * dense / FRAME_RATE);
+    }
+  }
+  return 0;
+}
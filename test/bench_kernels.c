@@ -0,0 +1,66 @@
+/*
+ * bench_kernels.c
+ *
+ *  Created on: Oct 17, 2026
+ *      Author: agent
+ *
+ * the per-waveform kernels behind wavetable_get_samples against picking
+ * the table with a switch on every frame.  both use the same fixed
+ * point phase & interpolation.  10 voices, half sine & half saw.
+ */
+
+#include "test.h"
+#include "wavetable.h"
+#include "ref/ref_wavetable.h"
+#include <string.h>
+
+#define BLOCK_FRAMES 128
+#define BLOCKS       2000
+#define VOICES       10
+#define FRAMES       ((double)BLOCKS * BLOCK_FRAMES)
+
+static wavetable_state_t voices[VOICES];
+static float switch_out[VOICES][BLOCK_FRAMES];
+static float kernel_out[VOICES][BLOCK_FRAMES];
+
+// ======================================================================
+void start_voices(void)
+{
+  for(int v = 0; v < VOICES; v++) {
+    wavetable_init(&(voices[v]), v & 1);
+    wavetable_note_on(&(voices[v]), 40 + 5*v, 100);
+  }
+}
+
+void run_switch(void)
+{
+  start_voices();
+  for(int block = 0; block < BLOCKS; block++) {
+    for(int v = 0; v < VOICES; v++) {
+      ref_switch_get_samples(&(voices[v]), switch_out[v], BLOCK_FRAMES);
+    }
+  }
+}
+
+void run_kernels(void)
+{
+  start_voices();
+  for(int block = 0; block < BLOCKS; block++) {
+    for(int v = 0; v < VOICES; v++) {
+      wavetable_get_samples(&(voices[v]), kernel_out[v], BLOCK_FRAMES);
+    }
+  }
+}
+
+// ======================================================================
+int main(void)
+{
+  double ns_switch, ns_kernels;
+  BENCH(ns_switch, FRAMES * VOICES, run_switch());
+  BENCH(ns_kernels, FRAMES * VOICES, run_kernels());
+  printf("wavetable_get_samples, per voice\n");
+  bench_report("switch on every frame", ns_switch);
+  bench_report("kernel per waveform", ns_kernels);
+  printf("  output %s\n", memcmp(switch_out, kernel_out, sizeof(kernel_out)) ? "DIFFERS" : "is identical");
+  return 0;
+}
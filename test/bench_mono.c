@@ -0,0 +1,140 @@
+/*
+ * bench_mono.c
+ *
+ *  Created on: Oct 17, 2026
+ *      Author: agent
+ *
+ * rendering the voices in mono & going stereo once at the pan stage,
+ * against rendering every voice in stereo as the synth used to.  both
+ * take a pass per stage (osc, env, mix) with the same oscillator &
+ * envelope math, so only the layout differs.  10 saw voices in 128
+ * frame blocks.
+ */
+
+#include "test.h"
+#include "wavetable.h"
+#include "adsr.h"
+#include <string.h>
+
+#define BLOCK_FRAMES 128
+#define BLOCKS       2000
+#define VOICES       10
+
+static wavetable_state_t wavetables[VOICES];
+static adsr_state_t envelopes[VOICES];
+static float voice_buffer[2*BLOCK_FRAMES];
+static float mix_buffer[BLOCK_FRAMES];
+static float stereo_out[BLOCKS][2*BLOCK_FRAMES];
+static float mono_out[BLOCKS][2*BLOCK_FRAMES];
+
+// ======================================================================
+void start_voices(void)
+{
+  for(int v = 0; v < VOICES; v++) {
+    wavetable_init(&(wavetables[v]), WAVE_SAW);
+    wavetable_note_on(&(wavetables[v]), 48 + 3*v, 100);
+    adsr_init(&(envelopes[v]), 0.01f, 0.02f, 0.8f, 0.1f, 0.3f);
+    adsr_note_on(&(envelopes[v]), 100, 0);
+  }
+}
+
+// ======================================================================
+// the stereo stages, as they were
+void stereo_wavetable_get_samples(wavetable_state_t *self, float *out_samples, int frame_count)
+{
+  const float *table = saw_wave_table[self->mip_level];
+  for(int frame = 0; frame < frame_count; frame++) {
+    uint32_t idx = self->phase >> WAVE_PHASE_FRAC_BITS;
+    float frac = (float)(self->phase & WAVE_PHASE_FRAC_MASK) * (1.0f / (float)(1UL << WAVE_PHASE_FRAC_BITS));
+    float a = table[idx];
+    float sample_f = a + (table[idx + 1] - a) * frac;
+    out_samples[2*frame]   = sample_f;
+    out_samples[2*frame+1] = sample_f;
+    self->phase += self->phase_inc;
+  }
+}
+
+void stereo_adsr_get_samples(adsr_state_t *self, float *inout_samples, int frame_count)
+{
+  int i = 0;
+  while(i < frame_count) {
+    adsr_ramp_t ramp;
+    int n = adsr_get_ramp(self, frame_count - i, &ramp);
+    if(n == 0) {
+      for(; i < frame_count; i++) {
+        inout_samples[2*i]   = 0.0f;
+        inout_samples[2*i+1] = 0.0f;
+      }
+      break;
+    }
+    int end = i + n;
+    float level = ramp.level;
+    for(; i < end; i++) {
+      inout_samples[2*i]   *= level;
+      inout_samples[2*i+1] *= level;
+      level += ramp.inc;
+    }
+    adsr_end_ramp(self, n, level);
+  }
+}
+
+void render_stereo(void)
+{
+  start_voices();
+  for(int block = 0; block < BLOCKS; block++) {
+    float *out = &(stereo_out[block][0]);
+    memset(out, 0, sizeof(float)*2*BLOCK_FRAMES);
+    for(int v = 0; v < VOICES; v++) {
+      stereo_wavetable_get_samples(&(wavetables[v]), voice_buffer, BLOCK_FRAMES);
+      stereo_adsr_get_samples(&(envelopes[v]), voice_buffer, BLOCK_FRAMES);
+      for(int i = 0; i < BLOCK_FRAMES; i++) {
+        out[2*i]   += voice_buffer[2*i];
+        out[2*i+1] += voice_buffer[2*i+1];
+      }
+    }
+  }
+}
+
+// ======================================================================
+// mono voices, then pan
+void render_mono(void)
+{
+  start_voices();
+  for(int block = 0; block < BLOCKS; block++) {
+    float *out = &(mono_out[block][0]);
+    memset(mix_buffer, 0, sizeof(mix_buffer));
+    for(int v = 0; v < VOICES; v++) {
+      wavetable_get_samples(&(wavetables[v]), voice_buffer, BLOCK_FRAMES);
+      adsr_get_samples(&(envelopes[v]), voice_buffer, BLOCK_FRAMES);
+      for(int i = 0; i < BLOCK_FRAMES; i++) {
+        mix_buffer[i] += voice_buffer[i];
+      }
+    }
+    for(int i = 0; i < BLOCK_FRAMES; i++) {
+      out[2*i]   = mix_buffer[i];
+      out[2*i+1] = mix_buffer[i];
+    }
+  }
+}
+
+// ======================================================================
+int main(void)
+{
+  double ns_stereo, ns_mono;
+  BENCH(ns_stereo, (double)BLOCKS * BLOCK_FRAMES, render_stereo());
+  BENCH(ns_mono, (double)BLOCKS * BLOCK_FRAMES, render_mono());
+
+  printf("%d voices, osc + env + mix\n", VOICES);
+  bench_report("stereo voices", ns_stereo);
+  bench_report("mono voices, then pan", ns_mono);
+  // per voice per frame: osc store, env load & store, mix load of the
+  // voice & load & store of the mix.  channels floats each.
+  for(int channels = 2; channels >= 1; channels--) {
+    printf("  %-40s %d bytes, %d env multiplies, %d mix adds per voice per frame\n",
+        (channels == 2) ? "stereo voices" : "mono voices",
+        (int)(5 * channels * sizeof(float)), channels, channels);
+  }
+  printf("  output %s\n",
+      memcmp(stereo_out, mono_out, sizeof(mono_out)) ? "DIFFERS" : "is identical");
+  return 0;
+}
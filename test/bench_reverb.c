@@ -0,0 +1,163 @@
+/*
+ * bench_reverb.c
+ *
+ *  Created on: Oct 17, 2026
+ *      Author: agent
+ *
+ * the schroeder reverb against the old one in ref/ref_reverb.c, whose
+ * lines had their own buffers & ran a frame at a time.  both get the
+ * same noise, with wet & delay changed part way through, then silence.
+ * the outputs should match except once the new one has gone idle on a
+ * tail too quiet for the DAC.  the timing is over the noise, the
+ * comparison over all of it.
+ *
+ * then the algorithms against each other in the float & REVERB_Q15
+ * builds, all wet, with how alike their two sides are.
+ */
+
+#include "test.h"
+#include "reverb.h"
+#include "ref/ref_reverb.h"
+#include "ref/reverb_q15.h"
+#include <math.h>
+
+#define BLOCK_FRAMES 128
+#define BLOCKS       3000
+#define NOISE_BLOCKS 1000
+
+static float input[BLOCKS][2*BLOCK_FRAMES];
+static float output[BLOCKS][2*BLOCK_FRAMES];
+static float ref_output[BLOCKS][2*BLOCK_FRAMES];
+static reverb_ring_t ring;
+static reverb_state_t reverb;
+static ref_reverb_state_t ref_reverb;
+
+// ======================================================================
+// changes to make before block, so the delays are moving for most of it
+// when moving is set
+void changes(int block, int moving, void (*set_wet)(void *, float), void (*set_delay)(void *, float), void *self)
+{
+  if(moving && ((block & 255) == 0)) {
+    set_delay(self, (block & 256) ? 1.0f : 1.5f);
+  }
+  if(block == 300) {
+    set_wet(self, 0.5f);
+  }
+}
+
+void wet_new(void *self, float wet) { reverb_set_wet(self, wet); }
+void delay_new(void *self, float delay) { reverb_set_delay(self, delay); }
+void wet_ref(void *self, float wet) { ref_reverb_set_wet(self, wet); }
+void delay_ref(void *self, float delay) { ref_reverb_set_delay(self, delay); }
+
+// ======================================================================
+void run_new(int moving, int blocks)
+{
+  reverb_init(&reverb, &ring, REVERB_SCHROEDER, 0.75f, 1.5f);
+  for(int block = 0; block < blocks; block++) {
+    changes(block, moving, wet_new, delay_new, &reverb);
+    reverb_get_samples(&reverb, input[block], output[block], BLOCK_FRAMES);
+  }
+}
+
+// ======================================================================
+void run_ref(int moving, int blocks)
+{
+  ref_reverb_init(&ref_reverb, 0.75f, 1.5f);
+  for(int block = 0; block < blocks; block++) {
+    changes(block, moving, wet_ref, delay_ref, &ref_reverb);
+    ref_reverb_get_samples(&ref_reverb, input[block], ref_output[block], BLOCK_FRAMES);
+  }
+}
+
+// ======================================================================
+void run_algorithm(int algorithm, int q15)
+{
+  if(q15) {
+    reverb_q15_start(algorithm, 1.0f, 1.0f);
+  } else {
+    reverb_init(&reverb, &ring, algorithm, 1.0f, 1.0f);
+  }
+  for(int block = 0; block < NOISE_BLOCKS; block++) {
+    if(q15) {
+      reverb_q15_get_samples(input[block], output[block], BLOCK_FRAMES);
+    } else {
+      reverb_get_samples(&reverb, input[block], output[block], BLOCK_FRAMES);
+    }
+  }
+}
+
+// ======================================================================
+// correlation of the left & right outputs
+double lr_correlation(void)
+{
+  double lr = 0.0, ll = 0.0, rr = 0.0;
+  for(int block = 0; block < NOISE_BLOCKS; block++) {
+    for(int i = 0; i < BLOCK_FRAMES; i++) {
+      double l = output[block][2*i], r = output[block][2*i+1];
+      lr += l*r;
+      ll += l*l;
+      rr += r*r;
+    }
+  }
+  return lr / sqrt(ll * rr);
+}
+
+// ======================================================================
+// largest difference between the two outputs over the noise & over the
+// silence after it
+void compare(double *noise_diff, double *tail_diff)
+{
+  *noise_diff = *tail_diff = 0.0;
+  for(int block = 0; block < BLOCKS; block++) {
+    double *diff = (block < NOISE_BLOCKS) ? noise_diff : tail_diff;
+    for(int i = 0; i < 2*BLOCK_FRAMES; i++) {
+      double d = fabs(output[block][i] - ref_output[block][i]);
+      *diff = (d > *diff) ? d : *diff;
+    }
+  }
+}
+
+// ======================================================================
+int main(void)
+{
+  uint32_t rng = 1;
+  for(int block = 0; block < NOISE_BLOCKS; block++) {
+    for(int i = 0; i < 2*BLOCK_FRAMES; i++) {
+      rng = rng * 1664525u + 1013904223u;
+      input[block][i] = 0.5f * (float)(int32_t)rng / 2147483648.0f;
+    }
+  }
+
+  double ns_ref, ns_new, ns_ref_moving, ns_new_moving, noise_diff, tail_diff;
+  const double frames = (double)NOISE_BLOCKS * BLOCK_FRAMES;
+  printf("schroeder reverb, %d frame blocks of noise\n", BLOCK_FRAMES);
+  BENCH(ns_ref, frames, run_ref(0, NOISE_BLOCKS));
+  BENCH(ns_new, frames, run_new(0, NOISE_BLOCKS));
+  run_ref(0, BLOCKS);
+  run_new(0, BLOCKS);
+  compare(&noise_diff, &tail_diff);
+  bench_report("old, a line at a time per frame", ns_ref);
+  bench_report("ring, a block at a time per line", ns_new);
+  printf("    largest difference %.1e, %.1e in the tail\n", noise_diff, tail_diff);
+  BENCH(ns_ref_moving, frames, run_ref(1, NOISE_BLOCKS));
+  BENCH(ns_new_moving, frames, run_new(1, NOISE_BLOCKS));
+  run_ref(1, BLOCKS);
+  run_new(1, BLOCKS);
+  compare(&noise_diff, &tail_diff);
+  bench_report("old, delays moving", ns_ref_moving);
+  bench_report("ring, delays moving", ns_new_moving);
+  printf("    largest difference %.1e, %.1e in the tail\n", noise_diff, tail_diff);
+
+  const char *names[] = { "schroeder", "freeverb" };
+  for(int q15 = 0; q15 < 2; q15++) {
+    printf("%s build, all wet\n", q15 ? "REVERB_Q15" : "float");
+    for(int algorithm = REVERB_SCHROEDER; algorithm <= REVERB_FREEVERB; algorithm++) {
+      double ns;
+      BENCH(ns, frames, run_algorithm(algorithm, q15));
+      bench_report(names[algorithm], ns);
+      printf("    L/R correlation %.2f\n", lr_correlation());
+    }
+  }
+  return 0;
+}
@@ -0,0 +1,79 @@
+/*
+ * bench_svf.c
+ *
+ *  Created on: Oct 17, 2026
+ *      Author: agent
+ *
+ * the state variable filter against the biquad it can replace after the
+ * reverb, both held still & with the cutoff swept every block the way
+ * set_cutoff does it (svf_set_cutoff vs sf_lowpass & sf_biquad_retune).
+ */
+
+#include "test.h"
+#include "svf.h"
+#include "biquad.h"
+#include "synthutil.h"
+#include <math.h>
+
+#define BLOCK_FRAMES 128
+#define BLOCKS       4000
+
+static sf_sample_st input[BLOCK_FRAMES];
+static sf_sample_st output[BLOCK_FRAMES];
+static volatile float sink;
+
+// ======================================================================
+float sweep_cutoff(int block)
+{
+  return 200.0f * exp2f(5.0f * (block & 63) / 64.0f);
+}
+
+// ======================================================================
+void run_biquad(int sweep)
+{
+  sf_biquad_state_st biquad, design;
+  sf_lowpass(&biquad, FRAME_RATE, 600.0f, 5.0f);
+  for(int block = 0; block < BLOCKS; block++) {
+    if(sweep) {
+      sf_lowpass(&design, FRAME_RATE, sweep_cutoff(block), 5.0f);
+      sf_biquad_retune(&biquad, &design);
+    }
+    sf_biquad_process(&biquad, BLOCK_FRAMES, input, output);
+  }
+  sink = output[0].L;
+}
+
+// ======================================================================
+void run_svf(int sweep)
+{
+  svf_state_t svf;
+  svf_init(&svf, SVF_LOWPASS, 600.0f, 5.0f);
+  for(int block = 0; block < BLOCKS; block++) {
+    if(sweep) {
+      svf_set_cutoff(&svf, sweep_cutoff(block));
+    }
+    svf_process(&svf, BLOCK_FRAMES, input, output);
+  }
+  sink = output[0].L;
+}
+
+// ======================================================================
+int main(void)
+{
+  for(int i = 0; i < BLOCK_FRAMES; i++) {
+    float x = sinf(0.05f * i) + 0.5f * sinf(0.71f * i);
+    input[i] = (sf_sample_st){ x, -x };
+  }
+  double ns_biquad, ns_svf, ns_biquad_sweep, ns_svf_sweep;
+  const double frames = (double)BLOCKS * BLOCK_FRAMES;
+  BENCH(ns_biquad, frames, run_biquad(0));
+  BENCH(ns_svf, frames, run_svf(0));
+  BENCH(ns_biquad_sweep, frames, run_biquad(1));
+  BENCH(ns_svf_sweep, frames, run_svf(1));
+  printf("stereo lowpass, %d frame blocks\n", BLOCK_FRAMES);
+  bench_report("biquad", ns_biquad);
+  bench_report("svf", ns_svf);
+  bench_report("biquad, cutoff swept every block", ns_biquad_sweep);
+  bench_report("svf, cutoff swept every block", ns_svf_sweep);
+  return 0;
+}
@@ -0,0 +1,98 @@
+/*
+ * bench_vcf.c
+ *
+ *  Created on: Oct 17, 2026
+ *      Author: agent
+ *
+ * what the per voice filter costs.  10 saw voices rendered the way
+ * synth.c does it, with the filter off (the fused voice kernel) & on
+ * (osc, filter envelope, vcf & env each a pass over the voice buffer).
+ */
+
+#include "test.h"
+#include "wavetable.h"
+#include "adsr.h"
+#include "vcf.h"
+#include <math.h>
+#include <string.h>
+
+#define BLOCK_FRAMES 128
+#define BLOCKS       2000
+#define VOICES       10
+
+static wavetable_state_t wavetables[VOICES];
+static adsr_state_t envelopes[VOICES];
+static adsr_state_t filter_envelopes[VOICES];
+static vcf_bank_t vcf;
+static float voice_buffer[BLOCK_FRAMES];
+static float mix_buffer[BLOCK_FRAMES];
+
+// ======================================================================
+void start_voices(void)
+{
+  vcf_init(&vcf);
+  for(int v = 0; v < VOICES; v++) {
+    wavetable_init(&(wavetables[v]), WAVE_SAW);
+    wavetable_note_on(&(wavetables[v]), 40 + 3*v, 100);
+    adsr_init(&(envelopes[v]), 0.1f, 0.1f, 0.8f, 0.1f, 0.3f);
+    adsr_note_on(&(envelopes[v]), 100, 0);
+    adsr_init(&(filter_envelopes[v]), 0.01f, 0.3f, 0.3f, 0.3f, 1.0f);
+    adsr_note_on(&(filter_envelopes[v]), 127, 0);
+    vcf_note_on(&vcf, v, 300.0f, 6.0f);
+  }
+}
+
+// ======================================================================
+// as voice_mix_samples
+void render_plain(void)
+{
+  start_voices();
+  for(int block = 0; block < BLOCKS; block++) {
+    memset(mix_buffer, 0, sizeof(mix_buffer));
+    for(int v = 0; v < VOICES; v++) {
+      int i = 0;
+      while(i < BLOCK_FRAMES) {
+        adsr_ramp_t ramp;
+        int n = adsr_get_ramp(&(envelopes[v]), BLOCK_FRAMES - i, &ramp);
+        if(n == 0) {
+          break;
+        }
+        wavetable_mix_samples(&(wavetables[v]), &(mix_buffer[i]), n, &ramp);
+        adsr_end_ramp(&(envelopes[v]), n, ramp.level);
+        i += n;
+      }
+    }
+  }
+}
+
+// ======================================================================
+// as voice_filter_mix_samples, with fenv 4 & fvelocity 1
+void render_filtered(void)
+{
+  start_voices();
+  for(int block = 0; block < BLOCKS; block++) {
+    memset(mix_buffer, 0, sizeof(mix_buffer));
+    for(int v = 0; v < VOICES; v++) {
+      float env_level = adsr_advance(&(filter_envelopes[v]), BLOCK_FRAMES);
+      vcf_set(&vcf, v, 300.0f * exp2f(4.0f * env_level + 100.0f / 127.0f), 6.0f);
+      wavetable_get_samples(&(wavetables[v]), voice_buffer, BLOCK_FRAMES);
+      vcf_process(&vcf, v, voice_buffer, BLOCK_FRAMES);
+      adsr_mix_samples(&(envelopes[v]), voice_buffer, mix_buffer, BLOCK_FRAMES);
+    }
+  }
+}
+
+// ======================================================================
+int main(void)
+{
+  double ns_plain, ns_filtered;
+  const double voice_frames = (double)BLOCKS * BLOCK_FRAMES * VOICES;
+  BENCH(ns_plain, voice_frames, render_plain());
+  BENCH(ns_filtered, voice_frames, render_filtered());
+  printf("%d saw voices, per voice\n", VOICES);
+  bench_report("filter off", ns_plain);
+  bench_report("filter on", ns_filtered);
+  printf("  filter cost per voice per %d frame block: %.0f ns\n",
+      BLOCK_FRAMES, (ns_filtered - ns_plain) * BLOCK_FRAMES);
+  return 0;
+}
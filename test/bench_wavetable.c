@@ -0,0 +1,121 @@
+/*
+ * bench_wavetable.c
+ *
+ *  Created on: Oct 17, 2026
+ *      Author: agent
+ *
+ * wavetable_get_samples against the old float phase oscillator, which
+ * truncates its phase to read the table.  besides the speed, compares
+ * how close each gets to a true sine & how far each one's phase has
+ * drifted after an hour.
+ */
+
+#include "test.h"
+#include "wavetable.h"
+#include "synthutil.h"
+#include "ref/ref_wavetable.h"
+#include <math.h>
+
+#define BLOCK_FRAMES 128
+#define BLOCKS       4000
+#define FRAMES       ((double)BLOCKS * BLOCK_FRAMES)
+
+static float buf[BLOCK_FRAMES];
+
+// ======================================================================
+void run_float(uint8_t wave)
+{
+  ref_float_wavetable_t osc;
+  ref_float_note_on(&osc, wave, 69);
+  for(int block = 0; block < BLOCKS; block++) {
+    ref_float_get_samples(&osc, buf, BLOCK_FRAMES);
+  }
+}
+
+void run_fixed(uint8_t wave)
+{
+  wavetable_state_t osc;
+  wavetable_init(&osc, wave);
+  wavetable_note_on(&osc, 69, 127);
+  for(int block = 0; block < BLOCKS; block++) {
+    wavetable_get_samples(&osc, buf, BLOCK_FRAMES);
+  }
+}
+
+// ======================================================================
+// worst error against sinf over a second of A4
+void sine_error(float *float_err, float *fixed_err)
+{
+  ref_float_wavetable_t fosc;
+  wavetable_state_t osc;
+  ref_float_note_on(&fosc, WAVE_SINE, 69);
+  wavetable_init(&osc, WAVE_SINE);
+  wavetable_note_on(&osc, 69, 127);
+  *float_err = *fixed_err = 0.0f;
+  float fbuf[BLOCK_FRAMES];
+  for(int block = 0; block < FRAME_RATE / BLOCK_FRAMES; block++) {
+    // where each one thinks it is, so drift doesn't count as error here
+    double fphase = fosc.phase / WAVE_TABLE_LENGTH;
+    double phase = osc.phase / 4294967296.0;
+    ref_float_get_samples(&fosc, fbuf, BLOCK_FRAMES);
+    wavetable_get_samples(&osc, buf, BLOCK_FRAMES);
+    for(int i = 0; i < BLOCK_FRAMES; i++) {
+      double fp = fphase + (double)i * fosc.phase_inc / WAVE_TABLE_LENGTH;
+      double p = phase + (double)i * osc.phase_inc / 4294967296.0;
+      float fe = fabsf(fbuf[i] - (float)sin(2.0 * M_PI * fp));
+      float e = fabsf(buf[i] - (float)sin(2.0 * M_PI * p));
+      *float_err = (fe > *float_err) ? fe : *float_err;
+      *fixed_err = (e > *fixed_err) ? e : *fixed_err;
+    }
+  }
+}
+
+// ======================================================================
+// phase error in cycles after an hour of A4, against each one's own
+// phase_inc worked out exactly
+void phase_drift(double *float_drift, double *fixed_drift)
+{
+  ref_float_wavetable_t fosc;
+  wavetable_state_t osc;
+  ref_float_note_on(&fosc, WAVE_SINE, 69);
+  wavetable_init(&osc, WAVE_SINE);
+  wavetable_note_on(&osc, 69, 127);
+  const int64_t frames = 3600LL * FRAME_RATE;
+  for(int64_t i = 0; i < frames; i++) {
+    fosc.phase += fosc.phase_inc;
+    if(fosc.phase > WAVE_TABLE_LENGTH) {
+      fosc.phase -= WAVE_TABLE_LENGTH;
+    }
+    osc.phase += osc.phase_inc;
+  }
+  double fexact = fmod((double)fosc.phase_inc * frames, WAVE_TABLE_LENGTH) / WAVE_TABLE_LENGTH;
+  double exact = fmod((double)osc.phase_inc * frames, 4294967296.0) / 4294967296.0;
+  *float_drift = fabs(remainder(fosc.phase / WAVE_TABLE_LENGTH - fexact, 1.0));
+  *fixed_drift = fabs(remainder(osc.phase / 4294967296.0 - exact, 1.0));
+}
+
+// ======================================================================
+int main(void)
+{
+  const char *names[NUM_WAVES] = { "sine", "saw" };
+  printf("wavetable_get_samples, one A4 voice\n");
+  for(uint8_t wave = 0; wave < NUM_WAVES; wave++) {
+    double ns_float, ns_fixed;
+    char label[64];
+    BENCH(ns_float, FRAMES, run_float(wave));
+    BENCH(ns_fixed, FRAMES, run_fixed(wave));
+    snprintf(label, sizeof(label), "%s, float phase, truncated", names[wave]);
+    bench_report(label, ns_float);
+    snprintf(label, sizeof(label), "%s, fixed phase, interpolated", names[wave]);
+    bench_report(label, ns_fixed);
+  }
+
+  float float_err, fixed_err;
+  sine_error(&float_err, &fixed_err);
+  printf("  worst error against a true sine: float %.2e (%.1f dB), fixed %.2e (%.1f dB)\n",
+      float_err, 20*log10f(float_err), fixed_err, 20*log10f(fixed_err));
+  double float_drift, fixed_drift;
+  phase_drift(&float_drift, &fixed_drift);
+  printf("  phase drift after an hour: float %.2e cycles, fixed %.2e cycles\n", float_drift, fixed_drift);
+  return 0;
+}
@@ -0,0 +1,85 @@
+/*
+ * ref_adsr.c
+ *
+ *  Created on: Oct 17, 2026
+ *      Author: agent
+ *
+ * see ref_adsr.h.  the same code as the old adsr.c, except it renders
+ * mono like the current one so only the envelope math differs.
+ */
+
+#include "ref_adsr.h"
+#include "synthutil.h"
+
+float ref_get_sample(ref_adsr_state_t *self, int64_t frame);
+
+// ======================================================================
+void ref_adsr_init(ref_adsr_state_t *self, float attack, float decay, float sustain, float release, float scale)
+{
+  self->attack  = attack;
+  self->decay   = decay;
+  self->sustain = sustain;
+  self->release = release;
+  self->scale   = scale;
+  self->max_amplitude = -1;
+  self->cur_amplitude = -1;
+  self->start_frame = -1;
+  self->release_frame = -1;
+  self->release_amplitude = -1;
+}
+
+// ======================================================================
+void ref_adsr_note_on(ref_adsr_state_t *self, int8_t velocity, int64_t frame)
+{
+  self->max_amplitude = self->scale * (float)velocity/127.0;
+  self->start_frame = frame;
+  self->release_frame = -1;
+  self->cur_amplitude = 0;
+  self->release_amplitude = 0;
+}
+
+// ======================================================================
+void ref_adsr_note_off(ref_adsr_state_t *self, int64_t frame)
+{
+  self->release_frame = frame;
+  self->release_amplitude = self->cur_amplitude;
+}
+
+// ======================================================================
+// frame is the synth frame of inout_samples[0]
+void ref_adsr_get_samples(ref_adsr_state_t *self, float *inout_samples, int frame_count, int64_t frame)
+{
+  for(int i = 0; i < frame_count; i++) {
+    inout_samples[i] *= ref_get_sample(self, frame + i);
+  }
+}
+
+// ======================================================================
+inline float ref_get_sample(ref_adsr_state_t *self, int64_t frame)
+{
+  if(self->start_frame < 0) {
+    return 0;
+  }
+  if(self->release_frame < self->start_frame) {
+    float cur_time = (float)(frame - self->start_frame) / FRAME_RATE;
+    if(cur_time <= self->attack) {
+      self->cur_amplitude = cur_time / self->attack;
+      return self->cur_amplitude * self->max_amplitude;
+    }
+    cur_time -= self->attack;
+    if(cur_time <= self->decay) {
+      self->cur_amplitude =
+          self->sustain + (1.0f - self->sustain) * (1.0f - cur_time / self->decay);
+      return self->cur_amplitude * self->max_amplitude;
+    }
+    self->cur_amplitude = self->sustain;
+    return self->cur_amplitude * self->max_amplitude;
+  }
+  float cur_time = (float)(frame - self->release_frame) / FRAME_RATE;
+  if(cur_time <= self->release) {
+    self->cur_amplitude = self->release_amplitude * (1.0f - cur_time / self->release);
+    return self->cur_amplitude * self->max_amplitude;
+  }
+  self->cur_amplitude = 0.0f;
+  return self->cur_amplitude;
+}
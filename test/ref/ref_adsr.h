@@ -0,0 +1,34 @@
+/*
+ * ref_adsr.h
+ *
+ *  Created on: Oct 17, 2026
+ *      Author: agent
+ *
+ * the envelope as it was before it became incremental: every frame is
+ * worked out from the time since note on or off.  kept for bench_adsr.
+ */
+
+#ifndef TEST_REF_ADSR_H_
+#define TEST_REF_ADSR_H_
+
+#include <stdint.h>
+
+typedef struct {
+  float attack;
+  float decay;
+  float sustain;
+  float release;
+  float scale;
+  float max_amplitude;
+  int64_t start_frame;   // synth frame of note on, -1 = reset
+  int64_t release_frame; // synth frame of note off, -1 = not released
+  float cur_amplitude;
+  float release_amplitude;
+} ref_adsr_state_t;
+
+void ref_adsr_init(ref_adsr_state_t *self, float attack, float decay, float sustain, float release, float scale);
+void ref_adsr_note_on(ref_adsr_state_t *self, int8_t velocity, int64_t frame);
+void ref_adsr_note_off(ref_adsr_state_t *self, int64_t frame);
+void ref_adsr_get_samples(ref_adsr_state_t *self, float *inout_samples, int frame_count, int64_t frame);
+
+#endif /* TEST_REF_ADSR_H_ */
@@ -0,0 +1,176 @@
+/*
+ * ref_reverb.c
+ *
+ *  Created on: Oct 17, 2026
+ *      Author: agent
+ *
+ * see ref_reverb.h.  the same code as the old reverb.c, with the line
+ * helpers made static so they don't clash with the current ones.
+ */
+
+#include "ref_reverb.h"
+#include <string.h>
+
+static void line_init(ref_reverb_line_t *line, float *buf, int len, float gain);
+static void line_begin_block(ref_reverb_line_t *line, int frame_count);
+static float line_read(ref_reverb_line_t *line);
+static float comb_filter(ref_reverb_line_t *line, float v);
+static float allpass_filter(ref_reverb_line_t *line, float v);
+
+// base delays in frames for delay scale 1.0
+static const int comb_frames[NUM_COMBS] = { 1730, 1494, 1941, 2156 };
+static const int allp_frames[NUM_ALLPS] = { 240, 81, 23 };
+
+// ======================================================================
+void ref_reverb_init(ref_reverb_state_t *self, float wet, float delay)
+{
+  self->wet = wet;
+  self->wet_target = wet;
+  line_init(&(self->comb[0]), &(self->comb0[0]), COMB0_LEN, 0.805);
+  line_init(&(self->comb[1]), &(self->comb1[0]), COMB1_LEN, 0.827);
+  line_init(&(self->comb[2]), &(self->comb2[0]), COMB2_LEN, 0.783);
+  line_init(&(self->comb[3]), &(self->comb3[0]), COMB3_LEN, 0.764);
+  line_init(&(self->allp[0]), &(self->allp0[0]), ALLP0_LEN, 0.7);
+  line_init(&(self->allp[1]), &(self->allp1[0]), ALLP1_LEN, 0.7);
+  line_init(&(self->allp[2]), &(self->allp2[0]), ALLP2_LEN, 0.7);
+  ref_reverb_set_delay(self, delay);
+  // start at the delay instead of moving to it
+  for(int i = 0; i < NUM_COMBS; i++) {
+    self->comb[i].delay = self->comb[i].target;
+  }
+  for(int i = 0; i < NUM_ALLPS; i++) {
+    self->allp[i].delay = self->allp[i].target;
+  }
+}
+
+// ======================================================================
+void ref_reverb_set_wet(ref_reverb_state_t *self, float wet)
+{
+  self->wet_target = wet;
+}
+
+// ======================================================================
+void ref_reverb_set_delay(ref_reverb_state_t *self, float delay)
+{
+  self->delay = delay;
+  for(int i = 0; i < NUM_COMBS; i++) {
+    self->comb[i].target = (int)(delay * comb_frames[i]);
+  }
+  for(int i = 0; i < NUM_ALLPS; i++) {
+    self->allp[i].target = (int)(delay * allp_frames[i]);
+  }
+  // keep the read positions inside the buffers
+  ref_reverb_line_t *lines[NUM_COMBS + NUM_ALLPS] = {
+      &(self->comb[0]), &(self->comb[1]), &(self->comb[2]), &(self->comb[3]),
+      &(self->allp[0]), &(self->allp[1]), &(self->allp[2]) };
+  for(int i = 0; i < NUM_COMBS + NUM_ALLPS; i++) {
+    ref_reverb_line_t *line = lines[i];
+    line->target = (line->target < 1) ? 1 : (line->target > line->len) ? line->len : line->target;
+  }
+}
+
+// ======================================================================
+void ref_reverb_get_samples(ref_reverb_state_t *self, float *in_samples, float *out_samples, int frame_count)
+{
+  // wet moves a straight line toward its target across the block
+  float wet_step = (self->wet_target - self->wet) * ((float)frame_count / REVERB_WET_RAMP_FRAMES);
+  float wet_end = self->wet + wet_step;
+  if((wet_step > 0) ? (wet_end > self->wet_target) : (wet_end < self->wet_target)) {
+    wet_end = self->wet_target;
+  }
+  float wet_inc = (wet_end - self->wet) / frame_count;
+  float wet = self->wet;
+  for(int i = 0; i < NUM_COMBS; i++) {
+    line_begin_block(&(self->comb[i]), frame_count);
+  }
+  for(int i = 0; i < NUM_ALLPS; i++) {
+    line_begin_block(&(self->allp[i]), frame_count);
+  }
+
+  for(int frame = 0; frame < frame_count; frame++) {
+    float sample = in_samples[2*frame]; // just left sample for reverb input
+    float newsample = comb_filter(&(self->comb[0]), sample);
+    newsample += comb_filter(&(self->comb[1]), sample);
+    newsample += comb_filter(&(self->comb[2]), sample);
+    newsample += comb_filter(&(self->comb[3]), sample);
+    newsample /= 4;
+    newsample = allpass_filter(&(self->allp[0]), newsample);
+    newsample = allpass_filter(&(self->allp[1]), newsample);
+    newsample = allpass_filter(&(self->allp[2]), newsample);
+    wet += wet_inc;
+    newsample = (1.0f-wet)*sample + wet*newsample;
+    float newsample1 = (1.0f-wet)*in_samples[2*frame+1] + wet*newsample;
+    out_samples[2*frame] = newsample;
+    out_samples[2*frame+1] = newsample1;
+  }
+  self->wet = wet_end;
+}
+
+// ======================================================================
+static void line_init(ref_reverb_line_t *line, float *buf, int len, float gain)
+{
+  line->buf = buf;
+  line->len = len;
+  line->idx = 0;
+  line->gain = gain;
+  line->delay = len;
+  line->target = len;
+  line->delay_inc = 0.0f;
+  memset(buf, 0, sizeof(float)*len);
+}
+
+// ======================================================================
+static void line_begin_block(ref_reverb_line_t *line, int frame_count)
+{
+  float change = line->target - line->delay;
+  float max_change = REVERB_DELAY_SLEW * frame_count;
+  change = (change > max_change) ? max_change : (change < -max_change) ? -max_change : change;
+  line->delay_inc = change / frame_count;
+  if(line->delay_inc == 0.0f) {
+    // land exactly on the target
+    line->delay = line->target;
+  }
+}
+
+// ======================================================================
+static inline float line_read(ref_reverb_line_t *line)
+{
+  int delay = (int)line->delay;
+  int i0 = line->idx - delay;
+  if(i0 < 0) {
+    i0 += line->len;
+  }
+  float v = line->buf[i0];
+  if(line->delay_inc != 0.0f) {
+    float frac = line->delay - delay;
+    int i1 = (i0 == 0) ? line->len - 1 : i0 - 1;
+    v += (line->buf[i1] - v) * frac;
+    line->delay += line->delay_inc;
+  }
+  return v;
+}
+
+// ======================================================================
+static inline float comb_filter(ref_reverb_line_t *line, float v)
+{
+  float new_v = line_read(line)*line->gain + v;
+  line->buf[line->idx] = new_v;
+  line->idx += 1;
+  if (line->idx == line->len) {
+    line->idx = 0;
+  }
+  return new_v;
+}
+
+// ======================================================================
+static inline float allpass_filter(ref_reverb_line_t *line, float v)
+{
+  float feedback = line_read(line) + (-line->gain) * v;
+  float new_v = feedback*line->gain + v;
+  line->buf[line->idx] = new_v;
+  line->idx += 1;
+  if (line->idx == line->len) {
+    line->idx = 0;
+  }
+  return new_v;
+}
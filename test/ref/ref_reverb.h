@@ -0,0 +1,42 @@
+/*
+ * ref_reverb.h
+ *
+ *  Created on: Oct 17, 2026
+ *      Author: agent
+ *
+ * the schroeder reverb as it was before its lines shared one ring &
+ * ran a block at a time: 7 separate buffers, each wrapped with a compare,
+ * all 7 lines stepped together a frame at a time.  kept for bench_reverb.
+ */
+
+#ifndef TEST_REF_REVERB_H_
+#define TEST_REF_REVERB_H_
+
+#include "reverb.h"
+
+typedef struct {
+  float *buf;
+  int len;        // frames in buf
+  int idx;        // write position
+  float gain;
+  float delay;    // current delay in frames, moves toward target
+  float target;   // delay in frames set by ref_reverb_set_delay
+  float delay_inc;// change in delay per frame for the current block
+} ref_reverb_line_t;
+
+typedef struct {
+  float wet;
+  float wet_target;
+  float delay; // delay scale factor
+  ref_reverb_line_t comb[NUM_COMBS];
+  ref_reverb_line_t allp[NUM_ALLPS];
+  float comb0[COMB0_LEN], comb1[COMB1_LEN], comb2[COMB2_LEN], comb3[COMB3_LEN];
+  float allp0[ALLP0_LEN], allp1[ALLP1_LEN], allp2[ALLP2_LEN];
+} ref_reverb_state_t;
+
+void ref_reverb_init(ref_reverb_state_t *self, float wet, float delay);
+void ref_reverb_set_wet(ref_reverb_state_t *self, float wet);
+void ref_reverb_set_delay(ref_reverb_state_t *self, float delay);
+void ref_reverb_get_samples(ref_reverb_state_t *self, float *in_samples, float *out_samples, int frame_count);
+
+#endif /* TEST_REF_REVERB_H_ */
@@ -0,0 +1,67 @@
+/*
+ * ref_wavetable.c
+ *
+ *  Created on: Oct 17, 2026
+ *      Author: agent
+ *
+ * see ref_wavetable.h
+ */
+
+#include "ref_wavetable.h"
+#include "synthutil.h"
+
+// ======================================================================
+void ref_float_note_on(ref_float_wavetable_t *self, uint8_t wave, int8_t pitch)
+{
+  wavetable_state_t wt;
+  wavetable_init(&wt, wave);
+  wavetable_note_on(&wt, pitch, 127);
+  self->wave      = wave;
+  self->phase     = 0;
+  self->phase_inc = (wt.pitch_hz / FRAME_RATE) * WAVE_TABLE_LENGTH;
+  self->mip_level = wt.mip_level;
+}
+
+// ======================================================================
+void ref_float_get_samples(ref_float_wavetable_t *self, float *out_samples, int frame_count)
+{
+  for(int frame = 0; frame < frame_count; frame++) {
+    float sample_f;
+    switch(self->wave) {
+    case WAVE_SINE:
+      sample_f = sine_wave_table[(uint32_t)self->phase];
+      break;
+    case WAVE_SAW:
+    default:
+      sample_f = saw_wave_table[self->mip_level][(uint32_t)self->phase];
+      break;
+    }
+    out_samples[frame] = sample_f;
+    self->phase += self->phase_inc;
+    if(self->phase > WAVE_TABLE_LENGTH) {
+      self->phase -= WAVE_TABLE_LENGTH;
+    }
+  }
+}
+
+// ======================================================================
+void ref_switch_get_samples(wavetable_state_t *self, float *out_samples, int frame_count)
+{
+  for(int frame = 0; frame < frame_count; frame++) {
+    const float *table;
+    switch(self->wave) {
+    case WAVE_SINE:
+      table = sine_wave_table;
+      break;
+    case WAVE_SAW:
+    default:
+      table = saw_wave_table[self->mip_level];
+      break;
+    }
+    uint32_t idx = self->phase >> WAVE_PHASE_FRAC_BITS;
+    float frac = (float)(self->phase & WAVE_PHASE_FRAC_MASK) * (1.0f / (float)(1UL << WAVE_PHASE_FRAC_BITS));
+    float a = table[idx];
+    out_samples[frame] = a + (table[idx + 1] - a) * frac;
+    self->phase += self->phase_inc;
+  }
+}
@@ -0,0 +1,32 @@
+/*
+ * ref_wavetable.h
+ *
+ *  Created on: Oct 17, 2026
+ *      Author: agent
+ *
+ * the oscillator as it used to be, for bench_wavetable.  both read the
+ * current tables so only the oscillator code differs.
+ */
+
+#ifndef TEST_REF_WAVETABLE_H_
+#define TEST_REF_WAVETABLE_H_
+
+#include "wavetable.h"
+#include <stdint.h>
+
+// float phase in table entries, truncated to read the table
+typedef struct {
+  uint8_t wave;
+  float   phase;
+  float   phase_inc;
+  uint8_t mip_level;
+} ref_float_wavetable_t;
+
+void ref_float_note_on(ref_float_wavetable_t *self, uint8_t wave, int8_t pitch);
+void ref_float_get_samples(ref_float_wavetable_t *self, float *out_samples, int frame_count);
+
+// fixed point phase & interpolation, but picking the table with a switch
+// on every frame instead of a kernel per waveform
+void ref_switch_get_samples(wavetable_state_t *self, float *out_samples, int frame_count);
+
+#endif /* TEST_REF_WAVETABLE_H_ */
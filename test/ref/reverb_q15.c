@@ -0,0 +1,57 @@
+/*
+ * reverb_q15.c
+ *
+ *  Created on: Oct 17, 2026
+ *      Author: agent
+ *
+ * see reverb_q15.h.  reverb.c itself is built again with REVERB_Q15 on
+ * & every function it defines renamed, so it links next to the float
+ * build.  a function added to reverb.c needs adding here too, the link
+ * fails with a multiple definition until it is.
+ */
+
+#define REVERB_Q15 1
+
+#define reverb_init             q15_reverb_init
+#define reverb_set_algorithm    q15_reverb_set_algorithm
+#define reverb_layout           q15_reverb_layout
+#define reverb_set_wet          q15_reverb_set_wet
+#define reverb_set_delay        q15_reverb_set_delay
+#define reverb_set_room         q15_reverb_set_room
+#define reverb_set_damp         q15_reverb_set_damp
+#define reverb_get_samples      q15_reverb_get_samples
+#define reverb_block            q15_reverb_block
+#define reverb_lines            q15_reverb_lines
+#define line_init               q15_line_init
+#define line_set_target         q15_line_set_target
+#define line_begin_block        q15_line_begin_block
+#define comb_filter             q15_comb_filter
+#define allpass_filter          q15_allpass_filter
+#define damped_comb_filter      q15_damped_comb_filter
+#define damped_comb_bank        q15_damped_comb_bank
+#define freeverb_allpass_filter q15_freeverb_allpass_filter
+
+#include "../../Core/Src/reverb.c"
+
+#include "reverb_q15.h"
+
+static reverb_ring_t q15_ring;
+static reverb_state_t q15_reverb;
+
+// ======================================================================
+void reverb_q15_start(int algorithm, float wet, float delay)
+{
+  reverb_init(&q15_reverb, &q15_ring, algorithm, wet, delay);
+}
+
+// ======================================================================
+void reverb_q15_set_delay(float delay)
+{
+  reverb_set_delay(&q15_reverb, delay);
+}
+
+// ======================================================================
+void reverb_q15_get_samples(float *in_samples, float *out_samples, int frame_count)
+{
+  reverb_get_samples(&q15_reverb, in_samples, out_samples, frame_count);
+}
@@ -0,0 +1,19 @@
+/*
+ * reverb_q15.h
+ *
+ *  Created on: Oct 17, 2026
+ *      Author: agent
+ *
+ * the reverb as the REVERB_Q15 build has it, alongside the float one
+ * the rest of the tests link.  its types differ from reverb.h's, so it
+ * keeps its own state & ring & only takes samples.
+ */
+
+#ifndef TEST_REF_REVERB_Q15_H_
+#define TEST_REF_REVERB_Q15_H_
+
+void reverb_q15_start(int algorithm, float wet, float delay);
+void reverb_q15_set_delay(float delay);
+void reverb_q15_get_samples(float *in_samples, float *out_samples, int frame_count);
+
+#endif /* TEST_REF_REVERB_Q15_H_ */
@@ -0,0 +1,69 @@
+/*
+ * test.h
+ *
+ *  Created on: Oct 17, 2026
+ *      Author: agent
+ *
+ * small helpers shared by the host tests & benchmarks.  each test_*.c
+ * and bench_*.c is its own program, so these are static.
+ */
+
+#ifndef TEST_TEST_H_
+#define TEST_TEST_H_
+
+#include <stdio.h>
+#include <time.h>
+
+static int test_failures = 0;
+
+// count & report a failed check, keep going so one run shows them all
+#define CHECK(cond, ...) do {                                  \
+    if(!(cond)) {                                              \
+      printf("FAIL %s:%d: ", __FILE__, __LINE__);              \
+      printf(__VA_ARGS__);                                     \
+      printf("\n");                                            \
+      test_failures++;                                         \
+    }                                                          \
+  } while(0)
+
+// print the result & return the exit status for main
+static inline int test_done(const char *name)
+{
+  if(test_failures) {
+    printf("FAIL %s (%d failed)\n", name, test_failures);
+    return 1;
+  }
+  printf("PASS %s\n", name);
+  return 0;
+}
+
+// ======================================================================
+// benchmarks
+
+static inline double bench_now_ns(void)
+{
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return ts.tv_sec * 1e9 + ts.tv_nsec;
+}
+
+// best of BENCH_RUNS, the host is noisy & the fastest run is the most
+// repeatable.  body runs frames frames of audio once.
+#define BENCH_RUNS 7
+#define BENCH(result_ns_per_frame, frames, body) do {          \
+    double best_ = 1e30;                                       \
+    for(int run_ = 0; run_ < BENCH_RUNS; run_++) {             \
+      double t0_ = bench_now_ns();                             \
+      body;                                                    \
+      double t_ = bench_now_ns() - t0_;                        \
+      best_ = (t_ < best_) ? t_ : best_;                       \
+    }                                                          \
+    (result_ns_per_frame) = best_ / (frames);                  \
+  } while(0)
+
+static inline void bench_report(const char *label, double ns_per_frame)
+{
+  printf("  %-40s %8.2f ns/frame\n", label, ns_per_frame);
+}
+
+#endif /* TEST_TEST_H_ */
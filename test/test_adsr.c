@@ -0,0 +1,83 @@
+/*
+ * test_adsr.c
+ *
+ *  Created on: Oct 17, 2026
+ *      Author: agent
+ *
+ * changing the envelope curve in the middle of a segment must not upset
+ * that segment, which keeps the steps it started with.  the new curve
+ * takes over at the next segment.
+ */
+
+#include "test.h"
+#include "adsr.h"
+#include "synthutil.h"
+#include <math.h>
+
+#define BLOCK_FRAMES 128
+#define BLOCKS       200
+#define ATTACK       0.1f
+#define DECAY        0.1f
+#define SUSTAIN      0.5f
+
+// ======================================================================
+// play a note, switching from curve `from` to `to` after switch_block
+// blocks.  out gets every frame.
+void play(uint8_t from, uint8_t to, int switch_block, float *out)
+{
+  adsr_state_t env;
+  adsr_init(&env, ATTACK, DECAY, SUSTAIN, 0.1f, 1.0f);
+  env.curve = from;
+  adsr_note_on(&env, 127, 0);
+  for(int block = 0; block < BLOCKS; block++) {
+    if(block == switch_block) {
+      env.curve = to;
+    }
+    float *buf = &(out[block * BLOCK_FRAMES]);
+    for(int i = 0; i < BLOCK_FRAMES; i++) {
+      buf[i] = 1.0f;
+    }
+    adsr_get_samples(&env, buf, BLOCK_FRAMES);
+  }
+}
+
+static float out_from[BLOCKS * BLOCK_FRAMES];
+static float out_switched[BLOCKS * BLOCK_FRAMES];
+
+// ======================================================================
+int main(void)
+{
+  const int attack_frames = (int)(ATTACK * FRAME_RATE + 0.5f);
+  const int decay_end = attack_frames + (int)(DECAY * FRAME_RATE + 0.5f);
+  const int switch_block = 10; // in the middle of the attack
+  for(uint8_t from = ADSR_CURVE_LINEAR; from <= ADSR_CURVE_EXP; from++) {
+    uint8_t to = !from;
+    play(from, from, -1, out_from);
+    play(from, to, switch_block, out_switched);
+
+    // the attack carries on with the curve it started with
+    int same = 1;
+    for(int i = 0; i <= attack_frames; i++) {
+      same &= (out_switched[i] == out_from[i]);
+    }
+    CHECK(same, "curve %d -> %d: attack changed after the switch", from, to);
+
+    // the decay uses the new curve & still lands on the sustain level
+    int finite = 1;
+    for(int i = 0; i < BLOCKS * BLOCK_FRAMES; i++) {
+      finite &= isfinite(out_switched[i]) && (out_switched[i] >= 0.0f) && (out_switched[i] <= 1.0f);
+    }
+    CHECK(finite, "curve %d -> %d: envelope left 0..1", from, to);
+    CHECK(out_switched[decay_end] == SUSTAIN,
+        "curve %d -> %d: decay ends at %f, expected %f", from, to, out_switched[decay_end], SUSTAIN);
+    float mid_decay = out_switched[(attack_frames + decay_end) / 2];
+    float linear_mid = 0.5f * (1.0f + SUSTAIN);
+    if(to == ADSR_CURVE_EXP) {
+      CHECK(mid_decay < linear_mid - 0.1f, "curve %d -> %d: decay is not exponential (%f)", from, to, mid_decay);
+    } else {
+      CHECK(fabsf(mid_decay - linear_mid) < 1e-3f, "curve %d -> %d: decay is not linear (%f)", from, to, mid_decay);
+    }
+  }
+
+  return test_done("adsr");
+}
@@ -0,0 +1,189 @@
+/*
+ * test_biquad_cascade.c
+ *
+ *  Created on: Oct 17, 2026
+ *      Author: agent
+ *
+ * sf_biquad_cascade_process against the same stages run one after the
+ * other through sf_biquad_process.  noise goes through 1 to
+ * SF_BIQUAD_CASCADE_MAX stages of each design, in blocks of uneven
+ * sizes so the state has to carry across block boundaries.  the cascade
+ * is transposed direct form II & sf_biquad_process is direct form I, so
+ * they only differ by rounding.
+ *
+ * part way through every stage is set to a new design.  the two forms
+ * keep different history, so they part for a moment, but they have to
+ * come back together.  setting every stage to the design it already has
+ * has to leave the output exactly as it was, so no history is lost.
+ */
+
+#include "test.h"
+#include "biquad.h"
+#include "synthutil.h"
+#include <math.h>
+#include <string.h>
+
+#define FRAMES (76 * 128)
+#define RETUNE_FRAME (38 * 128)
+#define SETTLE_FRAMES 2400
+// relative to the largest reference output
+#define MAX_ERROR 1e-4
+
+enum { LOWPASS, HIGHPASS, BANDPASS, NOTCH, PEAKING, LOWSHELF, HIGHSHELF, NUM_TYPES };
+static const char *names[] = {
+  "lowpass", "highpass", "bandpass", "notch", "peaking", "lowshelf", "highshelf"
+};
+
+// block sizes the cascade is run in, over & over.  sf_biquad_process
+// always runs in 128s.
+static const int block_sizes[] = { 128, 1, 37, 64, 3, 255, 16 };
+
+static sf_sample_st input[FRAMES];
+static sf_sample_st cascade_out[FRAMES];
+static sf_sample_st chain_out[FRAMES];
+static sf_sample_st plain_out[FRAMES];
+static sf_sample_st reset_out[FRAMES];
+
+// ======================================================================
+// stage k's design, spread over the spectrum so each stage differs
+void design(sf_biquad_state_st *state, int type, int k, int retuned)
+{
+  float freq = 150.0f * powf(3.0f, k + (retuned ? 0.5f : 0.0f));
+  float gain = retuned ? -9.0f : 12.0f;
+  switch(type) {
+  case LOWPASS:   sf_lowpass(state, FRAME_RATE, freq, 6.0f); break;
+  case HIGHPASS:  sf_highpass(state, FRAME_RATE, freq, 6.0f); break;
+  case BANDPASS:  sf_bandpass(state, FRAME_RATE, freq, 2.0f); break;
+  case NOTCH:     sf_notch(state, FRAME_RATE, freq, 2.0f); break;
+  case PEAKING:   sf_peaking(state, FRAME_RATE, freq, 2.0f, gain); break;
+  case LOWSHELF:  sf_lowshelf(state, FRAME_RATE, freq, 1.0f, gain); break;
+  default:        sf_highshelf(state, FRAME_RATE, freq, 1.0f, gain); break;
+  }
+}
+
+// ======================================================================
+// copy design's coefficients into state, keeping state's history
+void set_coefficients(sf_biquad_state_st *state, const sf_biquad_state_st *design)
+{
+  state->b0 = design->b0;
+  state->b1 = design->b1;
+  state->b2 = design->b2;
+  state->a1 = design->a1;
+  state->a2 = design->a2;
+}
+
+// ======================================================================
+// the largest difference between out & the chain over frames [from, to)
+double difference(sf_sample_st *out, int from, int to)
+{
+  double error = 0.0;
+  for(int i = from; i < to; i++) {
+    error = fmax(error, fabs(out[i].L - chain_out[i].L));
+    error = fmax(error, fabs(out[i].R - chain_out[i].R));
+  }
+  return error;
+}
+
+// ======================================================================
+// runs the cascade & the chain of stages, & checks they match relative
+// to the chain's largest output.  returns the largest error.
+double run(int type, int stages)
+{
+  sf_biquad_cascade_st cascade, plain, reset;
+  sf_biquad_state_st chain[SF_BIQUAD_CASCADE_MAX];
+  sf_biquad_cascade_init(&cascade, stages);
+  for(int k = 0; k < stages; k++) {
+    design(&chain[k], type, k, 0);
+    sf_biquad_cascade_set(&cascade, k, &chain[k]);
+  }
+
+  for(int frame = 0; frame < FRAMES; frame += 128) {
+    if(frame == RETUNE_FRAME) {
+      for(int k = 0; k < stages; k++) {
+        sf_biquad_state_st retuned;
+        design(&retuned, type, k, 1);
+        set_coefficients(&chain[k], &retuned);
+      }
+    }
+    sf_biquad_process(&chain[0], 128, input + frame, chain_out + frame);
+    for(int k = 1; k < stages; k++) {
+      sf_biquad_process(&chain[k], 128, chain_out + frame, chain_out + frame);
+    }
+  }
+
+  // the first designs throughout, once straight through & once set
+  // again to the same designs at the retune
+  sf_biquad_cascade_init(&plain, stages);
+  sf_biquad_cascade_init(&reset, stages);
+  for(int k = 0; k < stages; k++) {
+    sf_biquad_state_st first;
+    design(&first, type, k, 0);
+    sf_biquad_cascade_set(&plain, k, &first);
+    sf_biquad_cascade_set(&reset, k, &first);
+  }
+  sf_biquad_cascade_process(&plain, FRAMES, input, plain_out);
+  sf_biquad_cascade_process(&reset, RETUNE_FRAME, input, reset_out);
+  for(int k = 0; k < stages; k++) {
+    sf_biquad_state_st first;
+    design(&first, type, k, 0);
+    sf_biquad_cascade_set(&reset, k, &first);
+  }
+  sf_biquad_cascade_process(&reset, FRAMES - RETUNE_FRAME, input + RETUNE_FRAME,
+      reset_out + RETUNE_FRAME);
+
+  int frame = 0;
+  for(int b = 0; frame < FRAMES; b++) {
+    int size = block_sizes[b % (sizeof(block_sizes) / sizeof(block_sizes[0]))];
+    // stop at the retune so it lands on the same frame as the chain's
+    if(frame < RETUNE_FRAME && frame + size > RETUNE_FRAME) {
+      size = RETUNE_FRAME - frame;
+    }
+    if(frame + size > FRAMES) {
+      size = FRAMES - frame;
+    }
+    if(frame == RETUNE_FRAME) {
+      for(int k = 0; k < stages; k++) {
+        sf_biquad_state_st retuned;
+        design(&retuned, type, k, 1);
+        sf_biquad_cascade_set(&cascade, k, &retuned);
+      }
+    }
+    sf_biquad_cascade_process(&cascade, size, input + frame, cascade_out + frame);
+    frame += size;
+  }
+
+  double peak = 0.0;
+  for(int i = 0; i < FRAMES; i++) {
+    peak = fmax(peak, fmax(fabs(chain_out[i].L), fabs(chain_out[i].R)));
+  }
+  double before = difference(cascade_out, 0, RETUNE_FRAME) / peak;
+  double after = difference(cascade_out, RETUNE_FRAME + SETTLE_FRAMES, FRAMES) / peak;
+  CHECK(before < MAX_ERROR, "%s, %d stages: error %.2e", names[type], stages, before);
+  CHECK(after < MAX_ERROR, "%s, %d stages: error %.2e after the retune", names[type], stages, after);
+  CHECK(memcmp(plain_out, reset_out, sizeof(plain_out)) == 0,
+      "%s, %d stages: lost its history when set", names[type], stages);
+  return fmax(before, after);
+}
+
+// ======================================================================
+int main(void)
+{
+  // different noise on each side, so crossed channels would show
+  uint32_t rng = 1;
+  for(int i = 0; i < FRAMES; i++) {
+    rng = rng * 1664525u + 1013904223u;
+    input[i].L = 0.5f * (float)(int32_t)rng / 2147483648.0f;
+    rng = rng * 1664525u + 1013904223u;
+    input[i].R = 0.5f * (float)(int32_t)rng / 2147483648.0f;
+  }
+
+  for(int type = 0; type < NUM_TYPES; type++) {
+    double worst = 0.0;
+    for(int stages = 1; stages <= SF_BIQUAD_CASCADE_MAX; stages++) {
+      worst = fmax(worst, run(type, stages));
+    }
+    printf("  %-9s worst error %.2e\n", names[type], worst);
+  }
+
+  return test_done("biquad_cascade");
+}
@@ -0,0 +1,63 @@
+/*
+ * test_biquad_fast.c
+ *
+ *  Created on: Oct 17, 2026
+ *      Author: agent
+ *
+ * sf_lowpass_fast must stay within MAX_ERROR of sf_lowpass, relative to
+ * the largest coefficient, for cutoffs up to a quarter of the rate &
+ * the whole range of resonances the synth uses.
+ */
+
+#include "test.h"
+#include "biquad.h"
+#include "synthutil.h"
+#include <math.h>
+
+#define MAX_ERROR 2.5e-5f
+
+// ======================================================================
+float coef_error(const sf_biquad_state_st *a, const sf_biquad_state_st *b)
+{
+  const float ca[5] = { a->b0, a->b1, a->b2, a->a1, a->a2 };
+  const float cb[5] = { b->b0, b->b1, b->b2, b->a1, b->a2 };
+  float largest = 0.0f, err = 0.0f;
+  for(int i = 0; i < 5; i++) {
+    largest = (fabsf(cb[i]) > largest) ? fabsf(cb[i]) : largest;
+    err = (fabsf(ca[i] - cb[i]) > err) ? fabsf(ca[i] - cb[i]) : err;
+  }
+  return err / largest;
+}
+
+// ======================================================================
+int main(void)
+{
+  float worst = 0.0f, worst_cutoff = 0.0f, worst_resonance = 0.0f;
+  // 10 Hz to a quarter of the rate in 1/48 octave steps
+  for(float cutoff = 10.0f; cutoff < FRAME_RATE / 4; cutoff *= exp2f(1.0f / 48)) {
+    for(float resonance = -20.0f; resonance <= 40.0f; resonance += 0.25f) {
+      sf_biquad_state_st fast, ref;
+      sf_lowpass_fast(&fast, FRAME_RATE, cutoff, resonance);
+      sf_lowpass(&ref, FRAME_RATE, cutoff, resonance);
+      float err = coef_error(&fast, &ref);
+      if(err > worst) {
+        worst = err;
+        worst_cutoff = cutoff;
+        worst_resonance = resonance;
+      }
+    }
+  }
+  printf("  sf_lowpass_fast worst error %.2e at %.0f Hz, %.2f dB\n", worst, worst_cutoff, worst_resonance);
+  CHECK(worst < MAX_ERROR, "error %.2e is over %.2e", worst, MAX_ERROR);
+
+  // the edges: at & past nyquist it passes through, at 0 it is silent
+  sf_biquad_state_st fast, ref;
+  sf_lowpass_fast(&fast, FRAME_RATE, FRAME_RATE, 6.0f);
+  sf_lowpass(&ref, FRAME_RATE, FRAME_RATE, 6.0f);
+  CHECK(coef_error(&fast, &ref) == 0.0f, "past nyquist differs from sf_lowpass");
+  sf_lowpass_fast(&fast, FRAME_RATE, 0.0f, 6.0f);
+  sf_lowpass(&ref, FRAME_RATE, 0.0f, 6.0f);
+  CHECK((fast.b0 == ref.b0) && (fast.b1 == ref.b1) && (fast.b2 == ref.b2), "at 0 Hz differs from sf_lowpass");
+
+  return test_done("biquad_fast");
+}
@@ -0,0 +1,129 @@
+/*
+ * test_biquad_fixed.c
+ *
+ *  Created on: Oct 17, 2026
+ *      Author: agent
+ *
+ * the fixed point biquad against sf_biquad_process for designs whose
+ * coefficients don't fit Q2.30 (shelves & peaking with gain), for a
+ * retune that ramps between a design that fits & one that doesn't, &
+ * for every rlpf type the way synth.c's rlpf_design builds it.
+ */
+
+#include "test.h"
+#include "biquad.h"
+#include "synthutil.h"
+#include <math.h>
+
+#define BLOCK_FRAMES 128
+#define BLOCKS       200
+// error of the fixed point output against the float one, measured
+// 115 dB or better
+#define MIN_SNR_DB   100.0
+
+static sf_sample_st input[BLOCKS][BLOCK_FRAMES];
+static sf_sample_st float_out[BLOCKS][BLOCK_FRAMES];
+static sf_sample_st fixed_out[BLOCKS][BLOCK_FRAMES];
+
+// ======================================================================
+// signal to error ratio in dB of fixed_out against float_out
+double snr_db(void)
+{
+  double signal = 0.0, noise = 0.0;
+  for(int block = 0; block < BLOCKS; block++) {
+    for(int i = 0; i < BLOCK_FRAMES; i++) {
+      double l = float_out[block][i].L, r = float_out[block][i].R;
+      double el = fixed_out[block][i].L - l, er = fixed_out[block][i].R - r;
+      signal += l*l + r*r;
+      noise += el*el + er*er;
+    }
+  }
+  return 10.0 * log10(signal / noise);
+}
+
+// ======================================================================
+// run design through both, switching to retune (if there is one) half
+// way through
+double compare(const sf_biquad_state_st *design, const sf_biquad_state_st *retune)
+{
+  sf_biquad_state_st biquad = *design;
+  sf_biquad_fixed_st fixed;
+  sf_biquad_fixed_init(&fixed, design);
+  for(int block = 0; block < BLOCKS; block++) {
+    if(retune && (block == BLOCKS/2)) {
+      sf_biquad_retune(&biquad, retune);
+      sf_biquad_fixed_retune(&fixed, retune);
+    }
+    sf_biquad_process(&biquad, BLOCK_FRAMES, input[block], float_out[block]);
+    sf_biquad_fixed_process(&fixed, BLOCK_FRAMES, input[block], fixed_out[block]);
+  }
+  return snr_db();
+}
+
+// ======================================================================
+int main(void)
+{
+  uint32_t rng = 1;
+  for(int block = 0; block < BLOCKS; block++) {
+    for(int i = 0; i < BLOCK_FRAMES; i++) {
+      rng = rng * 1664525u + 1013904223u;
+      float l = 0.25f * (float)(int32_t)rng / 2147483648.0f;
+      rng = rng * 1664525u + 1013904223u;
+      float r = 0.25f * (float)(int32_t)rng / 2147483648.0f;
+      input[block][i] = (sf_sample_st){ l, r };
+    }
+  }
+
+  const float gains[] = { 3.0f, 12.0f, 24.0f, -12.0f };
+  for(int g = 0; g < 4; g++) {
+    sf_biquad_state_st designs[3];
+    sf_lowshelf(&designs[0], FRAME_RATE, 900.0f, 1.41f, gains[g]);
+    sf_highshelf(&designs[1], FRAME_RATE, 900.0f, 1.41f, gains[g]);
+    sf_peaking(&designs[2], FRAME_RATE, 900.0f, 1.41f, gains[g]);
+    const char *names[] = { "lowshelf", "highshelf", "peaking" };
+    for(int d = 0; d < 3; d++) {
+      double snr = compare(&designs[d], NULL);
+      CHECK(snr > MIN_SNR_DB, "%s %+.0f dB: %.1f dB SNR against float", names[d], gains[g], snr);
+    }
+  }
+
+  // from a lowpass (Q2.30) to a +12 dB highshelf (b1 < -6) & back
+  sf_biquad_state_st lowpass, highshelf;
+  sf_lowpass(&lowpass, FRAME_RATE, 900.0f, 3.0f);
+  sf_highshelf(&highshelf, FRAME_RATE, 900.0f, 1.41f, 12.0f);
+  CHECK(fabsf(highshelf.b1) > 2.0f, "the highshelf doesn't need the headroom");
+  double snr = compare(&lowpass, &highshelf);
+  CHECK(snr > MIN_SNR_DB, "retune lowpass -> highshelf: %.1f dB SNR against float", snr);
+  snr = compare(&highshelf, &lowpass);
+  CHECK(snr > MIN_SNR_DB, "retune highshelf -> lowpass: %.1f dB SNR against float", snr);
+
+  // each rlpf type as rlpf_design makes it (resonance in dB, converted to
+  // a Q for the types that take one) at the default 900 Hz & 3 dB
+  const char *types[] = { "lowpass", "highpass", "bandpass", "notch", "peaking", "allpass", "lowshelf", "highshelf" };
+  for(int g = 0; g < 4; g++) {
+    float f = 900.0f, resonance = 3.0f, q = powf(10.0f, resonance * 0.05f);
+    sf_biquad_state_st designs[8];
+    sf_lowpass_fast(&designs[0], FRAME_RATE, f, resonance);
+    sf_highpass(&designs[1], FRAME_RATE, f, resonance);
+    sf_bandpass(&designs[2], FRAME_RATE, f, q);
+    sf_notch(&designs[3], FRAME_RATE, f, q);
+    sf_peaking(&designs[4], FRAME_RATE, f, q, gains[g]);
+    sf_allpass(&designs[5], FRAME_RATE, f, q);
+    sf_lowshelf(&designs[6], FRAME_RATE, f, q, gains[g]);
+    sf_highshelf(&designs[7], FRAME_RATE, f, q, gains[g]);
+    for(int t = 0; t < 8; t++) {
+      double snr = compare(&designs[t], NULL);
+      CHECK(snr > MIN_SNR_DB, "rlpf %s, gain %+.0f dB: %.1f dB SNR against float", types[t], gains[g], snr);
+    }
+  }
+
+  // the format comes back to Q2.30 once the design fits it again
+  sf_biquad_fixed_st fixed;
+  sf_biquad_fixed_init(&fixed, &highshelf);
+  sf_biquad_fixed_retune(&fixed, &lowpass);
+  sf_biquad_fixed_process(&fixed, BLOCK_FRAMES, input[0], fixed_out[0]);
+  sf_biquad_fixed_retune(&fixed, &lowpass);
+  CHECK(fixed.bits == 30, "still %d fraction bits after returning to a lowpass", fixed.bits);
+
+  return test_done("biquad_fixed");
+}
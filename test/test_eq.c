@@ -0,0 +1,146 @@
+/*
+ * test_eq.c
+ *
+ *  Created on: Oct 17, 2026
+ *      Author: agent
+ *
+ * eq_update & eq_process.  flat bands have to drop out of the cascade &
+ * a flat EQ has to leave the samples exactly as they were.  changing a
+ * band that is running, or adding or removing another band around it,
+ * has to keep its history, so the EQ doesn't click while it is being
+ * set.
+ */
+
+#include "test.h"
+#include "eq.h"
+#include <string.h>
+
+#define BLOCK_FRAMES 128
+#define BLOCKS 20
+
+static float input[BLOCKS][2*BLOCK_FRAMES];
+static float output[BLOCKS][2*BLOCK_FRAMES];
+static float expected[BLOCKS][2*BLOCK_FRAMES];
+
+// ======================================================================
+// run blocks [from, to) of the input through eq into out
+void run(eq_state_t *eq, float out[][2*BLOCK_FRAMES], int from, int to)
+{
+  for(int block = from; block < to; block++) {
+    memcpy(out[block], input[block], sizeof(input[block]));
+    eq_process(eq, out[block], BLOCK_FRAMES);
+  }
+}
+
+// ======================================================================
+// the history of band b's stage
+void band_history(eq_state_t *eq, int b, sf_sample_st history[2])
+{
+  history[0] = eq->cascade.stage[eq->stage[b]].s1;
+  history[1] = eq->cascade.stage[eq->stage[b]].s2;
+}
+
+// ======================================================================
+int main(void)
+{
+  uint32_t rng = 1;
+  for(int block = 0; block < BLOCKS; block++) {
+    for(int i = 0; i < 2*BLOCK_FRAMES; i++) {
+      rng = rng * 1664525u + 1013904223u;
+      input[block][i] = 0.5f * (float)(int32_t)rng / 2147483648.0f;
+    }
+  }
+
+  // flat, as it boots, & after a band has been set & put back
+  eq_state_t eq;
+  eq_init(&eq);
+  eq_update(&eq);
+  CHECK(eq.stages == 0, "flat EQ has %d stages", eq.stages);
+  run(&eq, output, 0, BLOCKS);
+  CHECK(memcmp(output, input, sizeof(input)) == 0, "flat EQ changed the samples");
+  eq_set_band(&eq, EQ_PEAK1, 500.0f, 6.0f);
+  eq_update(&eq);
+  run(&eq, output, 0, 1);
+  eq_set_band(&eq, EQ_PEAK1, 500.0f, 0.0f);
+  eq_update(&eq);
+  CHECK(eq.stages == 0, "EQ set back to flat has %d stages", eq.stages);
+  run(&eq, output, 1, BLOCKS);
+  CHECK(memcmp(output[1], input[1], sizeof(input) - sizeof(input[0])) == 0,
+      "EQ set back to flat changed the samples");
+
+  // flat bands are left out of the cascade, a band just inside
+  // EQ_FLAT_DB counts as flat
+  eq_init(&eq);
+  eq_set_band(&eq, EQ_LOWSHELF, 100.0f, -4.0f);
+  eq_set_band(&eq, EQ_PEAK1, 500.0f, 0.5f * EQ_FLAT_DB);
+  eq_set_band(&eq, EQ_PEAK2, 2000.0f, 3.5f);
+  eq_update(&eq);
+  CHECK(eq.stages == 2, "2 bands set, %d stages", eq.stages);
+  CHECK(eq.stage[EQ_LOWSHELF] == 0 && eq.stage[EQ_PEAK2] == 1, "bands are on stages %d & %d",
+      eq.stage[EQ_LOWSHELF], eq.stage[EQ_PEAK2]);
+  CHECK(eq.stage[EQ_PEAK1] == -1 && eq.stage[EQ_HIGHSHELF] == -1, "flat bands are on stages %d & %d",
+      eq.stage[EQ_PEAK1], eq.stage[EQ_HIGHSHELF]);
+  // the same as a cascade of just those two
+  sf_biquad_cascade_st cascade;
+  sf_biquad_cascade_init(&cascade, 2);
+  sf_biquad_cascade_set(&cascade, 0, &(eq.design[EQ_LOWSHELF]));
+  sf_biquad_cascade_set(&cascade, 1, &(eq.design[EQ_PEAK2]));
+  for(int block = 0; block < BLOCKS; block++) {
+    sf_biquad_cascade_process(&cascade, BLOCK_FRAMES, (sf_sample_st *)input[block],
+        (sf_sample_st *)expected[block]);
+  }
+  run(&eq, output, 0, BLOCKS);
+  CHECK(memcmp(output, expected, sizeof(output)) == 0, "EQ isn't the cascade of its bands");
+
+  // retuning a running band keeps its history
+  eq_init(&eq);
+  eq_set_band(&eq, EQ_PEAK2, 2000.0f, 6.0f);
+  eq_update(&eq);
+  run(&eq, output, 0, BLOCKS / 2);
+  sf_sample_st before[2], after[2];
+  band_history(&eq, EQ_PEAK2, before);
+  eq_set_band(&eq, EQ_PEAK2, 2500.0f, -3.0f);
+  eq_update(&eq);
+  band_history(&eq, EQ_PEAK2, after);
+  CHECK(memcmp(before, after, sizeof(before)) == 0, "retuned band lost its history");
+
+  // & so does setting it again to what it was, which can't change the output
+  eq_state_t same;
+  eq_init(&same);
+  eq_set_band(&same, EQ_PEAK2, 2000.0f, 6.0f);
+  eq_update(&same);
+  run(&same, expected, 0, BLOCKS);
+  eq_init(&eq);
+  eq_set_band(&eq, EQ_PEAK2, 2000.0f, 6.0f);
+  eq_update(&eq);
+  run(&eq, output, 0, BLOCKS / 2);
+  eq_set_band(&eq, EQ_PEAK2, 2000.0f, 6.0f);
+  eq_update(&eq);
+  run(&eq, output, BLOCKS / 2, BLOCKS);
+  CHECK(memcmp(output, expected, sizeof(output)) == 0, "setting a band again changed the output");
+
+  // a band added in front moves the running one to a later stage, with
+  // its history.  the new band starts with none.
+  band_history(&eq, EQ_PEAK2, before);
+  eq_set_band(&eq, EQ_LOWSHELF, 100.0f, 6.0f);
+  eq_update(&eq);
+  CHECK(eq.stage[EQ_LOWSHELF] == 0 && eq.stage[EQ_PEAK2] == 1, "bands are on stages %d & %d",
+      eq.stage[EQ_LOWSHELF], eq.stage[EQ_PEAK2]);
+  band_history(&eq, EQ_PEAK2, after);
+  CHECK(memcmp(before, after, sizeof(before)) == 0, "band lost its history when one was added");
+  band_history(&eq, EQ_LOWSHELF, after);
+  CHECK(after[0].L == 0.0f && after[0].R == 0.0f && after[1].L == 0.0f && after[1].R == 0.0f,
+      "added band has history");
+
+  // & back again when the band in front goes flat
+  run(&eq, output, 0, 1);
+  band_history(&eq, EQ_PEAK2, before);
+  eq_set_band(&eq, EQ_LOWSHELF, 100.0f, 0.0f);
+  eq_update(&eq);
+  CHECK(eq.stages == 1 && eq.stage[EQ_PEAK2] == 0, "band is on stage %d of %d",
+      eq.stage[EQ_PEAK2], eq.stages);
+  band_history(&eq, EQ_PEAK2, after);
+  CHECK(memcmp(before, after, sizeof(before)) == 0, "band lost its history when one was removed");
+
+  return test_done("eq");
+}
@@ -0,0 +1,128 @@
+/*
+ * test_reverb_q15.c
+ *
+ *  Created on: Oct 17, 2026
+ *      Author: agent
+ *
+ * the REVERB_Q15 build's noise floor against the float build.  a tone
+ * is played into both, all wet, then silence with a delay change in the
+ * tail.  the left tank is the same in both builds, so the difference
+ * between their left outputs is the noise the 16-bit lines add.  the
+ * Q15 tail has to die away to nothing (no limit cycles) & its right
+ * tank has to be decorrelated from the left.
+ */
+
+#include "test.h"
+#include "reverb.h"
+#include "ref/reverb_q15.h"
+#include "synthutil.h"
+#include <math.h>
+
+#define BLOCK_FRAMES 128
+#define TONE_BLOCKS  400
+#define BLOCKS       2000
+// measured 47 dB
+#define MIN_SNR_DB   40.0
+
+static float input[BLOCKS][2*BLOCK_FRAMES];
+static float float_out[BLOCKS][2*BLOCK_FRAMES];
+static float q15_out[BLOCKS][2*BLOCK_FRAMES];
+static reverb_ring_t ring;
+static reverb_state_t reverb;
+
+// ======================================================================
+double power_db(double sum, int count)
+{
+  return 10.0 * log10(sum / count);
+}
+
+// ======================================================================
+// correlation of the left & right outputs over blocks [from, to)
+double lr_correlation(float out[][2*BLOCK_FRAMES], int from, int to)
+{
+  double lr = 0.0, ll = 0.0, rr = 0.0;
+  for(int block = from; block < to; block++) {
+    for(int i = 0; i < BLOCK_FRAMES; i++) {
+      double l = out[block][2*i], r = out[block][2*i+1];
+      lr += l*r;
+      ll += l*l;
+      rr += r*r;
+    }
+  }
+  return lr / sqrt(ll * rr);
+}
+
+// ======================================================================
+void run_both(void)
+{
+  reverb_init(&reverb, &ring, REVERB_SCHROEDER, 1.0f, 1.0f);
+  reverb_q15_start(REVERB_SCHROEDER, 1.0f, 1.0f);
+  for(int block = 0; block < BLOCKS; block++) {
+    if(block == TONE_BLOCKS + 50) {
+      reverb_set_delay(&reverb, 1.3f);
+      reverb_q15_set_delay(1.3f);
+    }
+    reverb_get_samples(&reverb, input[block], float_out[block], BLOCK_FRAMES);
+    reverb_q15_get_samples(input[block], q15_out[block], BLOCK_FRAMES);
+  }
+}
+
+// ======================================================================
+int main(void)
+{
+  // a 0.5 amplitude 440 Hz tone
+  for(int block = 0; block < TONE_BLOCKS; block++) {
+    for(int i = 0; i < BLOCK_FRAMES; i++) {
+      float x = 0.5f * sinf(2.0f * (float)M_PI * 440.0f * (block * BLOCK_FRAMES + i) / FRAME_RATE);
+      input[block][2*i] = input[block][2*i+1] = x;
+    }
+  }
+  run_both();
+
+  double signal = 0.0, error = 0.0;
+  for(int block = 0; block < TONE_BLOCKS; block++) {
+    for(int i = 0; i < BLOCK_FRAMES; i++) {
+      double e = q15_out[block][2*i] - float_out[block][2*i];
+      signal += float_out[block][2*i] * float_out[block][2*i];
+      error += e * e;
+    }
+  }
+  int n = TONE_BLOCKS * BLOCK_FRAMES;
+  double snr = power_db(signal, n) - power_db(error, n);
+  printf("  playing: signal %.1f dB, Q15 error %.1f dB, %.1f dB SNR\n",
+      power_db(signal, n), power_db(error, n), snr);
+  CHECK(snr > MIN_SNR_DB, "Q15 SNR %.1f dB, expected over %.0f dB", snr, MIN_SNR_DB);
+
+  double float_tail = 0.0, q15_tail = 0.0;
+  for(int block = TONE_BLOCKS + 100; block < TONE_BLOCKS + 200; block++) {
+    for(int i = 0; i < BLOCK_FRAMES; i++) {
+      float_tail += float_out[block][2*i] * float_out[block][2*i];
+      q15_tail += q15_out[block][2*i] * q15_out[block][2*i];
+    }
+  }
+  printf("  tail, blocks %d-%d: float %.1f dB, Q15 %.1f dB\n", TONE_BLOCKS + 100, TONE_BLOCKS + 200,
+      power_db(float_tail, 100 * BLOCK_FRAMES), power_db(q15_tail, 100 * BLOCK_FRAMES));
+  CHECK(fabs(power_db(float_tail, 1) - power_db(q15_tail, 1)) < 3.0, "Q15 tail level is off the float one");
+
+  int q15_silent = 1;
+  for(int i = 0; i < 2*BLOCK_FRAMES; i++) {
+    q15_silent &= (q15_out[BLOCKS - 1][i] == 0.0f);
+  }
+  CHECK(q15_silent, "Q15 tail hasn't died away to nothing");
+
+  // the same noise into both sides
+  uint32_t rng = 1;
+  for(int block = 0; block < TONE_BLOCKS; block++) {
+    for(int i = 0; i < BLOCK_FRAMES; i++) {
+      rng = rng * 1664525u + 1013904223u;
+      input[block][2*i] = input[block][2*i+1] = 0.5f * (float)(int32_t)rng / 2147483648.0f;
+    }
+  }
+  run_both();
+  double float_corr = lr_correlation(float_out, TONE_BLOCKS, TONE_BLOCKS + 200);
+  double q15_corr = lr_correlation(q15_out, TONE_BLOCKS, TONE_BLOCKS + 200);
+  printf("  L/R tail correlation: float %.2f, Q15 %.2f\n", float_corr, q15_corr);
+  CHECK(q15_corr < 0.9, "Q15 tanks are not decorrelated");
+
+  return test_done("reverb_q15");
+}
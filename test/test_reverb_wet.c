@@ -0,0 +1,85 @@
+/*
+ * test_reverb_wet.c
+ *
+ *  Created on: Oct 17, 2026
+ *      Author: agent
+ *
+ * the wet ramp shared by the reverbs & the fdn.  a change of wet has to
+ * move in a straight line, reach its target in REVERB_WET_RAMP_FRAMES &
+ * stay there.  a change part way through restarts the ramp from where
+ * the wet level has got to.
+ */
+
+#include "test.h"
+#include "reverb.h"
+#include <math.h>
+
+#define BLOCK_FRAMES REVERB_BLOCK_FRAMES
+#define RAMP_BLOCKS (REVERB_WET_RAMP_FRAMES / BLOCK_FRAMES)
+#define TOLERANCE 1e-6f
+
+// ======================================================================
+// runs one block of frames, checking the per frame values line up with
+// the block's start & end.  returns the increment.
+float run_block(reverb_wet_t *wet)
+{
+  float inc;
+  float start = reverb_wet_block(wet, BLOCK_FRAMES, &inc);
+  float end = start + inc * BLOCK_FRAMES;
+  CHECK(fabsf(end - wet->wet) < TOLERANCE, "block ends at %f, wet is %f", end, wet->wet);
+  return inc;
+}
+
+// ======================================================================
+void check_ramp(float from, float to)
+{
+  reverb_wet_t wet;
+  reverb_wet_init(&wet, from);
+  reverb_wet_set(&wet, to);
+  float first = run_block(&wet);
+  CHECK(fabsf(first * REVERB_WET_RAMP_FRAMES - (to - from)) < TOLERANCE,
+      "%f to %f: first step %g isn't linear", from, to, first);
+  for(int block = 1; block < RAMP_BLOCKS; block++) {
+    float inc = run_block(&wet);
+    CHECK(fabsf(inc - first) < TOLERANCE, "%f to %f: block %d step %g, first was %g",
+        from, to, block, inc, first);
+  }
+  CHECK(fabsf(wet.wet - to) < TOLERANCE, "%f to %f: at %f after the ramp", from, to, wet.wet);
+  // it settles on the target & stays there
+  run_block(&wet);
+  CHECK(wet.wet == to, "%f to %f: at %f, not on the target", from, to, wet.wet);
+  for(int block = 0; block < 4; block++) {
+    float inc = run_block(&wet);
+    CHECK(inc == 0.0f && wet.wet == to, "%f to %f: moved off the target", from, to);
+  }
+}
+
+// ======================================================================
+int main(void)
+{
+  check_ramp(0.0f, 1.0f);
+  check_ramp(1.0f, 0.0f);
+  check_ramp(0.3f, 0.7f);
+  check_ramp(0.9f, 0.25f);
+  check_ramp(0.5f, 0.5f);
+
+  // turned back half way, it ramps down from where it had got to
+  reverb_wet_t wet;
+  reverb_wet_init(&wet, 0.0f);
+  reverb_wet_set(&wet, 1.0f);
+  for(int block = 0; block < RAMP_BLOCKS / 2; block++) {
+    run_block(&wet);
+  }
+  float halfway = wet.wet;
+  CHECK(fabsf(halfway - 0.5f) < TOLERANCE, "at %f half way up", halfway);
+  reverb_wet_set(&wet, 0.0f);
+  float inc = run_block(&wet);
+  CHECK(fabsf(inc * REVERB_WET_RAMP_FRAMES + halfway) < TOLERANCE,
+      "step %g back down from %f", inc, halfway);
+  for(int block = 1; block <= RAMP_BLOCKS; block++) {
+    run_block(&wet);
+  }
+  CHECK(wet.wet == 0.0f, "at %f, not back at 0", wet.wet);
+
+  return test_done("reverb_wet");
+}
@@ -0,0 +1,124 @@
+/*
+ * test_svf.c
+ *
+ *  Created on: Oct 17, 2026
+ *      Author: agent
+ *
+ * frequency response of the state variable filter.  sines are run
+ * through each output & their steady state gain is compared with the
+ * analog prototype the trapezoidal svf maps onto, at the prewarped
+ * frequency w = tan(pi f / FRAME_RATE) / g:
+ *   lowpass   1 / (1 - w^2 + jkw)
+ *   bandpass  jkw / (1 - w^2 + jkw)   (scaled by k for a 0 dB peak)
+ *   highpass  -w^2 / (1 - w^2 + jkw)
+ * & it has to stay stable with the cutoff jumping around at high
+ * resonance.
+ */
+
+#include "test.h"
+#include "svf.h"
+#include "synthutil.h"
+#include <math.h>
+
+#define BLOCK_FRAMES 128
+#define SETTLE_FRAMES FRAME_RATE
+#define MEASURE_FRAMES FRAME_RATE
+// the svf_tan approximation & float rounding
+#define MAX_ERROR_DB 0.05
+
+// ======================================================================
+// gain in dB of mode at freq, measured by running a sine through it
+double measured_db(uint8_t mode, float cutoff, float resonance, double freq)
+{
+  svf_state_t svf;
+  svf_init(&svf, mode, cutoff, resonance);
+  double phase_inc = 2.0 * M_PI * freq / FRAME_RATE;
+  double s_sum = 0.0, c_sum = 0.0, norm = 0.0;
+  for(int frame = 0; frame < SETTLE_FRAMES + MEASURE_FRAMES; frame += BLOCK_FRAMES) {
+    sf_sample_st buf[BLOCK_FRAMES];
+    for(int i = 0; i < BLOCK_FRAMES; i++) {
+      float x = (float)sin(phase_inc * (frame + i));
+      buf[i] = (sf_sample_st){ x, x };
+    }
+    svf_process(&svf, BLOCK_FRAMES, buf, buf);
+    if(frame >= SETTLE_FRAMES) {
+      // project the output onto sin & cos of the input frequency
+      for(int i = 0; i < BLOCK_FRAMES; i++) {
+        double p = phase_inc * (frame + i);
+        s_sum += buf[i].L * sin(p);
+        c_sum += buf[i].L * cos(p);
+        norm += sin(p) * sin(p);
+      }
+    }
+  }
+  return 20.0 * log10(sqrt(s_sum*s_sum + c_sum*c_sum) / norm);
+}
+
+// ======================================================================
+// gain in dB of the analog prototype
+double expected_db(uint8_t mode, float cutoff, float resonance, double freq)
+{
+  double g = tan(M_PI * cutoff / FRAME_RATE);
+  double k = 1.0 / pow(10.0, resonance * 0.05);
+  double w = tan(M_PI * freq / FRAME_RATE) / g;
+  double den = sqrt((1.0 - w*w) * (1.0 - w*w) + k*k*w*w);
+  double num = (mode == SVF_LOWPASS) ? 1.0 : (mode == SVF_BANDPASS) ? k*w : w*w;
+  return 20.0 * log10(num / den);
+}
+
+// ======================================================================
+int main(void)
+{
+  const char *names[] = { "lowpass", "bandpass", "highpass" };
+  const float cutoffs[] = { 100.0f, 1000.0f, 5000.0f, 15000.0f };
+  const float resonances[] = { -6.0f, 0.0f, 6.0f, 20.0f };
+  for(uint8_t mode = SVF_LOWPASS; mode <= SVF_HIGHPASS; mode++) {
+    for(int c = 0; c < 4; c++) {
+      for(int r = 0; r < 4; r++) {
+        // an octave either side of the cutoff & on it
+        for(int o = -2; o <= 2; o++) {
+          double freq = cutoffs[c] * pow(2.0, 0.5 * o);
+          if(freq >= 0.45 * FRAME_RATE) {
+            continue;
+          }
+          double got = measured_db(mode, cutoffs[c], resonances[r], freq);
+          double want = expected_db(mode, cutoffs[c], resonances[r], freq);
+          CHECK(fabs(got - want) < MAX_ERROR_DB, "%s %.0f Hz %.0f dB at %.0f Hz: %.3f dB, expected %.3f dB",
+              names[mode], cutoffs[c], resonances[r], freq, got, want);
+        }
+      }
+    }
+  }
+
+  // the lowpass peak at the cutoff is the resonance, the highpass &
+  // bandpass are 0 dB at the cutoff & there is no gain at dc
+  CHECK(fabs(measured_db(SVF_LOWPASS, 1000.0f, 12.0f, 1000.0) - 12.0) < MAX_ERROR_DB, "lowpass peak is not the resonance");
+  CHECK(fabs(measured_db(SVF_BANDPASS, 1000.0f, 12.0f, 1000.0)) < MAX_ERROR_DB, "bandpass peak is not 0 dB");
+  CHECK(fabs(measured_db(SVF_LOWPASS, 1000.0f, 0.0f, 10.0)) < MAX_ERROR_DB, "lowpass dc gain is not 0 dB");
+
+  // stable with the cutoff jumping every block at 40 dB of resonance
+  svf_state_t svf;
+  svf_init(&svf, SVF_LOWPASS, 1000.0f, 40.0f);
+  float peak = 0.0f;
+  int finite = 1;
+  uint32_t rng = 1;
+  for(int block = 0; block < 2000; block++) {
+    rng = rng * 1664525u + 1013904223u;
+    svf_set_cutoff(&svf, 20.0f + (rng >> 8) * (23000.0f / (1 << 24)));
+    sf_sample_st buf[BLOCK_FRAMES];
+    for(int i = 0; i < BLOCK_FRAMES; i++) {
+      rng = rng * 1664525u + 1013904223u;
+      float x = (float)(int32_t)rng / 2147483648.0f;
+      buf[i] = (sf_sample_st){ x, x };
+    }
+    svf_process(&svf, BLOCK_FRAMES, buf, buf);
+    for(int i = 0; i < BLOCK_FRAMES; i++) {
+      finite &= isfinite(buf[i].L);
+      peak = (fabsf(buf[i].L) > peak) ? fabsf(buf[i].L) : peak;
+    }
+  }
+  CHECK(finite, "output went inf or NaN with the cutoff jumping");
+  CHECK(peak < 1000.0f, "output reached %g with the cutoff jumping", peak);
+
+  return test_done("svf");
+}
@@ -0,0 +1,108 @@
+/*
+ * test_timebase.c
+ *
+ *  Created on: Oct 17, 2026
+ *      Author: agent
+ *
+ * the envelopes have to keep sample-exact timing however long the synth
+ * has been up.  play the same note at uptimes from 0 to years, driving
+ * the adsr the way update_audio_buffer does (128 frame blocks, 64-bit
+ * frame counter), & check every render is identical with its segments
+ * ending on the expected frames.
+ */
+
+#include "test.h"
+#include "adsr.h"
+#include "synthutil.h"
+#include <string.h>
+
+#define BLOCK_FRAMES 128
+#define NOTE_BLOCKS  200 // note off after this many blocks
+#define TOTAL_BLOCKS 300
+#define TOTAL_FRAMES (TOTAL_BLOCKS * BLOCK_FRAMES)
+
+#define ATTACK  0.1f
+#define DECAY   0.1f
+#define SUSTAIN 0.8f
+#define RELEASE 0.1f
+
+static float render_ref[TOTAL_FRAMES];
+static float render[TOTAL_FRAMES];
+
+// ======================================================================
+// play one note starting at synth frame uptime.  returns the frame (from
+// note on) at which the envelope went idle, -1 if it never did.
+int play_note(int64_t uptime, uint8_t curve, float *out)
+{
+  adsr_state_t env;
+  adsr_init(&env, ATTACK, DECAY, SUSTAIN, RELEASE, 1.0f);
+  env.curve = curve;
+  int idle_frame = -1;
+  int64_t synth_frame = uptime;
+  adsr_note_on(&env, 127, synth_frame);
+  for(int block = 0; block < TOTAL_BLOCKS; block++) {
+    if(block == NOTE_BLOCKS) {
+      adsr_note_off(&env, synth_frame);
+    }
+    float *buf = &(out[block * BLOCK_FRAMES]);
+    for(int i = 0; i < BLOCK_FRAMES; i++) {
+      buf[i] = 1.0f;
+    }
+    adsr_get_samples(&env, buf, BLOCK_FRAMES);
+    synth_frame += BLOCK_FRAMES;
+    if((idle_frame < 0) && !adsr_active(&env)) {
+      idle_frame = (int)(synth_frame - uptime);
+    }
+  }
+  return idle_frame;
+}
+
+// ======================================================================
+// first frame at or after start where out[] == level, -1 if none
+int find_level(const float *out, int start, float level)
+{
+  for(int i = start; i < TOTAL_FRAMES; i++) {
+    if(out[i] == level) {
+      return i;
+    }
+  }
+  return -1;
+}
+
+// ======================================================================
+int main(void)
+{
+  const int64_t hour = 3600LL * FRAME_RATE;
+  const int64_t uptimes[] = { 0, hour, 24*hour, 7*24*hour, 365*24*hour, 100*365*24*hour };
+  const int attack_frames = (int)(ATTACK * FRAME_RATE + 0.5f);
+  const int decay_frames = (int)(DECAY * FRAME_RATE + 0.5f);
+  const int release_frames = (int)(RELEASE * FRAME_RATE + 0.5f);
+  const int off_frame = NOTE_BLOCKS * BLOCK_FRAMES;
+
+  for(uint8_t curve = ADSR_CURVE_LINEAR; curve <= ADSR_CURVE_EXP; curve++) {
+    int idle_ref = play_note(0, curve, render_ref);
+
+    // segments end on exact frames
+    CHECK(find_level(render_ref, 0, 1.0f) == attack_frames,
+        "curve %d: attack peaks at frame %d, expected %d", curve, find_level(render_ref, 0, 1.0f), attack_frames);
+    CHECK(find_level(render_ref, 0, SUSTAIN) == attack_frames + decay_frames,
+        "curve %d: decay ends at frame %d, expected %d", curve, find_level(render_ref, 0, SUSTAIN), attack_frames + decay_frames);
+    CHECK(render_ref[off_frame - 1] == SUSTAIN, "curve %d: not sustaining at note off", curve);
+    CHECK(find_level(render_ref, off_frame, 0.0f) == off_frame + release_frames,
+        "curve %d: release ends at frame %d, expected %d", curve, find_level(render_ref, off_frame, 0.0f), off_frame + release_frames);
+    // idle is noticed at the end of the block the release ends in
+    int idle_expected = ((off_frame + release_frames) / BLOCK_FRAMES + 1) * BLOCK_FRAMES;
+    CHECK(idle_ref == idle_expected, "curve %d: idle after frame %d, expected %d", curve, idle_ref, idle_expected);
+
+    // & nothing changes with uptime
+    for(int u = 1; u < (int)(sizeof(uptimes)/sizeof(uptimes[0])); u++) {
+      int idle = play_note(uptimes[u], curve, render);
+      CHECK(memcmp(render, render_ref, sizeof(render)) == 0,
+          "curve %d: render at %lld hours differs from 0 hours", curve, (long long)(uptimes[u] / hour));
+      CHECK(idle == idle_ref,
+          "curve %d: idle at %d after %lld hours, %d at 0 hours", curve, idle, (long long)(uptimes[u] / hour), idle_ref);
+    }
+  }
+
+  return test_done("timebase");
+}
@@ -0,0 +1,87 @@
+/*
+ * test_vcf.c
+ *
+ *  Created on: Oct 17, 2026
+ *      Author: agent
+ *
+ * the per voice filter has to stay stable whatever cutoff the envelope,
+ * velocity & fenv add up to.  sweep a saw through cutoffs far above
+ * nyquist at high resonance & check the output stays finite & sane, &
+ * that a cutoff past nyquist still gives a lowpass, not the b0 only
+ * bank's version of a passthrough (x0 + 2x1 + x2, +12 dB).
+ */
+
+#include "test.h"
+#include "vcf.h"
+#include "wavetable.h"
+#include "synthutil.h"
+#include <math.h>
+
+#define BLOCK_FRAMES 128
+#define BLOCKS       400
+
+// ======================================================================
+// dc gain of the voice's target design, b0*(1 + 2 + 1) / (1 + a1 + a2)
+float dc_gain(vcf_bank_t *bank, uint8_t voice)
+{
+  return 4.0f * bank->tb0[voice] / (1.0f + bank->ta1[voice] + bank->ta2[voice]);
+}
+
+// ======================================================================
+// largest pole radius of the voice's target design, the roots of
+// z^2 + a1 z + a2
+float pole_radius(vcf_bank_t *bank, uint8_t voice)
+{
+  float a1 = bank->ta1[voice];
+  float a2 = bank->ta2[voice];
+  float d = a1*a1 - 4.0f*a2;
+  if(d < 0.0f) {
+    return sqrtf(a2);
+  }
+  return 0.5f * (fabsf(a1) + sqrtf(d));
+}
+
+// ======================================================================
+int main(void)
+{
+  vcf_bank_t bank;
+  vcf_init(&bank);
+
+  // cutoffs from low to 4x nyquist, up & down, one voice per resonance
+  const float resonances[] = { -10.0f, 0.0f, 6.0f, 20.0f, 40.0f };
+  const int voices = sizeof(resonances) / sizeof(resonances[0]);
+  for(int v = 0; v < voices; v++) {
+    wavetable_state_t osc;
+    wavetable_init(&osc, WAVE_SAW);
+    wavetable_note_on(&osc, 57, 127);
+    vcf_note_on(&bank, v, 300.0f, resonances[v]);
+    float peak = 0.0f;
+    int finite = 1;
+    for(int block = 0; block < BLOCKS; block++) {
+      float octaves = 9.0f * ((block < BLOCKS/2) ? block : (BLOCKS - block)) / (BLOCKS/2);
+      vcf_set(&bank, v, 300.0f * exp2f(octaves), resonances[v]);
+      float buf[BLOCK_FRAMES];
+      wavetable_get_samples(&osc, buf, BLOCK_FRAMES);
+      vcf_process(&bank, v, buf, BLOCK_FRAMES);
+      for(int i = 0; i < BLOCK_FRAMES; i++) {
+        finite &= isfinite(buf[i]);
+        peak = (fabsf(buf[i]) > peak) ? fabsf(buf[i]) : peak;
+      }
+    }
+    CHECK(finite, "resonance %.0f dB: output went inf or NaN", resonances[v]);
+    // a 40 dB peak on a full scale saw harmonic is about 100
+    CHECK(peak < 200.0f, "resonance %.0f dB: output reached %g", resonances[v], peak);
+  }
+
+  // past nyquist, inf & NaN all end up at the highest cutoff, a lowpass
+  const float cutoffs[] = { FRAME_RATE / 4, FRAME_RATE / 2, FRAME_RATE, INFINITY, NAN };
+  for(int c = 0; c < (int)(sizeof(cutoffs) / sizeof(cutoffs[0])); c++) {
+    vcf_set(&bank, 0, cutoffs[c], 0.0f);
+    float gain = dc_gain(&bank, 0);
+    CHECK(fabsf(gain - 1.0f) < 1e-3f, "cutoff %g: dc gain %g, not a lowpass", cutoffs[c], gain);
+    float radius = pole_radius(&bank, 0);
+    CHECK(radius < 1.0f, "cutoff %g: pole radius %g", cutoffs[c], radius);
+  }
+
+  return test_done("vcf");
+}
@@ -0,0 +1,84 @@
+/*
+ * test_wavetable_gen.c
+ *
+ *  Created on: Oct 17, 2026
+ *      Author: agent
+ *
+ * the const tables from wavetable_gen.py must match what the synth used
+ * to compute at boot: a sine, & the saw mipmaps added up harmonic by
+ * harmonic from the sine table.  the boot code is copied here.  (make
+ * test also checks wavetable_data.c is what the generator outputs now.)
+ */
+
+#include "test.h"
+#include "wavetable.h"
+#include <math.h>
+#include <string.h>
+
+// the generator works in double & the boot code summed in float, so
+// allow for the float rounding of a few hundred harmonics
+#define MAX_ERROR 4e-6f
+
+static float boot_sine[WAVE_TABLE_LENGTH + 1];
+static float boot_saw[WAVE_MIP_LEVELS][WAVE_TABLE_LENGTH + 1];
+
+// in wavetable.c, not in its header
+int mip_harmonics(int level);
+
+// ======================================================================
+// as wavetable_sine_init & wavetable_saw_init did at boot
+void boot_init(void)
+{
+  for (int i = 0; i < WAVE_TABLE_LENGTH; i++) {
+    boot_sine[i] = sin((2.0 * M_PI * i) / WAVE_TABLE_LENGTH);
+  }
+  boot_sine[WAVE_TABLE_LENGTH] = boot_sine[0];
+
+  int prev_harmonics = 0;
+  for (int level = WAVE_MIP_LEVELS - 1; level >= 0; level--) {
+    float *table = boot_saw[level];
+    if (level == WAVE_MIP_LEVELS - 1) {
+      memset(table, 0, sizeof(float) * (WAVE_TABLE_LENGTH + 1));
+    } else {
+      memcpy(table, boot_saw[level + 1], sizeof(float) * (WAVE_TABLE_LENGTH + 1));
+    }
+    int harmonics = mip_harmonics(level);
+    for (int h = prev_harmonics + 1; h <= harmonics; h++) {
+      float amp = ((h & 1) ? -1.0f : 1.0f) / h * (2.0f / (float)M_PI);
+      for (int i = 0; i < WAVE_TABLE_LENGTH; i++) {
+        table[i] += amp * boot_sine[(h * i) & (WAVE_TABLE_LENGTH - 1)];
+      }
+    }
+    table[WAVE_TABLE_LENGTH] = table[0];
+    prev_harmonics = harmonics;
+  }
+}
+
+// ======================================================================
+float max_error(const float *a, const float *b)
+{
+  float err = 0.0f;
+  for(int i = 0; i < WAVE_TABLE_LENGTH + 1; i++) {
+    float e = fabsf(a[i] - b[i]);
+    err = (e > err) ? e : err;
+  }
+  return err;
+}
+
+// ======================================================================
+int main(void)
+{
+  boot_init();
+
+  float err = max_error(sine_wave_table, boot_sine);
+  CHECK(err < MAX_ERROR, "sine differs by %.3g", err);
+  CHECK(sine_wave_table[WAVE_TABLE_LENGTH] == sine_wave_table[0], "sine guard entry is not the first entry");
+  for(int level = 0; level < WAVE_MIP_LEVELS; level++) {
+    err = max_error(saw_wave_table[level], boot_saw[level]);
+    CHECK(err < MAX_ERROR, "saw level %d differs by %.3g", level, err);
+    CHECK(saw_wave_table[level][WAVE_TABLE_LENGTH] == saw_wave_table[level][0],
+        "saw level %d guard entry is not the first entry", level);
+  }
+
+  return test_done("wavetable_gen");
+}
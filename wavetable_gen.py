@@ -0,0 +1,73 @@
+#!/usr/bin/env python3
+# generate the const wave tables in Core/Src/wavetable_data.c
+#
+# usage: ./wavetable_gen.py > Core/Src/wavetable_data.c
+#
+# WAVE_TABLE_BITS must match Core/Inc/wavetable.h.  The generated file
+# checks this at compile time.
+#
+# To add a waveform, add an entry to WAVES with a function giving the
+# amplitude of harmonic h (1 = fundamental) & add its table to
+# wavetable.h.  Waveforms with harmonics above the fundamental get one
+# band-limited table per mip level.
+import math
+import sys
+
+WAVE_TABLE_BITS = 10
+WAVE_TABLE_LENGTH = 1 << WAVE_TABLE_BITS
+WAVE_MIP_LEVELS = WAVE_TABLE_BITS - 1
+
+def saw_harmonic(h):
+    return (-1.0 if h & 1 else 1.0) / h * (2.0 / math.pi)
+
+# name, harmonic amplitude function, mipmapped
+WAVES = [
+    ("sine_wave_table", lambda h: 1.0 if h == 1 else 0.0, False),
+    ("saw_wave_table",  saw_harmonic,                     True),
+]
+
+def mip_harmonics(level):
+    # same as mip_harmonics() in wavetable.c
+    return (WAVE_TABLE_LENGTH // 2 - 1) >> level
+
+def make_table(amplitude, harmonics):
+    table = [0.0] * WAVE_TABLE_LENGTH
+    for h in range(1, harmonics + 1):
+        a = amplitude(h)
+        if a == 0.0:
+            continue
+        for i in range(WAVE_TABLE_LENGTH):
+            table[i] += a * math.sin(2.0 * math.pi * ((h * i) % WAVE_TABLE_LENGTH) / WAVE_TABLE_LENGTH)
+    # guard entry so interpolation never has to wrap
+    return table + [table[0]]
+
+def write_table(out, table, indent):
+    for i in range(0, len(table), 8):
+        row = ", ".join(f"{v: .9e}f" for v in table[i:i+8])
+        out.write(f"{indent}{row},\n")
+
+def main(out):
+    out.write("/*\n")
+    out.write(" * wavetable_data.c\n")
+    out.write(" *\n")
+    out.write(" * GENERATED by wavetable_gen.py -- do not edit.\n")
+    out.write(" */\n\n")
+    out.write('#include "wavetable.h"\n\n')
+    out.write(f"#if WAVE_TABLE_BITS != {WAVE_TABLE_BITS}\n")
+    out.write("#error wavetable_data.c is out of date, rerun wavetable_gen.py\n")
+    out.write("#endif\n")
+    for name, amplitude, mipmapped in WAVES:
+        out.write("\n")
+        if mipmapped:
+            out.write(f"const float {name}[WAVE_MIP_LEVELS][WAVE_TABLE_LENGTH + 1] = {{\n")
+            for level in range(WAVE_MIP_LEVELS):
+                out.write(f"  {{ // level {level}: {mip_harmonics(level)} harmonics\n")
+                write_table(out, make_table(amplitude, mip_harmonics(level)), "    ")
+                out.write("  },\n")
+        else:
+            out.write(f"const float {name}[WAVE_TABLE_LENGTH + 1] = {{\n")
+            write_table(out, make_table(amplitude, 1), "  ")
+        out.write("};\n")
+
+if __name__ == "__main__":
+    main(sys.stdout)